@@ -29,9 +29,42 @@ static void test_Priority_values() {
     TEST_SECTION("Priority Enum Values");
     
     printf("Priority_LOW = %d\n", Priority_LOW);
+    {
+        Priority parsed;
+        const char* name = Priority_ToString(Priority_LOW);
+        TEST_ASSERT(name && strcmp(name, "LOW") == 0, "Priority_ToString should name LOW");
+        TEST_ASSERT(Priority_FromString("LOW", &parsed) && parsed == Priority_LOW,
+                    "Priority_FromString should parse LOW");
+    }
     printf("Priority_MEDIUM = %d\n", Priority_MEDIUM);
+    {
+        Priority parsed;
+        const char* name = Priority_ToString(Priority_MEDIUM);
+        TEST_ASSERT(name && strcmp(name, "MEDIUM") == 0, "Priority_ToString should name MEDIUM");
+        TEST_ASSERT(Priority_FromString("MEDIUM", &parsed) && parsed == Priority_MEDIUM,
+                    "Priority_FromString should parse MEDIUM");
+    }
     printf("Priority_HIGH = %d\n", Priority_HIGH);
+    {
+        Priority parsed;
+        const char* name = Priority_ToString(Priority_HIGH);
+        TEST_ASSERT(name && strcmp(name, "HIGH") == 0, "Priority_ToString should name HIGH");
+        TEST_ASSERT(Priority_FromString("HIGH", &parsed) && parsed == Priority_HIGH,
+                    "Priority_FromString should parse HIGH");
+    }
     printf("Priority_URGENT = %d\n", Priority_URGENT);
+    {
+        Priority parsed;
+        const char* name = Priority_ToString(Priority_URGENT);
+        TEST_ASSERT(name && strcmp(name, "URGENT") == 0, "Priority_ToString should name URGENT");
+        TEST_ASSERT(Priority_FromString("URGENT", &parsed) && parsed == Priority_URGENT,
+                    "Priority_FromString should parse URGENT");
+    }
+    {
+        Priority parsed = Priority_LOW;
+        TEST_ASSERT(!Priority_FromString("", &parsed) && parsed == Priority_LOW,
+                    "Priority_FromString should reject unknown names");
+    }
 }
 
 // Test Status enum values
@@ -39,9 +72,56 @@ static void test_Status_values() {
     TEST_SECTION("Status Enum Values");
     
     printf("Status_PENDING = %d\n", Status_PENDING);
+    {
+        Status parsed;
+        const char* name = Status_ToString(Status_PENDING);
+        TEST_ASSERT(name && strcmp(name, "PENDING") == 0, "Status_ToString should name PENDING");
+        TEST_ASSERT(Status_FromString("PENDING", &parsed) && parsed == Status_PENDING,
+                    "Status_FromString should parse PENDING");
+    }
     printf("Status_IN_PROGRESS = %d\n", Status_IN_PROGRESS);
+    {
+        Status parsed;
+        const char* name = Status_ToString(Status_IN_PROGRESS);
+        TEST_ASSERT(name && strcmp(name, "IN_PROGRESS") == 0, "Status_ToString should name IN_PROGRESS");
+        TEST_ASSERT(Status_FromString("IN_PROGRESS", &parsed) && parsed == Status_IN_PROGRESS,
+                    "Status_FromString should parse IN_PROGRESS");
+    }
     printf("Status_COMPLETED = %d\n", Status_COMPLETED);
+    {
+        Status parsed;
+        const char* name = Status_ToString(Status_COMPLETED);
+        TEST_ASSERT(name && strcmp(name, "COMPLETED") == 0, "Status_ToString should name COMPLETED");
+        TEST_ASSERT(Status_FromString("COMPLETED", &parsed) && parsed == Status_COMPLETED,
+                    "Status_FromString should parse COMPLETED");
+    }
     printf("Status_CANCELLED = %d\n", Status_CANCELLED);
+    {
+        Status parsed;
+        const char* name = Status_ToString(Status_CANCELLED);
+        TEST_ASSERT(name && strcmp(name, "CANCELLED") == 0, "Status_ToString should name CANCELLED");
+        TEST_ASSERT(Status_FromString("CANCELLED", &parsed) && parsed == Status_CANCELLED,
+                    "Status_FromString should parse CANCELLED");
+    }
+    {
+        Status parsed = Status_PENDING;
+        TEST_ASSERT(!Status_FromString("", &parsed) && parsed == Status_PENDING,
+                    "Status_FromString should reject unknown names");
+    }
+}
+
+// Report TaskSummary layout
+static void test_TaskSummary_layout() {
+    TEST_SECTION("TaskSummary Struct Layout");
+
+    TaskSummary value;
+    memset(&value, 0, sizeof(value));
+    printf("sizeof(TaskSummary) = %zu\n", sizeof(value));
+    printf("  priority at offset %zu\n", (size_t)((const char*)&value.priority - (const char*)&value));
+    printf("  status at offset %zu\n", (size_t)((const char*)&value.status - (const char*)&value));
+    printf("  overdue at offset %zu\n", (size_t)((const char*)&value.overdue - (const char*)&value));
+    printf("  id at offset %zu\n", (size_t)((const char*)&value.id - (const char*)&value));
+    printf("  title at offset %zu\n", (size_t)((const char*)&value.title - (const char*)&value));
 }
 
 // Test ITask interface
@@ -60,11 +140,13 @@ static void test_ITask() {
     
     // Test property: id
     {
-        IDynamicString_Handle str_handle = ITask_Getid(obj);
-        const char* value = str_handle ? IDynamicString_GetValue(str_handle) : NULL;
-        printf("id initial value: %s\n", value ? value : "(null)");
-        if (str_handle) {
-            IDynamicString_Release(str_handle);
+        TaskManager_Id value = ITask_Getid(obj);
+        printf("id initial value: ");
+        printf("%s\n", TaskManager_GetIdValue(value));
+        {
+            TaskManager_Id batch[1];
+            size_t done = ITask_Getid_Batch(&obj, 1, batch);
+            TEST_ASSERT(done == 1 && batch[0] == value, "id batch getter should match getter");
         }
         
     }
@@ -113,13 +195,28 @@ static void test_ITask() {
             IDynamicString_Release(new_str);
         }
         IDynamicString_Release(test_str);
+        
+        // Only the first length bytes of a view are set
+        TaskManager_StringView test_view = {test_string, 4};
+        ITask_Setdescription_View(obj, test_view);
+        IDynamicString_Handle view_str = ITask_Getdescription(obj);
+        const char* view_value = view_str ? IDynamicString_GetValue(view_str) : NULL;
+        TEST_ASSERT(view_value && strcmp(view_value, "Test") == 0, "description view setter should copy the view");
+        if (view_str) {
+            IDynamicString_Release(view_str);
+        }
     }
     
     // Test property: priority
     {
         Priority value = ITask_Getpriority(obj);
         printf("priority initial value: ");
-        printf("(unknown type)\n");
+        printf("%d\n", (int)value);
+        {
+            Priority batch[1];
+            size_t done = ITask_Getpriority_Batch(&obj, 1, batch);
+            TEST_ASSERT(done == 1 && batch[0] == value, "priority batch getter should match getter");
+        }
         
         // Test setter
     }
@@ -128,7 +225,12 @@ static void test_ITask() {
     {
         Status value = ITask_Getstatus(obj);
         printf("status initial value: ");
-        printf("(unknown type)\n");
+        printf("%d\n", (int)value);
+        {
+            Status batch[1];
+            size_t done = ITask_Getstatus_Batch(&obj, 1, batch);
+            TEST_ASSERT(done == 1 && batch[0] == value, "status batch getter should match getter");
+        }
         
         // Test setter
     }
@@ -155,6 +257,16 @@ static void test_ITask() {
             IDynamicString_Release(new_str);
         }
         IDynamicString_Release(test_str);
+        
+        // Only the first length bytes of a view are set
+        TaskManager_StringView test_view = {test_string, 4};
+        ITask_Setdue_date_View(obj, test_view);
+        IDynamicString_Handle view_str = ITask_Getdue_date(obj);
+        const char* view_value = view_str ? IDynamicString_GetValue(view_str) : NULL;
+        TEST_ASSERT(view_value && strcmp(view_value, "Test") == 0, "due_date view setter should copy the view");
+        if (view_str) {
+            IDynamicString_Release(view_str);
+        }
     }
     
     // Test property: tags
@@ -171,6 +283,19 @@ static void test_ITask() {
             }
         }
         
+        // Test bulk replace and read-back
+        TaskManager_StringView bulk[2] = { {"first", 5}, {"second", 6} };
+        ITask_Settags_SetAll(obj, bulk, 2);
+        IDynamicString_Handle read_back[2] = {NULL, NULL};
+        size_t total = ITask_Gettags_GetAll(obj, read_back, 2);
+        TEST_ASSERT(total == 2 && read_back[1] && strcmp(IDynamicString_GetValue(read_back[1]), "second") == 0,
+                    "tags bulk accessors should round-trip");
+        for (size_t i = 0; i < 2; i++) {
+            if (read_back[i]) {
+                IDynamicString_Release(read_back[i]);
+            }
+        }
+        
         // Test array modification
         ITask_Settags_Clear(obj);
         size_t new_count = ITask_Gettags_Count(obj);
@@ -202,11 +327,25 @@ static void test_ITask() {
     // Method has parameters or return value - would need specific test values
     printf("SetMetadata - skipping (requires test parameters)\n");
     
+    // Test snapshot
+    {
+        ITask_Snapshot_t snapshot;
+        TEST_ASSERT(ITask_Snapshot(obj, &snapshot), "Snapshot should succeed");
+        ITask_Snapshot_Release(&snapshot);
+        TEST_ASSERT(snapshot._storage == NULL, "Snapshot release should clear the snapshot");
+    }
+    
     // Cleanup
     ITask_Release(obj);
     printf("Released ITask instance\n");
 }
 
+static void on_IProject_TaskCountChanged(void* context, int32_t count) {
+    (void)context;
+    (void)count;
+    printf("TaskCountChanged delivered\n");
+}
+
 // Test IProject interface
 static void test_IProject() {
     TEST_SECTION("IProject Interface");
@@ -223,11 +362,13 @@ static void test_IProject() {
     
     // Test property: id
     {
-        IDynamicString_Handle str_handle = IProject_Getid(obj);
-        const char* value = str_handle ? IDynamicString_GetValue(str_handle) : NULL;
-        printf("id initial value: %s\n", value ? value : "(null)");
-        if (str_handle) {
-            IDynamicString_Release(str_handle);
+        TaskManager_Id value = IProject_Getid(obj);
+        printf("id initial value: ");
+        printf("%s\n", TaskManager_GetIdValue(value));
+        {
+            TaskManager_Id batch[1];
+            size_t done = IProject_Getid_Batch(&obj, 1, batch);
+            TEST_ASSERT(done == 1 && batch[0] == value, "id batch getter should match getter");
         }
         
     }
@@ -254,6 +395,16 @@ static void test_IProject() {
             IDynamicString_Release(new_str);
         }
         IDynamicString_Release(test_str);
+        
+        // Only the first length bytes of a view are set
+        TaskManager_StringView test_view = {test_string, 4};
+        IProject_Setname_View(obj, test_view);
+        IDynamicString_Handle view_str = IProject_Getname(obj);
+        const char* view_value = view_str ? IDynamicString_GetValue(view_str) : NULL;
+        TEST_ASSERT(view_value && strcmp(view_value, "Test") == 0, "name view setter should copy the view");
+        if (view_str) {
+            IDynamicString_Release(view_str);
+        }
     }
     
     // Test property: description
@@ -278,6 +429,16 @@ static void test_IProject() {
             IDynamicString_Release(new_str);
         }
         IDynamicString_Release(test_str);
+        
+        // Only the first length bytes of a view are set
+        TaskManager_StringView test_view = {test_string, 4};
+        IProject_Setdescription_View(obj, test_view);
+        IDynamicString_Handle view_str = IProject_Getdescription(obj);
+        const char* view_value = view_str ? IDynamicString_GetValue(view_str) : NULL;
+        TEST_ASSERT(view_value && strcmp(view_value, "Test") == 0, "description view setter should copy the view");
+        if (view_str) {
+            IDynamicString_Release(view_str);
+        }
     }
     
     // Test property: active
@@ -285,6 +446,11 @@ static void test_IProject() {
         bool value = IProject_Getactive(obj);
         printf("active initial value: ");
         printf("%s\n", value ? "true" : "false");
+        {
+            bool batch[1];
+            size_t done = IProject_Getactive_Batch(&obj, 1, batch);
+            TEST_ASSERT(done == 1 && batch[0] == value, "active batch getter should match getter");
+        }
         
         // Test setter
         IProject_Setactive(obj, !value);
@@ -317,6 +483,11 @@ static void test_IProject() {
     // Method has parameters or return value - would need specific test values
     printf("DeleteTask - skipping (requires test parameters)\n");
     
+    // Test method: GetTaskSummaries
+    printf("\nTesting method GetTaskSummaries...\n");
+    // Method has parameters or return value - would need specific test values
+    printf("GetTaskSummaries - skipping (requires test parameters)\n");
+    
     // Test method: GetTaskCount
     printf("\nTesting method GetTaskCount...\n");
     // Method has parameters or return value - would need specific test values
@@ -332,9 +503,41 @@ static void test_IProject() {
     // Method has parameters or return value - would need specific test values
     printf("GetTaskCountByStatus - skipping (requires test parameters)\n");
     
-    // Cleanup
-    IProject_Release(obj);
-    printf("Released IProject instance\n");
+    // Test event: TaskCountChanged
+    {
+        uint64_t subscription = IProject_TaskCountChanged_Subscribe(obj, on_IProject_TaskCountChanged, NULL);
+        TEST_ASSERT(subscription != 0, "TaskCountChanged subscribe should succeed");
+        bool removed = IProject_TaskCountChanged_Unsubscribe(obj, subscription);
+        TEST_ASSERT(removed, "TaskCountChanged unsubscribe should remove the callback");
+    }
+    
+    // Test snapshot
+    {
+        IProject_Snapshot_t snapshot;
+        TEST_ASSERT(IProject_Snapshot(obj, &snapshot), "Snapshot should succeed");
+        IProject_Snapshot_Release(&snapshot);
+        TEST_ASSERT(snapshot._storage == NULL, "Snapshot release should clear the snapshot");
+    }
+    
+    // Test stream GetTasks, which keeps the object alive
+    {
+        TaskManagerStream_Handle stream = IProject_GetTasks(obj);
+        TEST_ASSERT(stream != NULL, "GetTasks should return a stream");
+        IProject_Release(obj);
+        printf("Released IProject instance\n");
+
+        ITask_Handle items[16];
+        size_t total = 0;
+        for (;;) {
+            size_t count = TaskManagerStream_Next(stream, items, 16);
+            total += count;
+            if (count < 16) {
+                break;
+            }
+        }
+        printf("GetTasks streamed %zu items after release\n", total);
+        TaskManagerStream_Release(stream);
+    }
 }
 
 // Test ITaskManager interface
@@ -378,8 +581,8 @@ static void test_ITaskManager() {
     
     // Test method: SearchTasks
     printf("\nTesting method SearchTasks...\n");
-    // Method has parameters or return value - would need specific test values
-    printf("SearchTasks - skipping (requires test parameters)\n");
+    // Completes through a callback, possibly after this test has returned
+    printf("SearchTasks - skipping (async)\n");
     
     // Test method: GetTasksByPriority
     printf("\nTesting method GetTasksByPriority...\n");
@@ -403,13 +606,13 @@ static void test_ITaskManager() {
     
     // Test method: Save
     printf("\nTesting method Save...\n");
-    // Method has parameters or return value - would need specific test values
-    printf("Save - skipping (requires test parameters)\n");
+    // Completes through a callback, possibly after this test has returned
+    printf("Save - skipping (async)\n");
     
     // Test method: Load
     printf("\nTesting method Load...\n");
-    // Method has parameters or return value - would need specific test values
-    printf("Load - skipping (requires test parameters)\n");
+    // Completes through a callback, possibly after this test has returned
+    printf("Load - skipping (async)\n");
     
     // Cleanup
     ITaskManager_Release(obj);
@@ -427,6 +630,7 @@ int main(int argc, char* argv[]) {
     test_Priority_values();
     test_Status_values();
     
+    test_TaskSummary_layout();
     test_ITask();
     test_IProject();
     test_ITaskManager();
@@ -441,7 +645,51 @@ int main(int argc, char* argv[]) {
     ITask_Release(NULL);
     error = TaskManager_GetLastError();
     TEST_ASSERT(error && strstr(error, "Null handle") != NULL, "Should report null handle error");
-    
+
+    // Test with a collection too large to allocate
+    {
+        int64_t item = 0;
+        TaskManager_ClearError();
+        TEST_ASSERT(TaskManagerArray_CreateValues(&item, SIZE_MAX / 2, sizeof(item)) == NULL,
+                    "Impossible array size should fail");
+        error = TaskManager_GetLastError();
+        TEST_ASSERT(error && strcmp(error, "Out of memory") == 0, "Should report out of memory");
+    }
+
+    // Test collection marshalling
+    TEST_SECTION("Collections");
+    {
+        TaskManager_StringView names[3] = { {"alpha", 5}, {"", 0}, {"gamma", 5} };
+        TaskManagerArray_Handle strings = TaskManagerArray_CreateStrings(names, 3);
+        TaskManager_StringView views[3];
+        TEST_ASSERT(TaskManagerArray_Count(strings) == 3, "String array should hold all items");
+        TEST_ASSERT(TaskManagerArray_GetItems(strings, 1, 8, views) == 2, "GetItems should stop at the end");
+        TEST_ASSERT(views[0].length == 0 && views[1].length == 5 && strcmp(views[1].data, "gamma") == 0,
+                    "String items should round-trip");
+
+        int32_t numbers[4] = {1, 2, 3, 4};
+        TaskManagerArray_Handle values = TaskManagerArray_CreateValues(numbers, 4, sizeof(int32_t));
+        const int32_t* data = (const int32_t*)TaskManagerArray_Data(values);
+        TEST_ASSERT(data && data[3] == 4, "Value array should expose packed data");
+
+        TaskManagerArray_Handle keys = TaskManagerArray_CreateStrings(names, 3);
+        TaskManagerArray_Handle short_values = TaskManagerArray_CreateValues(numbers, 3, sizeof(int32_t));
+        TaskManagerDict_Handle dict = TaskManagerDict_CreateFromArrays(keys, short_values);
+        const void* key;
+        const void* value;
+        int32_t sum = 0;
+        while (TaskManagerDict_Next(dict, &key, &value)) {
+            sum += *(const int32_t*)value;
+        }
+        TEST_ASSERT(TaskManagerDict_Count(dict) == 3 && sum == 6, "Dictionary should iterate all entries");
+
+        TaskManagerDict_Release(dict);
+        TaskManagerArray_Release(short_values);
+        TaskManagerArray_Release(keys);
+        TaskManagerArray_Release(values);
+        TaskManagerArray_Release(strings);
+    }
+
     // Summary
     printf("\n=== Test Summary ===\n");
     printf("Tests run:    %d\n", tests_run);
@@ -11,6 +11,14 @@
 #include <cstring>
 #include <thread>
 #include <atomic>
+#include <algorithm>
+#include <cstddef>
+#include <limits>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <chrono>
+#include <future>
 
 // Core interfaces
 class IRefCounted {
@@ -58,6 +66,8 @@ public:
             m_value = value;
         }
     }
+
+    DynamicString(const char* value, size_t length) : m_value(value, length) {}
     
     const char* GetValue() const override { 
         return m_value.c_str(); 
@@ -77,11 +87,26 @@ IDynamicString* CreateDynamicString(const char* value = nullptr) {
     return new DynamicString(value);
 }
 
+// Copies all of value, embedded NULs included
+IDynamicString* CreateDynamicString(std::string_view value) {
+    return new DynamicString(value.data(), value.size());
+}
+
 namespace {
-    thread_local std::string g_lastError;
+    // Fixed per-thread buffer: recording an error never allocates, so it
+    // is safe on the out-of-memory path. Longer messages are truncated.
+    constexpr size_t kErrorBufferSize = 256;
+    thread_local char g_lastError[kErrorBufferSize];
     
     void SetError(const char* error) {
-        g_lastError = error ? error : "";
+        size_t length = error ? std::strlen(error) : 0;
+        if (length >= kErrorBufferSize) {
+            length = kErrorBufferSize - 1;
+        }
+        if (length) {
+            std::memcpy(g_lastError, error, length);
+        }
+        g_lastError[length] = '\0';
     }
     
     template<typename T>
@@ -93,26 +118,601 @@ namespace {
     void* PtrToHandle(T* ptr) {
         return static_cast<void*>(ptr);
     }
+
+    // Object handles carry the object's intrusive reference count: a handle
+    // given to C owns one reference, and a handle received from C is
+    // retained for as long as C++ keeps it.
+    template<typename T>
+    void* ObjectToHandle(minimidl::object_ptr<T> ptr) {
+        return PtrToHandle(ptr.detach());
+    }
+
+    template<typename T>
+    minimidl::object_ptr<T> HandleToObject(void* handle) {
+        return minimidl::object_ptr<T>(HandleToPtr<T>(handle));
+    }
+
+    // Releases the first count strings of items and clears them
+    [[maybe_unused]] void ReleaseStrings(IDynamicString_Handle* items, size_t count) noexcept {
+        for (size_t i = 0; i < count; ++i) {
+            HandleToPtr<IDynamicString>(items[i])->Release();
+            items[i] = nullptr;
+        }
+    }
+
+    // Converts a struct between its C and C++ declarations, which share
+    // one layout
+    template<typename To, typename From>
+    To StructCast(const From& from) {
+        static_assert(sizeof(To) == sizeof(From) && std::is_trivially_copyable<To>::value,
+                      "Struct declarations must share one layout");
+        To to;
+        std::memcpy(&to, &from, sizeof(To));
+        return to;
+    }
+
+    // Copies value into snapshot storage at cursor, NUL-terminated, and
+    // returns a view of the copy
+    inline TaskManager_StringView StoreString(char*& cursor, std::string_view value) {
+        std::memcpy(cursor, value.data(), value.size());
+        cursor[value.size()] = '\0';
+        TaskManager_StringView view{cursor, value.size()};
+        cursor += value.size() + 1;
+        return view;
+    }
+
+    // Hands the result of an async method to deliver once future is ready:
+    // right away if it already is, otherwise from a thread that waits for
+    // it. A deferred future runs on that thread.
+    template<typename T, typename Deliver>
+    void WhenReady(std::future<T> future, Deliver deliver) {
+        if (future.wait_for(std::chrono::seconds(0)) == std::future_status::ready) {
+            deliver(future);
+            return;
+        }
+        std::thread([future = std::move(future), deliver = std::move(deliver)]() mutable {
+            future.wait();
+            deliver(future);
+        }).detach();
+    }
+}
+
+static_assert(sizeof(TaskSummary) == sizeof(TaskManager::TaskSummary) &&
+              alignof(TaskSummary) == alignof(TaskManager::TaskSummary) &&
+              offsetof(TaskSummary, priority) == offsetof(TaskManager::TaskSummary, priority) &&
+              offsetof(TaskSummary, status) == offsetof(TaskManager::TaskSummary, status) &&
+              offsetof(TaskSummary, overdue) == offsetof(TaskManager::TaskSummary, overdue) &&
+              offsetof(TaskSummary, id) == offsetof(TaskManager::TaskSummary, id) &&
+              offsetof(TaskSummary, title) == offsetof(TaskManager::TaskSummary, title),
+              "C and C++ layouts of TaskSummary differ");
+
+// Collection marshalling.
+// A collection crossing the C ABI is materialised into one immutable
+// buffer: a header, one column per element role (items, or keys and
+// values) and the packed string bytes, all in a single allocation.
+// Fixed-size elements (primitives, enums, structs, handles) are stored packed so
+// they can be copied in bulk or read in place; strings are stored as an
+// offsets table into NUL-terminated bytes and handed out as string views.
+// Object handles marshalled from C++ hold a reference, dropped together
+// with the buffer; handles in buffers built from C are borrowed.
+namespace marshal {
+
+enum class ColumnKind : uint8_t {
+    Fixed,
+    String,
+};
+
+struct Column {
+    ColumnKind kind = ColumnKind::Fixed;
+    size_t stride = 0;                // Element size as seen by C callers
+    unsigned char* values = nullptr;  // Fixed: count packed elements
+    size_t* offsets = nullptr;        // String: count + 1 offsets into chars
+    char* chars = nullptr;            // String: packed NUL-terminated bytes
+    void (*addRef)(void*) = nullptr;  // Set for columns that own object handles
+    void (*release)(void*) = nullptr;
+};
+
+struct ColumnPlan {
+    ColumnKind kind;
+    size_t stride;
+    size_t charBytes;
+};
+
+constexpr size_t kAlignment = alignof(std::max_align_t);
+
+inline size_t AlignUp(size_t size) {
+    return (size + kAlignment - 1) & ~(kAlignment - 1);
+}
+
+struct CollectionBuffer {
+    size_t bytes = 0;     // Size of the whole allocation
+    size_t count = 0;
+    size_t columnCount = 0;
+    size_t cursor = 0;    // Position of the Next/Reset iteration API
+    Column columns[2];    // Items or keys, then values for dictionaries
+
+    static CollectionBuffer* Create(size_t count, const ColumnPlan* plans, size_t columnCount) {
+        // Counts from C callers are unchecked: a size no allocation could
+        // satisfy is out of memory, rather than a product that wraps around
+        constexpr size_t kMaxColumnBytes = std::numeric_limits<size_t>::max() / 4;
+        size_t bytes = AlignUp(sizeof(CollectionBuffer));
+        for (size_t c = 0; c < columnCount; ++c) {
+            const size_t stride = plans[c].kind == ColumnKind::Fixed ? plans[c].stride : sizeof(size_t);
+            if (count >= kMaxColumnBytes / std::max<size_t>(stride, 1) || plans[c].charBytes >= kMaxColumnBytes) {
+                throw std::bad_array_new_length();
+            }
+            if (plans[c].kind == ColumnKind::Fixed) {
+                bytes += AlignUp(count * plans[c].stride);
+            } else {
+                bytes += AlignUp((count + 1) * sizeof(size_t)) + AlignUp(plans[c].charBytes);
+            }
+        }
+
+        auto* base = static_cast<unsigned char*>(::operator new(bytes));
+        auto* buffer = new (base) CollectionBuffer();
+        buffer->bytes = bytes;
+        buffer->count = count;
+        buffer->columnCount = columnCount;
+
+        unsigned char* cursor = base + AlignUp(sizeof(CollectionBuffer));
+        for (size_t c = 0; c < columnCount; ++c) {
+            Column& column = buffer->columns[c];
+            column.kind = plans[c].kind;
+            column.stride = plans[c].stride;
+            if (column.kind == ColumnKind::Fixed) {
+                column.values = cursor;
+                cursor += AlignUp(count * column.stride);
+            } else {
+                column.offsets = reinterpret_cast<size_t*>(cursor);
+                column.offsets[0] = 0;
+                cursor += AlignUp((count + 1) * sizeof(size_t));
+                column.chars = reinterpret_cast<char*>(cursor);
+                cursor += AlignUp(plans[c].charBytes);
+            }
+        }
+        return buffer;
+    }
+
+    static void Destroy(CollectionBuffer* buffer) {
+        if (!buffer) {
+            return;
+        }
+        for (size_t c = 0; c < buffer->columnCount; ++c) {
+            const Column& column = buffer->columns[c];
+            if (column.release) {
+                auto* handles = reinterpret_cast<void* const*>(column.values);
+                for (size_t i = 0; i < buffer->count; ++i) {
+                    if (handles[i]) {
+                        column.release(handles[i]);
+                    }
+                }
+            }
+        }
+        buffer->~CollectionBuffer();
+        ::operator delete(buffer);
+    }
+
+    // Pointer to element index of a column: the characters for strings,
+    // the packed value otherwise
+    const void* Element(size_t column, size_t index) const {
+        const Column& col = columns[column];
+        if (col.kind == ColumnKind::String) {
+            return col.chars + col.offsets[index];
+        }
+        return col.values + index * col.stride;
+    }
+
+    // Bulk copy of up to n elements starting at start; returns the number copied
+    size_t Copy(size_t column, size_t start, size_t n, void* out) const {
+        if (column >= columnCount || start >= count || !out) {
+            return 0;
+        }
+        n = std::min(n, count - start);
+        const Column& col = columns[column];
+        if (col.kind == ColumnKind::Fixed) {
+            std::memcpy(out, col.values + start * col.stride, n * col.stride);
+        } else {
+            auto* views = static_cast<TaskManager_StringView*>(out);
+            for (size_t i = 0; i < n; ++i) {
+                size_t begin = col.offsets[start + i];
+                views[i].data = col.chars + begin;
+                views[i].length = col.offsets[start + i + 1] - begin - 1;
+            }
+        }
+        return n;
+    }
+};
+
+// How an element type is stored in a column
+template <typename T, typename Enable = void>
+struct ColumnTraits {
+    static_assert(std::is_arithmetic<T>::value, "Unsupported collection element type");
+    using Stored = T;
+    static constexpr ColumnKind kind = ColumnKind::Fixed;
+
+    static size_t CharBytes(const T&) {
+        return 0;
+    }
+
+    static void Put(Column& column, size_t index, size_t&, const T& value) {
+        std::memcpy(column.values + index * sizeof(Stored), &value, sizeof(Stored));
+    }
+
+    static T Get(const Column& column, size_t index) {
+        T value;
+        std::memcpy(&value, column.values + index * sizeof(Stored), sizeof(Stored));
+        return value;
+    }
+};
+
+template <typename T>
+struct ColumnTraits<T, typename std::enable_if<std::is_enum<T>::value>::type> {
+    using Stored = typename std::underlying_type<T>::type;
+    static constexpr ColumnKind kind = ColumnKind::Fixed;
+
+    static size_t CharBytes(const T&) {
+        return 0;
+    }
+
+    static void Put(Column& column, size_t index, size_t& charPos, const T& value) {
+        ColumnTraits<Stored>::Put(column, index, charPos, static_cast<Stored>(value));
+    }
+
+    static T Get(const Column& column, size_t index) {
+        return static_cast<T>(ColumnTraits<Stored>::Get(column, index));
+    }
+};
+
+// Structs are plain data and are packed as they are
+template <typename T>
+struct ColumnTraits<T, typename std::enable_if<std::is_class<T>::value &&
+                                               std::is_trivially_copyable<T>::value>::type> {
+    using Stored = T;
+    static constexpr ColumnKind kind = ColumnKind::Fixed;
+
+    static size_t CharBytes(const T&) {
+        return 0;
+    }
+
+    static void Put(Column& column, size_t index, size_t&, const T& value) {
+        std::memcpy(column.values + index * sizeof(Stored), &value, sizeof(Stored));
+    }
+
+    static T Get(const Column& column, size_t index) {
+        T value;
+        std::memcpy(&value, column.values + index * sizeof(Stored), sizeof(Stored));
+        return value;
+    }
+};
+
+template <typename T>
+struct ColumnTraits<minimidl::object_ptr<T>> {
+    using Stored = void*;
+    static constexpr ColumnKind kind = ColumnKind::Fixed;
+
+    static size_t CharBytes(const minimidl::object_ptr<T>&) {
+        return 0;
+    }
+
+    // The buffer keeps its own reference to every object it holds
+    static void Put(Column& column, size_t index, size_t&, const minimidl::object_ptr<T>& value) {
+        column.addRef = &AddRef;
+        column.release = &Release;
+        minimidl::object_ptr<T> copy = value;
+        void* handle = PtrToHandle(copy.detach());
+        std::memcpy(column.values + index * sizeof(Stored), &handle, sizeof(Stored));
+    }
+
+    static minimidl::object_ptr<T> Get(const Column& column, size_t index) {
+        void* handle = nullptr;
+        std::memcpy(&handle, column.values + index * sizeof(Stored), sizeof(Stored));
+        return minimidl::object_ptr<T>(HandleToPtr<T>(handle));
+    }
+
+    static void AddRef(void* handle) {
+        HandleToPtr<T>(handle)->AddRef();
+    }
+
+    static void Release(void* handle) {
+        HandleToPtr<T>(handle)->Release();
+    }
+};
+
+template <typename A>
+struct ColumnTraits<std::basic_string<char, std::char_traits<char>, A>> {
+    using String = std::basic_string<char, std::char_traits<char>, A>;
+    using Stored = TaskManager_StringView;
+    static constexpr ColumnKind kind = ColumnKind::String;
+
+    static size_t CharBytes(const String& value) {
+        return value.size() + 1;
+    }
+
+    static void Put(Column& column, size_t index, size_t& charPos, const String& value) {
+        std::memcpy(column.chars + charPos, value.data(), value.size());
+        charPos += value.size();
+        column.chars[charPos++] = '\0';
+        column.offsets[index + 1] = charPos;
+    }
+
+    static String Get(const Column& column, size_t index) {
+        size_t begin = column.offsets[index];
+        return String(column.chars + begin, column.offsets[index + 1] - begin - 1);
+    }
+};
+
+template <typename T>
+ColumnPlan PlanFor() {
+    return {ColumnTraits<T>::kind, sizeof(typename ColumnTraits<T>::Stored), 0};
+}
+
+// Arrays and sets: one column
+template <typename Container>
+CollectionBuffer* MarshalItems(const Container& items) {
+    using T = typename Container::value_type;
+    ColumnPlan plan = PlanFor<T>();
+    for (const auto& item : items) {
+        plan.charBytes += ColumnTraits<T>::CharBytes(item);
+    }
+    CollectionBuffer* buffer = CollectionBuffer::Create(items.size(), &plan, 1);
+    size_t index = 0;
+    size_t charPos = 0;
+    for (const auto& item : items) {
+        ColumnTraits<T>::Put(buffer->columns[0], index++, charPos, item);
+    }
+    return buffer;
+}
+
+template <typename Container>
+CollectionBuffer* MarshalItems(const std::shared_ptr<Container>& items) {
+    return items ? MarshalItems(*items) : nullptr;
+}
+
+// Dictionaries: a key column and a value column in iteration order
+template <typename Map>
+CollectionBuffer* MarshalDict(const Map& items) {
+    using K = typename Map::key_type;
+    using V = typename Map::mapped_type;
+    ColumnPlan plans[2] = {PlanFor<K>(), PlanFor<V>()};
+    for (const auto& entry : items) {
+        plans[0].charBytes += ColumnTraits<K>::CharBytes(entry.first);
+        plans[1].charBytes += ColumnTraits<V>::CharBytes(entry.second);
+    }
+    CollectionBuffer* buffer = CollectionBuffer::Create(items.size(), plans, 2);
+    size_t index = 0;
+    size_t keyPos = 0;
+    size_t valuePos = 0;
+    for (const auto& entry : items) {
+        ColumnTraits<K>::Put(buffer->columns[0], index, keyPos, entry.first);
+        ColumnTraits<V>::Put(buffer->columns[1], index, valuePos, entry.second);
+        ++index;
+    }
+    return buffer;
+}
+
+template <typename Map>
+CollectionBuffer* MarshalDict(const std::shared_ptr<Map>& items) {
+    return items ? MarshalDict(*items) : nullptr;
+}
+
+template <typename T>
+void CheckColumn(const CollectionBuffer& buffer, size_t column) {
+    const ColumnPlan plan = PlanFor<T>();
+    if (column >= buffer.columnCount || buffer.columns[column].kind != plan.kind ||
+        buffer.columns[column].stride != plan.stride) {
+        throw std::invalid_argument("Collection element type mismatch");
+    }
+}
+
+// Rebuilds a C++ container from a collection handle
+template <typename Container>
+struct Unmarshaller;
+
+template <typename T, typename A>
+struct Unmarshaller<std::vector<T, A>> {
+    static std::vector<T, A> Read(const CollectionBuffer* buffer) {
+        std::vector<T, A> result;
+        if (!buffer) {
+            return result;
+        }
+        CheckColumn<T>(*buffer, 0);
+        result.reserve(buffer->count);
+        for (size_t i = 0; i < buffer->count; ++i) {
+            result.push_back(ColumnTraits<T>::Get(buffer->columns[0], i));
+        }
+        return result;
+    }
+};
+
+template <typename T, typename H, typename E, typename A>
+struct Unmarshaller<std::unordered_set<T, H, E, A>> {
+    static std::unordered_set<T, H, E, A> Read(const CollectionBuffer* buffer) {
+        std::unordered_set<T, H, E, A> result;
+        if (!buffer) {
+            return result;
+        }
+        CheckColumn<T>(*buffer, 0);
+        result.reserve(buffer->count);
+        for (size_t i = 0; i < buffer->count; ++i) {
+            result.insert(ColumnTraits<T>::Get(buffer->columns[0], i));
+        }
+        return result;
+    }
+};
+
+template <typename K, typename V, typename H, typename E, typename A>
+struct Unmarshaller<std::unordered_map<K, V, H, E, A>> {
+    static std::unordered_map<K, V, H, E, A> Read(const CollectionBuffer* buffer) {
+        std::unordered_map<K, V, H, E, A> result;
+        if (!buffer) {
+            return result;
+        }
+        CheckColumn<K>(*buffer, 0);
+        CheckColumn<V>(*buffer, 1);
+        result.reserve(buffer->count);
+        for (size_t i = 0; i < buffer->count; ++i) {
+            result.insert_or_assign(ColumnTraits<K>::Get(buffer->columns[0], i),
+                                    ColumnTraits<V>::Get(buffer->columns[1], i));
+        }
+        return result;
+    }
+};
+
+template <typename Container>
+struct Unmarshaller<std::shared_ptr<Container>> {
+    static std::shared_ptr<Container> Read(const CollectionBuffer* buffer) {
+        if (!buffer) {
+            return nullptr;
+        }
+        return std::make_shared<Container>(Unmarshaller<Container>::Read(buffer));
+    }
+};
+
+// Collection handle passed as a method argument. Converts to whatever
+// container type the C++ parameter expects.
+struct CollectionArg {
+    void* handle;
+
+    template <typename Container>
+    operator Container() const {
+        return Unmarshaller<Container>::Read(HandleToPtr<CollectionBuffer>(handle));
+    }
+};
+
+// Builds a one-column buffer from C data
+inline CollectionBuffer* FromStrings(const TaskManager_StringView* items, size_t count) {
+    ColumnPlan plan = {ColumnKind::String, sizeof(TaskManager_StringView), 0};
+    for (size_t i = 0; i < count; ++i) {
+        plan.charBytes += items[i].length + 1;
+    }
+    CollectionBuffer* buffer = CollectionBuffer::Create(count, &plan, 1);
+    Column& column = buffer->columns[0];
+    size_t charPos = 0;
+    for (size_t i = 0; i < count; ++i) {
+        if (items[i].length) {
+            std::memcpy(column.chars + charPos, items[i].data, items[i].length);
+        }
+        charPos += items[i].length;
+        column.chars[charPos++] = '\0';
+        column.offsets[i + 1] = charPos;
+    }
+    return buffer;
+}
+
+inline CollectionBuffer* FromValues(const void* items, size_t count, size_t elementSize) {
+    ColumnPlan plan = {ColumnKind::Fixed, elementSize, 0};
+    CollectionBuffer* buffer = CollectionBuffer::Create(count, &plan, 1);
+    if (count) {
+        std::memcpy(buffer->columns[0].values, items, count * elementSize);
+    }
+    return buffer;
+}
+
+// Copies column source of buffer from into column target of buffer to
+inline void CopyColumn(const CollectionBuffer& from, size_t source, CollectionBuffer& to, size_t target) {
+    const Column& src = from.columns[source];
+    Column& dst = to.columns[target];
+    if (src.kind == ColumnKind::Fixed) {
+        if (from.count) {
+            std::memcpy(dst.values, src.values, from.count * src.stride);
+        }
+        if (src.addRef) {
+            // The copy owns references of its own
+            dst.addRef = src.addRef;
+            dst.release = src.release;
+            auto* handles = reinterpret_cast<void* const*>(dst.values);
+            for (size_t i = 0; i < from.count; ++i) {
+                if (handles[i]) {
+                    dst.addRef(handles[i]);
+                }
+            }
+        }
+    } else {
+        std::memcpy(dst.offsets, src.offsets, (from.count + 1) * sizeof(size_t));
+        if (src.offsets[from.count]) {
+            std::memcpy(dst.chars, src.chars, src.offsets[from.count]);
+        }
+    }
+}
+
+inline ColumnPlan PlanOf(const CollectionBuffer& buffer, size_t column) {
+    const Column& col = buffer.columns[column];
+    return {col.kind, col.stride, col.kind == ColumnKind::String ? col.offsets[buffer.count] : 0};
+}
+
+// Object behind a stream handle. Each Next call pulls up to capacity items
+// from the C++ stream and marshals them as one chunk, which owns the
+// strings and object references handed out until the following call. The
+// reader holds a reference to the object that returned the stream, since
+// the stream may read from it after the caller has released its handle.
+struct StreamReader {
+    virtual ~StreamReader() = default;
+    virtual size_t Next(void* items, size_t capacity) = 0;
+};
+
+template <typename T>
+class TypedStreamReader final : public StreamReader {
+public:
+    TypedStreamReader(const minimidl::RefCounted* owner, minimidl::stream<T> source)
+        : m_owner(owner), m_source(std::move(source)) {}
+
+    ~TypedStreamReader() override {
+        CollectionBuffer::Destroy(m_chunk);
+        // Only once the stream is gone
+        m_source = minimidl::stream<T>();
+        m_owner.reset();
+    }
+
+    size_t Next(void* items, size_t capacity) override {
+        CollectionBuffer::Destroy(m_chunk);
+        m_chunk = nullptr;
+        m_items.clear();
+        T item{};
+        while (m_items.size() < capacity && m_source.next(item)) {
+            m_items.push_back(std::move(item));
+        }
+        m_chunk = MarshalItems(m_items);
+        return m_chunk->Copy(0, 0, m_items.size(), items);
+    }
+
+private:
+    minimidl::object_ptr<const minimidl::RefCounted> m_owner;
+    minimidl::stream<T> m_source;
+    std::vector<T> m_items;  // Reused so steady-state chunks do not reallocate
+    CollectionBuffer* m_chunk = nullptr;
+};
+
+template <typename T>
+StreamReader* MakeStreamReader(const minimidl::RefCounted* owner, minimidl::stream<T> source) {
+    return new TypedStreamReader<T>(owner, std::move(source));
 }
 
+} // namespace marshal
+
 // Error handling implementation
 extern "C" {
 
 const char* TaskManager_GetLastError() {
-    return g_lastError.c_str();
+    return g_lastError;
 }
 
 void TaskManager_ClearError() {
-    g_lastError.clear();
+    g_lastError[0] = '\0';
 }
 
 // IDynamicString C API implementation
 IDynamicString_Handle IDynamicString_Create(const char* value) {
     try {
         return PtrToHandle(CreateDynamicString(value));
+    } catch (const std::bad_alloc&) {
+        SetError("Out of memory");
+        return nullptr;
     } catch (const std::exception& e) {
         SetError(e.what());
         return nullptr;
+    } catch (...) {
+        SetError("Unknown exception");
+        return nullptr;
     }
 }
 
@@ -124,8 +724,12 @@ void IDynamicString_AddRef(IDynamicString_Handle handle) {
     try {
         auto* str = HandleToPtr<IDynamicString>(handle);
         str->AddRef();
+    } catch (const std::bad_alloc&) {
+        SetError("Out of memory");
     } catch (const std::exception& e) {
         SetError(e.what());
+    } catch (...) {
+        SetError("Unknown exception");
     }
 }
 
@@ -137,8 +741,12 @@ void IDynamicString_Release(IDynamicString_Handle handle) {
     try {
         auto* str = HandleToPtr<IDynamicString>(handle);
         str->Release();
+    } catch (const std::bad_alloc&) {
+        SetError("Out of memory");
     } catch (const std::exception& e) {
         SetError(e.what());
+    } catch (...) {
+        SetError("Unknown exception");
     }
 }
 
@@ -150,9 +758,15 @@ const char* IDynamicString_GetValue(IDynamicString_Handle handle) {
     try {
         auto* str = HandleToPtr<IDynamicString>(handle);
         return str->GetValue();
+    } catch (const std::bad_alloc&) {
+        SetError("Out of memory");
+        return "";
     } catch (const std::exception& e) {
         SetError(e.what());
         return "";
+    } catch (...) {
+        SetError("Unknown exception");
+        return "";
     }
 }
 
@@ -164,9 +778,15 @@ size_t IDynamicString_GetLength(IDynamicString_Handle handle) {
     try {
         auto* str = HandleToPtr<IDynamicString>(handle);
         return str->GetLength();
+    } catch (const std::bad_alloc&) {
+        SetError("Out of memory");
+        return 0;
     } catch (const std::exception& e) {
         SetError(e.what());
         return 0;
+    } catch (...) {
+        SetError("Unknown exception");
+        return 0;
     }
 }
 
@@ -178,9 +798,61 @@ void IDynamicString_SetValue(IDynamicString_Handle handle, const char* value) {
     try {
         auto* str = HandleToPtr<IDynamicString>(handle);
         str->SetValue(value);
+    } catch (const std::bad_alloc&) {
+        SetError("Out of memory");
     } catch (const std::exception& e) {
         SetError(e.what());
+    } catch (...) {
+        SetError("Unknown exception");
+    }
+}
+
+// Priority enum: tables from minimidl::descriptor<TaskManager::Priority>
+const char* Priority_ToString(Priority value) {
+    // Names are string literals, so they are NUL-terminated
+    auto name = minimidl::enum_name(static_cast<TaskManager::Priority>(value));
+    return name.empty() ? nullptr : name.data();
+}
+
+bool Priority_FromString(const char* name, Priority* out_value) {
+    if (!name || !out_value) {
+        SetError("Null pointer");
+        return false;
+    }
+    auto value = minimidl::enum_from_name<TaskManager::Priority>(name);
+    if (!value) {
+        return false;
     }
+    *out_value = static_cast<Priority>(*value);
+    return true;
+}
+
+bool Priority_IsValid(Priority value) {
+    return minimidl::enum_is_valid<TaskManager::Priority>(value);
+}
+
+// Status enum: tables from minimidl::descriptor<TaskManager::Status>
+const char* Status_ToString(Status value) {
+    // Names are string literals, so they are NUL-terminated
+    auto name = minimidl::enum_name(static_cast<TaskManager::Status>(value));
+    return name.empty() ? nullptr : name.data();
+}
+
+bool Status_FromString(const char* name, Status* out_value) {
+    if (!name || !out_value) {
+        SetError("Null pointer");
+        return false;
+    }
+    auto value = minimidl::enum_from_name<TaskManager::Status>(name);
+    if (!value) {
+        return false;
+    }
+    *out_value = static_cast<Status>(*value);
+    return true;
+}
+
+bool Status_IsValid(Status value) {
+    return minimidl::enum_is_valid<TaskManager::Status>(value);
 }
 
 // ITask implementation
@@ -191,9 +863,15 @@ ITask_Handle ITask_Create() {
         // In practice, you'd need a factory or concrete implementation
         SetError("ITask_Create not implemented - interface requires concrete implementation");
         return nullptr;
+    } catch (const std::bad_alloc&) {
+        SetError("Out of memory");
+        return nullptr;
     } catch (const std::exception& e) {
         SetError(e.what());
         return nullptr;
+    } catch (...) {
+        SetError("Unknown exception");
+        return nullptr;
     }
 }
 
@@ -202,12 +880,8 @@ void ITask_Release(ITask_Handle handle) {
         SetError("Null handle");
         return;
     }
-    try {
-        auto* obj = HandleToPtr<TaskManager::ITask>(handle);
-        delete obj;
-    } catch (const std::exception& e) {
-        SetError(e.what());
-    }
+    // Handles carry the object's own intrusive count
+    HandleToPtr<TaskManager::ITask>(handle)->Release();
 }
 
 void ITask_AddRef(ITask_Handle handle) {
@@ -215,25 +889,27 @@ void ITask_AddRef(ITask_Handle handle) {
         SetError("Null handle");
         return;
     }
-    // Note: This would need proper reference counting implementation
-    // For now, this is a no-op placeholder
+    HandleToPtr<TaskManager::ITask>(handle)->AddRef();
 }
 
 // Property: id
-IDynamicString_Handle ITask_Getid(ITask_Handle handle) {
+TaskManager_Id ITask_Getid(ITask_Handle handle) {
     if (!handle) {
         SetError("Null handle");
-        return nullptr;
+        return {};
     }
     try {
         auto* obj = HandleToPtr<TaskManager::ITask>(handle);
-        std::string result = obj->get_id();
-        // Create new IDynamicString with refcount=1
-        IDynamicString* str = CreateDynamicString(result.c_str());
-        return PtrToHandle(str);
+        return obj->get_id();
+    } catch (const std::bad_alloc&) {
+        SetError("Out of memory");
+        return {};
     } catch (const std::exception& e) {
         SetError(e.what());
-        return nullptr;
+        return {};
+    } catch (...) {
+        SetError("Unknown exception");
+        return {};
     }
 }
 
@@ -246,13 +922,19 @@ IDynamicString_Handle ITask_Gettitle(ITask_Handle handle) {
     }
     try {
         auto* obj = HandleToPtr<TaskManager::ITask>(handle);
-        std::string result = obj->get_title();
+        const auto& result = obj->get_title();
         // Create new IDynamicString with refcount=1
-        IDynamicString* str = CreateDynamicString(result.c_str());
+        IDynamicString* str = CreateDynamicString(result);
         return PtrToHandle(str);
+    } catch (const std::bad_alloc&) {
+        SetError("Out of memory");
+        return nullptr;
     } catch (const std::exception& e) {
         SetError(e.what());
         return nullptr;
+    } catch (...) {
+        SetError("Unknown exception");
+        return nullptr;
     }
 }
 
@@ -265,13 +947,19 @@ IDynamicString_Handle ITask_Getcreated_at(ITask_Handle handle) {
     }
     try {
         auto* obj = HandleToPtr<TaskManager::ITask>(handle);
-        std::string result = obj->get_created_at();
+        const auto& result = obj->get_created_at();
         // Create new IDynamicString with refcount=1
-        IDynamicString* str = CreateDynamicString(result.c_str());
+        IDynamicString* str = CreateDynamicString(result);
         return PtrToHandle(str);
+    } catch (const std::bad_alloc&) {
+        SetError("Out of memory");
+        return nullptr;
     } catch (const std::exception& e) {
         SetError(e.what());
         return nullptr;
+    } catch (...) {
+        SetError("Unknown exception");
+        return nullptr;
     }
 }
 
@@ -284,13 +972,19 @@ IDynamicString_Handle ITask_Getdescription(ITask_Handle handle) {
     }
     try {
         auto* obj = HandleToPtr<TaskManager::ITask>(handle);
-        std::string result = obj->get_description();
+        const auto& result = obj->get_description();
         // Create new IDynamicString with refcount=1
-        IDynamicString* str = CreateDynamicString(result.c_str());
+        IDynamicString* str = CreateDynamicString(result);
         return PtrToHandle(str);
+    } catch (const std::bad_alloc&) {
+        SetError("Out of memory");
+        return nullptr;
     } catch (const std::exception& e) {
         SetError(e.what());
         return nullptr;
+    } catch (...) {
+        SetError("Unknown exception");
+        return nullptr;
     }
 }
 
@@ -307,8 +1001,35 @@ void ITask_Setdescription(ITask_Handle handle, IDynamicString_Handle value) {
         auto* obj = HandleToPtr<TaskManager::ITask>(handle);
         auto* str = HandleToPtr<IDynamicString>(value);
         obj->set_description(str->GetValue());
+    } catch (const std::bad_alloc&) {
+        SetError("Out of memory");
     } catch (const std::exception& e) {
         SetError(e.what());
+    } catch (...) {
+        SetError("Unknown exception");
+    }
+}
+
+void ITask_Setdescription_View(ITask_Handle handle, TaskManager_StringView value) {
+    if (!handle) {
+        SetError("Null handle");
+        return;
+    }
+    if (!value.data && value.length) {
+        SetError("Null value");
+        return;
+    }
+    try {
+        auto* obj = HandleToPtr<TaskManager::ITask>(handle);
+        // Built with the length, so the bytes are copied once and never scanned
+        using Value = std::decay_t<decltype(obj->get_description())>;
+        obj->set_description(Value(value.length ? value.data : "", value.length));
+    } catch (const std::bad_alloc&) {
+        SetError("Out of memory");
+    } catch (const std::exception& e) {
+        SetError(e.what());
+    } catch (...) {
+        SetError("Unknown exception");
     }
 }
 
@@ -321,9 +1042,15 @@ Priority ITask_Getpriority(ITask_Handle handle) {
     try {
         auto* obj = HandleToPtr<TaskManager::ITask>(handle);
         return static_cast<Priority>(obj->get_priority());
+    } catch (const std::bad_alloc&) {
+        SetError("Out of memory");
+        return {};
     } catch (const std::exception& e) {
         SetError(e.what());
         return {};
+    } catch (...) {
+        SetError("Unknown exception");
+        return {};
     }
 }
 
@@ -332,11 +1059,19 @@ void ITask_Setpriority(ITask_Handle handle, Priority value) {
         SetError("Null handle");
         return;
     }
+    if (!minimidl::enum_is_valid<TaskManager::Priority>(value)) {
+        SetError("Invalid Priority value");
+        return;
+    }
     try {
         auto* obj = HandleToPtr<TaskManager::ITask>(handle);
         obj->set_priority(static_cast<TaskManager::Priority>(value));
+    } catch (const std::bad_alloc&) {
+        SetError("Out of memory");
     } catch (const std::exception& e) {
         SetError(e.what());
+    } catch (...) {
+        SetError("Unknown exception");
     }
 }
 
@@ -349,9 +1084,15 @@ Status ITask_Getstatus(ITask_Handle handle) {
     try {
         auto* obj = HandleToPtr<TaskManager::ITask>(handle);
         return static_cast<Status>(obj->get_status());
+    } catch (const std::bad_alloc&) {
+        SetError("Out of memory");
+        return {};
     } catch (const std::exception& e) {
         SetError(e.what());
         return {};
+    } catch (...) {
+        SetError("Unknown exception");
+        return {};
     }
 }
 
@@ -360,11 +1101,19 @@ void ITask_Setstatus(ITask_Handle handle, Status value) {
         SetError("Null handle");
         return;
     }
+    if (!minimidl::enum_is_valid<TaskManager::Status>(value)) {
+        SetError("Invalid Status value");
+        return;
+    }
     try {
         auto* obj = HandleToPtr<TaskManager::ITask>(handle);
         obj->set_status(static_cast<TaskManager::Status>(value));
+    } catch (const std::bad_alloc&) {
+        SetError("Out of memory");
     } catch (const std::exception& e) {
         SetError(e.what());
+    } catch (...) {
+        SetError("Unknown exception");
     }
 }
 
@@ -376,13 +1125,19 @@ IDynamicString_Handle ITask_Getdue_date(ITask_Handle handle) {
     }
     try {
         auto* obj = HandleToPtr<TaskManager::ITask>(handle);
-        std::string result = obj->get_due_date();
+        const auto& result = obj->get_due_date();
         // Create new IDynamicString with refcount=1
-        IDynamicString* str = CreateDynamicString(result.c_str());
+        IDynamicString* str = CreateDynamicString(result);
         return PtrToHandle(str);
+    } catch (const std::bad_alloc&) {
+        SetError("Out of memory");
+        return nullptr;
     } catch (const std::exception& e) {
         SetError(e.what());
         return nullptr;
+    } catch (...) {
+        SetError("Unknown exception");
+        return nullptr;
     }
 }
 
@@ -399,8 +1154,35 @@ void ITask_Setdue_date(ITask_Handle handle, IDynamicString_Handle value) {
         auto* obj = HandleToPtr<TaskManager::ITask>(handle);
         auto* str = HandleToPtr<IDynamicString>(value);
         obj->set_due_date(str->GetValue());
+    } catch (const std::bad_alloc&) {
+        SetError("Out of memory");
+    } catch (const std::exception& e) {
+        SetError(e.what());
+    } catch (...) {
+        SetError("Unknown exception");
+    }
+}
+
+void ITask_Setdue_date_View(ITask_Handle handle, TaskManager_StringView value) {
+    if (!handle) {
+        SetError("Null handle");
+        return;
+    }
+    if (!value.data && value.length) {
+        SetError("Null value");
+        return;
+    }
+    try {
+        auto* obj = HandleToPtr<TaskManager::ITask>(handle);
+        // Built with the length, so the bytes are copied once and never scanned
+        using Value = std::decay_t<decltype(obj->get_due_date())>;
+        obj->set_due_date(Value(value.length ? value.data : "", value.length));
+    } catch (const std::bad_alloc&) {
+        SetError("Out of memory");
     } catch (const std::exception& e) {
         SetError(e.what());
+    } catch (...) {
+        SetError("Unknown exception");
     }
 }
 
@@ -413,9 +1195,15 @@ size_t ITask_Gettags_Count(ITask_Handle handle) {
     try {
         auto* obj = HandleToPtr<TaskManager::ITask>(handle);
         return obj->get_tags().size();
+    } catch (const std::bad_alloc&) {
+        SetError("Out of memory");
+        return 0;
     } catch (const std::exception& e) {
         SetError(e.what());
         return 0;
+    } catch (...) {
+        SetError("Unknown exception");
+        return 0;
     }
 }
 
@@ -431,25 +1219,69 @@ IDynamicString_Handle ITask_Gettags_Item(ITask_Handle handle, size_t index) {
             SetError("Index out of bounds");
             return {};
         }
-        std::string str = array[index];
-        IDynamicString* dynStr = CreateDynamicString(str.c_str());
+        const auto& str = array[index];
+        IDynamicString* dynStr = CreateDynamicString(str);
         return PtrToHandle(dynStr);
+    } catch (const std::bad_alloc&) {
+        SetError("Out of memory");
+        return {};
     } catch (const std::exception& e) {
         SetError(e.what());
         return {};
+    } catch (...) {
+        SetError("Unknown exception");
+        return {};
     }
 }
 
-void ITask_Settags_Clear(ITask_Handle handle) {
+size_t ITask_Gettags_GetAll(ITask_Handle handle, IDynamicString_Handle* items, size_t capacity) {
     if (!handle) {
         SetError("Null handle");
-        return;
+        return 0;
     }
+    // A failed copy reports no items, so the strings already made are released
+    size_t copied = 0;
     try {
         auto* obj = HandleToPtr<TaskManager::ITask>(handle);
-        obj->set_tags({});
-    } catch (const std::exception& e) {
-        SetError(e.what());
+        const auto array = obj->get_tags();
+        size_t n = std::min(capacity, array.size());
+        if (n && !items) {
+            SetError("Null items");
+            return 0;
+        }
+        for (; copied < n; ++copied) {
+            items[copied] = PtrToHandle(CreateDynamicString(array[copied]));
+        }
+        return array.size();
+    } catch (const std::bad_alloc&) {
+        ReleaseStrings(items, copied);
+        SetError("Out of memory");
+        return 0;
+    } catch (const std::exception& e) {
+        ReleaseStrings(items, copied);
+        SetError(e.what());
+        return 0;
+    } catch (...) {
+        ReleaseStrings(items, copied);
+        SetError("Unknown exception");
+        return 0;
+    }
+}
+
+void ITask_Settags_Clear(ITask_Handle handle) {
+    if (!handle) {
+        SetError("Null handle");
+        return;
+    }
+    try {
+        auto* obj = HandleToPtr<TaskManager::ITask>(handle);
+        obj->set_tags({});
+    } catch (const std::bad_alloc&) {
+        SetError("Out of memory");
+    } catch (const std::exception& e) {
+        SetError(e.what());
+    } catch (...) {
+        SetError("Unknown exception");
     }
 }
 
@@ -467,9 +1299,39 @@ void ITask_Settags_Add(ITask_Handle handle, IDynamicString_Handle value) {
         auto array = obj->get_tags();
         auto* str = HandleToPtr<IDynamicString>(value);
         array.push_back(str->GetValue());
-        obj->set_tags(array);
+        obj->set_tags(std::move(array));
+    } catch (const std::bad_alloc&) {
+        SetError("Out of memory");
     } catch (const std::exception& e) {
         SetError(e.what());
+    } catch (...) {
+        SetError("Unknown exception");
+    }
+}
+
+void ITask_Settags_SetAll(ITask_Handle handle, const TaskManager_StringView* items, size_t count) {
+    if (!handle) {
+        SetError("Null handle");
+        return;
+    }
+    if (!items && count) {
+        SetError("Null items");
+        return;
+    }
+    try {
+        auto* obj = HandleToPtr<TaskManager::ITask>(handle);
+        decltype(obj->get_tags()) array;
+        array.reserve(count);
+        for (size_t i = 0; i < count; ++i) {
+            array.emplace_back(items[i].length ? items[i].data : "", items[i].length);
+        }
+        obj->set_tags(std::move(array));
+    } catch (const std::bad_alloc&) {
+        SetError("Out of memory");
+    } catch (const std::exception& e) {
+        SetError(e.what());
+    } catch (...) {
+        SetError("Unknown exception");
     }
 }
 
@@ -482,10 +1344,13 @@ void ITask_Complete(
     }
     try {
         auto* obj = HandleToPtr<TaskManager::ITask>(handle);
-        obj->Complete(
-);
+        obj->Complete();
+    } catch (const std::bad_alloc&) {
+        SetError("Out of memory");
     } catch (const std::exception& e) {
         SetError(e.what());
+    } catch (...) {
+        SetError("Unknown exception");
     }
 }
 
@@ -498,10 +1363,13 @@ void ITask_Cancel(
     }
     try {
         auto* obj = HandleToPtr<TaskManager::ITask>(handle);
-        obj->Cancel(
-);
+        obj->Cancel();
+    } catch (const std::bad_alloc&) {
+        SetError("Out of memory");
     } catch (const std::exception& e) {
         SetError(e.what());
+    } catch (...) {
+        SetError("Unknown exception");
     }
 }
 
@@ -514,12 +1382,17 @@ bool ITask_IsOverdue(
     }
     try {
         auto* obj = HandleToPtr<TaskManager::ITask>(handle);
-        auto result = obj->IsOverdue(
-);
+        auto result = obj->IsOverdue();
         return result;
+    } catch (const std::bad_alloc&) {
+        SetError("Out of memory");
+        return {};
     } catch (const std::exception& e) {
         SetError(e.what());
         return {};
+    } catch (...) {
+        SetError("Unknown exception");
+        return {};
     }
 }
 
@@ -532,12 +1405,17 @@ TaskManagerDict_Handle ITask_GetMetadata(
     }
     try {
         auto* obj = HandleToPtr<TaskManager::ITask>(handle);
-        auto result = obj->GetMetadata(
-);
-        return result;
+        auto result = obj->GetMetadata();
+        return PtrToHandle(marshal::MarshalDict(result));
+    } catch (const std::bad_alloc&) {
+        SetError("Out of memory");
+        return {};
     } catch (const std::exception& e) {
         SetError(e.what());
         return {};
+    } catch (...) {
+        SetError("Unknown exception");
+        return {};
     }
 }
 
@@ -550,13 +1428,306 @@ void ITask_SetMetadata(
     }
     try {
         auto* obj = HandleToPtr<TaskManager::ITask>(handle);
-        obj->SetMetadata(
-HandleToPtr<IDynamicString>(key)->GetValue(), HandleToPtr<IDynamicString>(value)->GetValue());
+        obj->SetMetadata(HandleToPtr<IDynamicString>(key)->GetValue(), HandleToPtr<IDynamicString>(value)->GetValue());
+    } catch (const std::bad_alloc&) {
+        SetError("Out of memory");
     } catch (const std::exception& e) {
         SetError(e.what());
+    } catch (...) {
+        SetError("Unknown exception");
     }
 }
 
+// Snapshot
+void ITask_Snapshot_Release(ITask_Snapshot_t* snapshot) {
+    if (!snapshot) {
+        return;
+    }
+    TaskManagerArray_Release(snapshot->tags);
+    ::operator delete(snapshot->_storage);
+    *snapshot = {};
+}
+
+bool ITask_Snapshot(ITask_Handle handle, ITask_Snapshot_t* out) {
+    if (!out) {
+        SetError("Null output");
+        return false;
+    }
+    *out = {};
+    if (!handle) {
+        SetError("Null handle");
+        return false;
+    }
+
+    // Filled in place so a failing getter can release what was captured
+    ITask_Snapshot_t snapshot{};
+    try {
+        auto* obj = HandleToPtr<TaskManager::ITask>(handle);
+        // All strings share one allocation
+        const auto& titleValue = obj->get_title();
+        const auto& created_atValue = obj->get_created_at();
+        const auto& descriptionValue = obj->get_description();
+        const auto& due_dateValue = obj->get_due_date();
+        char* cursor = static_cast<char*>(::operator new(titleValue.size() + 1 + created_atValue.size() + 1 + descriptionValue.size() + 1 + due_dateValue.size() + 1));
+        snapshot._storage = cursor;
+        snapshot.id = obj->get_id();
+        snapshot.title = StoreString(cursor, titleValue);
+        snapshot.created_at = StoreString(cursor, created_atValue);
+        snapshot.description = StoreString(cursor, descriptionValue);
+        snapshot.priority = static_cast<Priority>(obj->get_priority());
+        snapshot.status = static_cast<Status>(obj->get_status());
+        snapshot.due_date = StoreString(cursor, due_dateValue);
+        snapshot.tags = PtrToHandle(marshal::MarshalItems(obj->get_tags()));
+        *out = snapshot;
+        return true;
+    } catch (const std::bad_alloc&) {
+        ITask_Snapshot_Release(&snapshot);
+        SetError("Out of memory");
+        return false;
+    } catch (const std::exception& e) {
+        ITask_Snapshot_Release(&snapshot);
+        SetError(e.what());
+        return false;
+    } catch (...) {
+        ITask_Snapshot_Release(&snapshot);
+        SetError("Unknown exception");
+        return false;
+    }
+}
+
+// Batch calls: one loop, one exception handler
+size_t ITask_Getid_Batch(const ITask_Handle* handles, size_t count, TaskManager_Id* values) {
+    if (count && (!handles || !values)) {
+        SetError("Null array");
+        return 0;
+    }
+    size_t done = 0;
+    try {
+        for (; done < count; ++done) {
+            if (!handles[done]) {
+                SetError("Null handle");
+                return done;
+            }
+            auto* obj = HandleToPtr<TaskManager::ITask>(handles[done]);
+            values[done] = obj->get_id();
+        }
+    } catch (const std::bad_alloc&) {
+        SetError("Out of memory");
+        return done;
+    } catch (const std::exception& e) {
+        SetError(e.what());
+        return done;
+    } catch (...) {
+        SetError("Unknown exception");
+        return done;
+    }
+    return done;
+}
+
+size_t ITask_Getpriority_Batch(const ITask_Handle* handles, size_t count, Priority* values) {
+    if (count && (!handles || !values)) {
+        SetError("Null array");
+        return 0;
+    }
+    size_t done = 0;
+    try {
+        for (; done < count; ++done) {
+            if (!handles[done]) {
+                SetError("Null handle");
+                return done;
+            }
+            auto* obj = HandleToPtr<TaskManager::ITask>(handles[done]);
+            values[done] = static_cast<Priority>(obj->get_priority());
+        }
+    } catch (const std::bad_alloc&) {
+        SetError("Out of memory");
+        return done;
+    } catch (const std::exception& e) {
+        SetError(e.what());
+        return done;
+    } catch (...) {
+        SetError("Unknown exception");
+        return done;
+    }
+    return done;
+}
+
+size_t ITask_Setpriority_Batch(const ITask_Handle* handles, size_t count, const Priority* values) {
+    if (count && (!handles || !values)) {
+        SetError("Null array");
+        return 0;
+    }
+    size_t done = 0;
+    try {
+        for (; done < count; ++done) {
+            if (!handles[done]) {
+                SetError("Null handle");
+                return done;
+            }
+            if (!minimidl::enum_is_valid<TaskManager::Priority>(values[done])) {
+                SetError("Invalid Priority value");
+                return done;
+            }
+            auto* obj = HandleToPtr<TaskManager::ITask>(handles[done]);
+            obj->set_priority(static_cast<TaskManager::Priority>(values[done]));
+        }
+    } catch (const std::bad_alloc&) {
+        SetError("Out of memory");
+        return done;
+    } catch (const std::exception& e) {
+        SetError(e.what());
+        return done;
+    } catch (...) {
+        SetError("Unknown exception");
+        return done;
+    }
+    return done;
+}
+
+size_t ITask_Getstatus_Batch(const ITask_Handle* handles, size_t count, Status* values) {
+    if (count && (!handles || !values)) {
+        SetError("Null array");
+        return 0;
+    }
+    size_t done = 0;
+    try {
+        for (; done < count; ++done) {
+            if (!handles[done]) {
+                SetError("Null handle");
+                return done;
+            }
+            auto* obj = HandleToPtr<TaskManager::ITask>(handles[done]);
+            values[done] = static_cast<Status>(obj->get_status());
+        }
+    } catch (const std::bad_alloc&) {
+        SetError("Out of memory");
+        return done;
+    } catch (const std::exception& e) {
+        SetError(e.what());
+        return done;
+    } catch (...) {
+        SetError("Unknown exception");
+        return done;
+    }
+    return done;
+}
+
+size_t ITask_Setstatus_Batch(const ITask_Handle* handles, size_t count, const Status* values) {
+    if (count && (!handles || !values)) {
+        SetError("Null array");
+        return 0;
+    }
+    size_t done = 0;
+    try {
+        for (; done < count; ++done) {
+            if (!handles[done]) {
+                SetError("Null handle");
+                return done;
+            }
+            if (!minimidl::enum_is_valid<TaskManager::Status>(values[done])) {
+                SetError("Invalid Status value");
+                return done;
+            }
+            auto* obj = HandleToPtr<TaskManager::ITask>(handles[done]);
+            obj->set_status(static_cast<TaskManager::Status>(values[done]));
+        }
+    } catch (const std::bad_alloc&) {
+        SetError("Out of memory");
+        return done;
+    } catch (const std::exception& e) {
+        SetError(e.what());
+        return done;
+    } catch (...) {
+        SetError("Unknown exception");
+        return done;
+    }
+    return done;
+}
+
+size_t ITask_Complete_Batch(const ITask_Handle* handles, size_t count) {
+    if (count && (!handles)) {
+        SetError("Null array");
+        return 0;
+    }
+    size_t done = 0;
+    try {
+        for (; done < count; ++done) {
+            if (!handles[done]) {
+                SetError("Null handle");
+                return done;
+            }
+            auto* obj = HandleToPtr<TaskManager::ITask>(handles[done]);
+            obj->Complete();
+        }
+    } catch (const std::bad_alloc&) {
+        SetError("Out of memory");
+        return done;
+    } catch (const std::exception& e) {
+        SetError(e.what());
+        return done;
+    } catch (...) {
+        SetError("Unknown exception");
+        return done;
+    }
+    return done;
+}
+
+size_t ITask_Cancel_Batch(const ITask_Handle* handles, size_t count) {
+    if (count && (!handles)) {
+        SetError("Null array");
+        return 0;
+    }
+    size_t done = 0;
+    try {
+        for (; done < count; ++done) {
+            if (!handles[done]) {
+                SetError("Null handle");
+                return done;
+            }
+            auto* obj = HandleToPtr<TaskManager::ITask>(handles[done]);
+            obj->Cancel();
+        }
+    } catch (const std::bad_alloc&) {
+        SetError("Out of memory");
+        return done;
+    } catch (const std::exception& e) {
+        SetError(e.what());
+        return done;
+    } catch (...) {
+        SetError("Unknown exception");
+        return done;
+    }
+    return done;
+}
+
+size_t ITask_IsOverdue_Batch(const ITask_Handle* handles, size_t count, bool* results) {
+    if (count && (!handles || !results)) {
+        SetError("Null array");
+        return 0;
+    }
+    size_t done = 0;
+    try {
+        for (; done < count; ++done) {
+            if (!handles[done]) {
+                SetError("Null handle");
+                return done;
+            }
+            auto* obj = HandleToPtr<TaskManager::ITask>(handles[done]);
+            results[done] = obj->IsOverdue();
+        }
+    } catch (const std::bad_alloc&) {
+        SetError("Out of memory");
+        return done;
+    } catch (const std::exception& e) {
+        SetError(e.what());
+        return done;
+    } catch (...) {
+        SetError("Unknown exception");
+        return done;
+    }
+    return done;
+}
+
 // IProject implementation
 
 IProject_Handle IProject_Create() {
@@ -565,9 +1736,15 @@ IProject_Handle IProject_Create() {
         // In practice, you'd need a factory or concrete implementation
         SetError("IProject_Create not implemented - interface requires concrete implementation");
         return nullptr;
+    } catch (const std::bad_alloc&) {
+        SetError("Out of memory");
+        return nullptr;
     } catch (const std::exception& e) {
         SetError(e.what());
         return nullptr;
+    } catch (...) {
+        SetError("Unknown exception");
+        return nullptr;
     }
 }
 
@@ -576,12 +1753,8 @@ void IProject_Release(IProject_Handle handle) {
         SetError("Null handle");
         return;
     }
-    try {
-        auto* obj = HandleToPtr<TaskManager::IProject>(handle);
-        delete obj;
-    } catch (const std::exception& e) {
-        SetError(e.what());
-    }
+    // Handles carry the object's own intrusive count
+    HandleToPtr<TaskManager::IProject>(handle)->Release();
 }
 
 void IProject_AddRef(IProject_Handle handle) {
@@ -589,25 +1762,27 @@ void IProject_AddRef(IProject_Handle handle) {
         SetError("Null handle");
         return;
     }
-    // Note: This would need proper reference counting implementation
-    // For now, this is a no-op placeholder
+    HandleToPtr<TaskManager::IProject>(handle)->AddRef();
 }
 
 // Property: id
-IDynamicString_Handle IProject_Getid(IProject_Handle handle) {
+TaskManager_Id IProject_Getid(IProject_Handle handle) {
     if (!handle) {
         SetError("Null handle");
-        return nullptr;
+        return {};
     }
     try {
         auto* obj = HandleToPtr<TaskManager::IProject>(handle);
-        std::string result = obj->get_id();
-        // Create new IDynamicString with refcount=1
-        IDynamicString* str = CreateDynamicString(result.c_str());
-        return PtrToHandle(str);
+        return obj->get_id();
+    } catch (const std::bad_alloc&) {
+        SetError("Out of memory");
+        return {};
     } catch (const std::exception& e) {
         SetError(e.what());
-        return nullptr;
+        return {};
+    } catch (...) {
+        SetError("Unknown exception");
+        return {};
     }
 }
 
@@ -620,13 +1795,19 @@ IDynamicString_Handle IProject_Getname(IProject_Handle handle) {
     }
     try {
         auto* obj = HandleToPtr<TaskManager::IProject>(handle);
-        std::string result = obj->get_name();
+        const auto& result = obj->get_name();
         // Create new IDynamicString with refcount=1
-        IDynamicString* str = CreateDynamicString(result.c_str());
+        IDynamicString* str = CreateDynamicString(result);
         return PtrToHandle(str);
+    } catch (const std::bad_alloc&) {
+        SetError("Out of memory");
+        return nullptr;
     } catch (const std::exception& e) {
         SetError(e.what());
         return nullptr;
+    } catch (...) {
+        SetError("Unknown exception");
+        return nullptr;
     }
 }
 
@@ -643,8 +1824,35 @@ void IProject_Setname(IProject_Handle handle, IDynamicString_Handle value) {
         auto* obj = HandleToPtr<TaskManager::IProject>(handle);
         auto* str = HandleToPtr<IDynamicString>(value);
         obj->set_name(str->GetValue());
+    } catch (const std::bad_alloc&) {
+        SetError("Out of memory");
+    } catch (const std::exception& e) {
+        SetError(e.what());
+    } catch (...) {
+        SetError("Unknown exception");
+    }
+}
+
+void IProject_Setname_View(IProject_Handle handle, TaskManager_StringView value) {
+    if (!handle) {
+        SetError("Null handle");
+        return;
+    }
+    if (!value.data && value.length) {
+        SetError("Null value");
+        return;
+    }
+    try {
+        auto* obj = HandleToPtr<TaskManager::IProject>(handle);
+        // Built with the length, so the bytes are copied once and never scanned
+        using Value = std::decay_t<decltype(obj->get_name())>;
+        obj->set_name(Value(value.length ? value.data : "", value.length));
+    } catch (const std::bad_alloc&) {
+        SetError("Out of memory");
     } catch (const std::exception& e) {
         SetError(e.what());
+    } catch (...) {
+        SetError("Unknown exception");
     }
 }
 
@@ -656,13 +1864,19 @@ IDynamicString_Handle IProject_Getdescription(IProject_Handle handle) {
     }
     try {
         auto* obj = HandleToPtr<TaskManager::IProject>(handle);
-        std::string result = obj->get_description();
+        const auto& result = obj->get_description();
         // Create new IDynamicString with refcount=1
-        IDynamicString* str = CreateDynamicString(result.c_str());
+        IDynamicString* str = CreateDynamicString(result);
         return PtrToHandle(str);
+    } catch (const std::bad_alloc&) {
+        SetError("Out of memory");
+        return nullptr;
     } catch (const std::exception& e) {
         SetError(e.what());
         return nullptr;
+    } catch (...) {
+        SetError("Unknown exception");
+        return nullptr;
     }
 }
 
@@ -679,8 +1893,35 @@ void IProject_Setdescription(IProject_Handle handle, IDynamicString_Handle value
         auto* obj = HandleToPtr<TaskManager::IProject>(handle);
         auto* str = HandleToPtr<IDynamicString>(value);
         obj->set_description(str->GetValue());
+    } catch (const std::bad_alloc&) {
+        SetError("Out of memory");
     } catch (const std::exception& e) {
         SetError(e.what());
+    } catch (...) {
+        SetError("Unknown exception");
+    }
+}
+
+void IProject_Setdescription_View(IProject_Handle handle, TaskManager_StringView value) {
+    if (!handle) {
+        SetError("Null handle");
+        return;
+    }
+    if (!value.data && value.length) {
+        SetError("Null value");
+        return;
+    }
+    try {
+        auto* obj = HandleToPtr<TaskManager::IProject>(handle);
+        // Built with the length, so the bytes are copied once and never scanned
+        using Value = std::decay_t<decltype(obj->get_description())>;
+        obj->set_description(Value(value.length ? value.data : "", value.length));
+    } catch (const std::bad_alloc&) {
+        SetError("Out of memory");
+    } catch (const std::exception& e) {
+        SetError(e.what());
+    } catch (...) {
+        SetError("Unknown exception");
     }
 }
 
@@ -693,9 +1934,15 @@ bool IProject_Getactive(IProject_Handle handle) {
     try {
         auto* obj = HandleToPtr<TaskManager::IProject>(handle);
         return obj->get_active();
+    } catch (const std::bad_alloc&) {
+        SetError("Out of memory");
+        return {};
     } catch (const std::exception& e) {
         SetError(e.what());
         return {};
+    } catch (...) {
+        SetError("Unknown exception");
+        return {};
     }
 }
 
@@ -707,8 +1954,12 @@ void IProject_Setactive(IProject_Handle handle, bool value) {
     try {
         auto* obj = HandleToPtr<TaskManager::IProject>(handle);
         obj->set_active(value);
+    } catch (const std::bad_alloc&) {
+        SetError("Out of memory");
     } catch (const std::exception& e) {
         SetError(e.what());
+    } catch (...) {
+        SetError("Unknown exception");
     }
 }
 
@@ -721,35 +1972,45 @@ ITask_Handle IProject_CreateTask(
     }
     try {
         auto* obj = HandleToPtr<TaskManager::IProject>(handle);
-        auto result = obj->CreateTask(
-HandleToPtr<IDynamicString>(title)->GetValue(), HandleToPtr<IDynamicString>(description)->GetValue());
-        return PtrToHandle(result.get());
+        auto result = obj->CreateTask(HandleToPtr<IDynamicString>(title)->GetValue(), HandleToPtr<IDynamicString>(description)->GetValue());
+        return ObjectToHandle(std::move(result));
+    } catch (const std::bad_alloc&) {
+        SetError("Out of memory");
+        return {};
     } catch (const std::exception& e) {
         SetError(e.what());
         return {};
+    } catch (...) {
+        SetError("Unknown exception");
+        return {};
     }
 }
 
 // Method: GetTask
 ITask_Handle IProject_GetTask(
-    IProject_Handle handle, IDynamicString_Handle taskId) {
+    IProject_Handle handle, TaskManager_Id taskId) {
     if (!handle) {
         SetError("Null handle");
         return {};
     }
     try {
         auto* obj = HandleToPtr<TaskManager::IProject>(handle);
-        auto result = obj->GetTask(
-HandleToPtr<IDynamicString>(taskId)->GetValue());
-        return PtrToHandle(result.get());
+        auto result = obj->GetTask(taskId);
+        return ObjectToHandle(std::move(result));
+    } catch (const std::bad_alloc&) {
+        SetError("Out of memory");
+        return {};
     } catch (const std::exception& e) {
         SetError(e.what());
         return {};
+    } catch (...) {
+        SetError("Unknown exception");
+        return {};
     }
 }
 
 // Method: GetTasks
-TaskManagerArray_Handle IProject_GetTasks(
+TaskManagerStream_Handle IProject_GetTasks(
     IProject_Handle handle) {
     if (!handle) {
         SetError("Null handle");
@@ -757,48 +2018,90 @@ TaskManagerArray_Handle IProject_GetTasks(
     }
     try {
         auto* obj = HandleToPtr<TaskManager::IProject>(handle);
-        auto result = obj->GetTasks(
-);
-        return result;
+        auto result = obj->GetTasks();
+        return PtrToHandle(marshal::MakeStreamReader(obj, std::move(result)));
+    } catch (const std::bad_alloc&) {
+        SetError("Out of memory");
+        return {};
     } catch (const std::exception& e) {
         SetError(e.what());
         return {};
+    } catch (...) {
+        SetError("Unknown exception");
+        return {};
     }
 }
 
 // Method: GetTasksByStatus
-TaskManagerArray_Handle IProject_GetTasksByStatus(
+TaskManagerStream_Handle IProject_GetTasksByStatus(
     IProject_Handle handle, Status status) {
     if (!handle) {
         SetError("Null handle");
         return {};
     }
+    if (!minimidl::enum_is_valid<TaskManager::Status>(status)) {
+        SetError("Invalid Status value");
+        return {};
+    }
     try {
         auto* obj = HandleToPtr<TaskManager::IProject>(handle);
-        auto result = obj->GetTasksByStatus(
-static_cast<TaskManager::Status>(status));
-        return result;
+        auto result = obj->GetTasksByStatus(static_cast<TaskManager::Status>(status));
+        return PtrToHandle(marshal::MakeStreamReader(obj, std::move(result)));
+    } catch (const std::bad_alloc&) {
+        SetError("Out of memory");
+        return {};
     } catch (const std::exception& e) {
         SetError(e.what());
         return {};
+    } catch (...) {
+        SetError("Unknown exception");
+        return {};
     }
 }
 
 // Method: DeleteTask
 bool IProject_DeleteTask(
-    IProject_Handle handle, IDynamicString_Handle taskId) {
+    IProject_Handle handle, TaskManager_Id taskId) {
     if (!handle) {
         SetError("Null handle");
         return {};
     }
     try {
         auto* obj = HandleToPtr<TaskManager::IProject>(handle);
-        auto result = obj->DeleteTask(
-HandleToPtr<IDynamicString>(taskId)->GetValue());
+        auto result = obj->DeleteTask(taskId);
         return result;
+    } catch (const std::bad_alloc&) {
+        SetError("Out of memory");
+        return {};
+    } catch (const std::exception& e) {
+        SetError(e.what());
+        return {};
+    } catch (...) {
+        SetError("Unknown exception");
+        return {};
+    }
+}
+
+// Method: GetTaskSummaries
+TaskManagerArray_Handle IProject_GetTaskSummaries(
+    IProject_Handle handle) {
+    if (!handle) {
+        SetError("Null handle");
+        return {};
+    }
+    try {
+        auto* obj = HandleToPtr<TaskManager::IProject>(handle);
+        auto result = obj->GetTaskSummaries();
+        return PtrToHandle(marshal::MarshalItems(result));
+    } catch (const std::bad_alloc&) {
+        SetError("Out of memory");
+        return {};
     } catch (const std::exception& e) {
         SetError(e.what());
         return {};
+    } catch (...) {
+        SetError("Unknown exception");
+        return {};
     }
 }
 
@@ -811,12 +2114,17 @@ int32_t IProject_GetTaskCount(
     }
     try {
         auto* obj = HandleToPtr<TaskManager::IProject>(handle);
-        auto result = obj->GetTaskCount(
-);
+        auto result = obj->GetTaskCount();
         return result;
+    } catch (const std::bad_alloc&) {
+        SetError("Out of memory");
+        return {};
     } catch (const std::exception& e) {
         SetError(e.what());
         return {};
+    } catch (...) {
+        SetError("Unknown exception");
+        return {};
     }
 }
 
@@ -829,12 +2137,17 @@ int32_t IProject_GetCompletedCount(
     }
     try {
         auto* obj = HandleToPtr<TaskManager::IProject>(handle);
-        auto result = obj->GetCompletedCount(
-);
+        auto result = obj->GetCompletedCount();
         return result;
+    } catch (const std::bad_alloc&) {
+        SetError("Out of memory");
+        return {};
     } catch (const std::exception& e) {
         SetError(e.what());
         return {};
+    } catch (...) {
+        SetError("Unknown exception");
+        return {};
     }
 }
 
@@ -847,12 +2160,285 @@ TaskManagerDict_Handle IProject_GetTaskCountByStatus(
     }
     try {
         auto* obj = HandleToPtr<TaskManager::IProject>(handle);
-        auto result = obj->GetTaskCountByStatus(
-);
-        return result;
+        auto result = obj->GetTaskCountByStatus();
+        return PtrToHandle(marshal::MarshalDict(result));
+    } catch (const std::bad_alloc&) {
+        SetError("Out of memory");
+        return {};
     } catch (const std::exception& e) {
         SetError(e.what());
         return {};
+    } catch (...) {
+        SetError("Unknown exception");
+        return {};
+    }
+}
+
+// Snapshot
+void IProject_Snapshot_Release(IProject_Snapshot_t* snapshot) {
+    if (!snapshot) {
+        return;
+    }
+    ::operator delete(snapshot->_storage);
+    *snapshot = {};
+}
+
+bool IProject_Snapshot(IProject_Handle handle, IProject_Snapshot_t* out) {
+    if (!out) {
+        SetError("Null output");
+        return false;
+    }
+    *out = {};
+    if (!handle) {
+        SetError("Null handle");
+        return false;
+    }
+
+    // Filled in place so a failing getter can release what was captured
+    IProject_Snapshot_t snapshot{};
+    try {
+        auto* obj = HandleToPtr<TaskManager::IProject>(handle);
+        // All strings share one allocation
+        const auto& nameValue = obj->get_name();
+        const auto& descriptionValue = obj->get_description();
+        char* cursor = static_cast<char*>(::operator new(nameValue.size() + 1 + descriptionValue.size() + 1));
+        snapshot._storage = cursor;
+        snapshot.id = obj->get_id();
+        snapshot.name = StoreString(cursor, nameValue);
+        snapshot.description = StoreString(cursor, descriptionValue);
+        snapshot.active = obj->get_active();
+        *out = snapshot;
+        return true;
+    } catch (const std::bad_alloc&) {
+        IProject_Snapshot_Release(&snapshot);
+        SetError("Out of memory");
+        return false;
+    } catch (const std::exception& e) {
+        IProject_Snapshot_Release(&snapshot);
+        SetError(e.what());
+        return false;
+    } catch (...) {
+        IProject_Snapshot_Release(&snapshot);
+        SetError("Unknown exception");
+        return false;
+    }
+}
+
+// Batch calls: one loop, one exception handler
+size_t IProject_Getid_Batch(const IProject_Handle* handles, size_t count, TaskManager_Id* values) {
+    if (count && (!handles || !values)) {
+        SetError("Null array");
+        return 0;
+    }
+    size_t done = 0;
+    try {
+        for (; done < count; ++done) {
+            if (!handles[done]) {
+                SetError("Null handle");
+                return done;
+            }
+            auto* obj = HandleToPtr<TaskManager::IProject>(handles[done]);
+            values[done] = obj->get_id();
+        }
+    } catch (const std::bad_alloc&) {
+        SetError("Out of memory");
+        return done;
+    } catch (const std::exception& e) {
+        SetError(e.what());
+        return done;
+    } catch (...) {
+        SetError("Unknown exception");
+        return done;
+    }
+    return done;
+}
+
+size_t IProject_Getactive_Batch(const IProject_Handle* handles, size_t count, bool* values) {
+    if (count && (!handles || !values)) {
+        SetError("Null array");
+        return 0;
+    }
+    size_t done = 0;
+    try {
+        for (; done < count; ++done) {
+            if (!handles[done]) {
+                SetError("Null handle");
+                return done;
+            }
+            auto* obj = HandleToPtr<TaskManager::IProject>(handles[done]);
+            values[done] = obj->get_active();
+        }
+    } catch (const std::bad_alloc&) {
+        SetError("Out of memory");
+        return done;
+    } catch (const std::exception& e) {
+        SetError(e.what());
+        return done;
+    } catch (...) {
+        SetError("Unknown exception");
+        return done;
+    }
+    return done;
+}
+
+size_t IProject_Setactive_Batch(const IProject_Handle* handles, size_t count, const bool* values) {
+    if (count && (!handles || !values)) {
+        SetError("Null array");
+        return 0;
+    }
+    size_t done = 0;
+    try {
+        for (; done < count; ++done) {
+            if (!handles[done]) {
+                SetError("Null handle");
+                return done;
+            }
+            auto* obj = HandleToPtr<TaskManager::IProject>(handles[done]);
+            obj->set_active(values[done]);
+        }
+    } catch (const std::bad_alloc&) {
+        SetError("Out of memory");
+        return done;
+    } catch (const std::exception& e) {
+        SetError(e.what());
+        return done;
+    } catch (...) {
+        SetError("Unknown exception");
+        return done;
+    }
+    return done;
+}
+
+size_t IProject_DeleteTask_Batch(const IProject_Handle* handles, size_t count, const TaskManager_Id* taskId, bool* results) {
+    if (count && (!handles || !taskId || !results)) {
+        SetError("Null array");
+        return 0;
+    }
+    size_t done = 0;
+    try {
+        for (; done < count; ++done) {
+            if (!handles[done]) {
+                SetError("Null handle");
+                return done;
+            }
+            auto* obj = HandleToPtr<TaskManager::IProject>(handles[done]);
+            results[done] = obj->DeleteTask(taskId[done]);
+        }
+    } catch (const std::bad_alloc&) {
+        SetError("Out of memory");
+        return done;
+    } catch (const std::exception& e) {
+        SetError(e.what());
+        return done;
+    } catch (...) {
+        SetError("Unknown exception");
+        return done;
+    }
+    return done;
+}
+
+size_t IProject_GetTaskCount_Batch(const IProject_Handle* handles, size_t count, int32_t* results) {
+    if (count && (!handles || !results)) {
+        SetError("Null array");
+        return 0;
+    }
+    size_t done = 0;
+    try {
+        for (; done < count; ++done) {
+            if (!handles[done]) {
+                SetError("Null handle");
+                return done;
+            }
+            auto* obj = HandleToPtr<TaskManager::IProject>(handles[done]);
+            results[done] = obj->GetTaskCount();
+        }
+    } catch (const std::bad_alloc&) {
+        SetError("Out of memory");
+        return done;
+    } catch (const std::exception& e) {
+        SetError(e.what());
+        return done;
+    } catch (...) {
+        SetError("Unknown exception");
+        return done;
+    }
+    return done;
+}
+
+size_t IProject_GetCompletedCount_Batch(const IProject_Handle* handles, size_t count, int32_t* results) {
+    if (count && (!handles || !results)) {
+        SetError("Null array");
+        return 0;
+    }
+    size_t done = 0;
+    try {
+        for (; done < count; ++done) {
+            if (!handles[done]) {
+                SetError("Null handle");
+                return done;
+            }
+            auto* obj = HandleToPtr<TaskManager::IProject>(handles[done]);
+            results[done] = obj->GetCompletedCount();
+        }
+    } catch (const std::bad_alloc&) {
+        SetError("Out of memory");
+        return done;
+    } catch (const std::exception& e) {
+        SetError(e.what());
+        return done;
+    } catch (...) {
+        SetError("Unknown exception");
+        return done;
+    }
+    return done;
+}
+
+// Event: TaskCountChanged
+uint64_t IProject_TaskCountChanged_Subscribe(IProject_Handle handle, IProject_TaskCountChanged_Callback callback, void* context) {
+    if (!handle) {
+        SetError("Null handle");
+        return 0;
+    }
+    if (!callback) {
+        SetError("Null callback");
+        return 0;
+    }
+    try {
+        auto* obj = HandleToPtr<TaskManager::IProject>(handle);
+        const uint64_t subscription = obj->TaskCountChanged().subscribe(
+            [callback, context](const auto& count) {
+                callback(context, count);
+            });
+        return subscription;
+    } catch (const std::bad_alloc&) {
+        SetError("Out of memory");
+        return 0;
+    } catch (const std::exception& e) {
+        SetError(e.what());
+        return 0;
+    } catch (...) {
+        SetError("Unknown exception");
+        return 0;
+    }
+}
+
+bool IProject_TaskCountChanged_Unsubscribe(IProject_Handle handle, uint64_t subscription) {
+    if (!handle) {
+        SetError("Null handle");
+        return false;
+    }
+    try {
+        auto* obj = HandleToPtr<TaskManager::IProject>(handle);
+        return obj->TaskCountChanged().unsubscribe(subscription);
+    } catch (const std::bad_alloc&) {
+        SetError("Out of memory");
+        return false;
+    } catch (const std::exception& e) {
+        SetError(e.what());
+        return false;
+    } catch (...) {
+        SetError("Unknown exception");
+        return false;
     }
 }
 
@@ -864,9 +2450,15 @@ ITaskManager_Handle ITaskManager_Create() {
         // In practice, you'd need a factory or concrete implementation
         SetError("ITaskManager_Create not implemented - interface requires concrete implementation");
         return nullptr;
+    } catch (const std::bad_alloc&) {
+        SetError("Out of memory");
+        return nullptr;
     } catch (const std::exception& e) {
         SetError(e.what());
         return nullptr;
+    } catch (...) {
+        SetError("Unknown exception");
+        return nullptr;
     }
 }
 
@@ -875,12 +2467,8 @@ void ITaskManager_Release(ITaskManager_Handle handle) {
         SetError("Null handle");
         return;
     }
-    try {
-        auto* obj = HandleToPtr<TaskManager::ITaskManager>(handle);
-        delete obj;
-    } catch (const std::exception& e) {
-        SetError(e.what());
-    }
+    // Handles carry the object's own intrusive count
+    HandleToPtr<TaskManager::ITaskManager>(handle)->Release();
 }
 
 void ITaskManager_AddRef(ITaskManager_Handle handle) {
@@ -888,8 +2476,7 @@ void ITaskManager_AddRef(ITaskManager_Handle handle) {
         SetError("Null handle");
         return;
     }
-    // Note: This would need proper reference counting implementation
-    // For now, this is a no-op placeholder
+    HandleToPtr<TaskManager::ITaskManager>(handle)->AddRef();
 }
 
 // Method: CreateProject
@@ -901,12 +2488,17 @@ IProject_Handle ITaskManager_CreateProject(
     }
     try {
         auto* obj = HandleToPtr<TaskManager::ITaskManager>(handle);
-        auto result = obj->CreateProject(
-HandleToPtr<IDynamicString>(name)->GetValue());
-        return PtrToHandle(result.get());
+        auto result = obj->CreateProject(HandleToPtr<IDynamicString>(name)->GetValue());
+        return ObjectToHandle(std::move(result));
+    } catch (const std::bad_alloc&) {
+        SetError("Out of memory");
+        return {};
     } catch (const std::exception& e) {
         SetError(e.what());
         return {};
+    } catch (...) {
+        SetError("Unknown exception");
+        return {};
     }
 }
 
@@ -919,12 +2511,17 @@ IProject_Handle ITaskManager_GetProject(
     }
     try {
         auto* obj = HandleToPtr<TaskManager::ITaskManager>(handle);
-        auto result = obj->GetProject(
-HandleToPtr<IDynamicString>(projectId)->GetValue());
-        return PtrToHandle(result.get());
+        auto result = obj->GetProject(HandleToPtr<IDynamicString>(projectId)->GetValue());
+        return ObjectToHandle(std::move(result));
+    } catch (const std::bad_alloc&) {
+        SetError("Out of memory");
+        return {};
     } catch (const std::exception& e) {
         SetError(e.what());
         return {};
+    } catch (...) {
+        SetError("Unknown exception");
+        return {};
     }
 }
 
@@ -937,12 +2534,17 @@ TaskManagerArray_Handle ITaskManager_GetProjects(
     }
     try {
         auto* obj = HandleToPtr<TaskManager::ITaskManager>(handle);
-        auto result = obj->GetProjects(
-);
-        return result;
+        auto result = obj->GetProjects();
+        return PtrToHandle(marshal::MarshalItems(result));
+    } catch (const std::bad_alloc&) {
+        SetError("Out of memory");
+        return {};
     } catch (const std::exception& e) {
         SetError(e.what());
         return {};
+    } catch (...) {
+        SetError("Unknown exception");
+        return {};
     }
 }
 
@@ -955,12 +2557,17 @@ TaskManagerArray_Handle ITaskManager_GetActiveProjects(
     }
     try {
         auto* obj = HandleToPtr<TaskManager::ITaskManager>(handle);
-        auto result = obj->GetActiveProjects(
-);
-        return result;
+        auto result = obj->GetActiveProjects();
+        return PtrToHandle(marshal::MarshalItems(result));
+    } catch (const std::bad_alloc&) {
+        SetError("Out of memory");
+        return {};
     } catch (const std::exception& e) {
         SetError(e.what());
         return {};
+    } catch (...) {
+        SetError("Unknown exception");
+        return {};
     }
 }
 
@@ -973,31 +2580,66 @@ bool ITaskManager_DeleteProject(
     }
     try {
         auto* obj = HandleToPtr<TaskManager::ITaskManager>(handle);
-        auto result = obj->DeleteProject(
-HandleToPtr<IDynamicString>(projectId)->GetValue());
+        auto result = obj->DeleteProject(HandleToPtr<IDynamicString>(projectId)->GetValue());
         return result;
+    } catch (const std::bad_alloc&) {
+        SetError("Out of memory");
+        return {};
     } catch (const std::exception& e) {
         SetError(e.what());
         return {};
+    } catch (...) {
+        SetError("Unknown exception");
+        return {};
     }
 }
 
-// Method: SearchTasks
-TaskManagerArray_Handle ITaskManager_SearchTasks(
-    ITaskManager_Handle handle, IDynamicString_Handle query) {
+// Method: SearchTasks (async)
+bool ITaskManager_SearchTasks(ITaskManager_Handle handle, IDynamicString_Handle query, ITaskManager_SearchTasks_Callback callback, void* context) {
     if (!handle) {
         SetError("Null handle");
-        return {};
+        return false;
+    }
+    if (!callback) {
+        SetError("Null callback");
+        return false;
     }
     try {
         auto* obj = HandleToPtr<TaskManager::ITaskManager>(handle);
-        auto result = obj->SearchTasks(
-HandleToPtr<IDynamicString>(query)->GetValue());
-        return result;
+        auto future = obj->SearchTasks(HandleToPtr<IDynamicString>(query)->GetValue());
+        if (!future.valid()) {
+            throw std::runtime_error("SearchTasks returned no future");
+        }
+        // The object is kept alive until its result has been delivered
+        WhenReady(std::move(future), [self = minimidl::object_ptr<TaskManager::ITaskManager>(obj), callback, context](auto& ready) {
+            TaskManager_ErrorCode code = TASKMANAGER_OK;
+            TaskManagerArray_Handle value{};
+            try {
+                auto result = ready.get();
+                value = PtrToHandle(marshal::MarshalItems(result));
+            } catch (const std::bad_alloc&) {
+                SetError("Out of memory");
+                code = TASKMANAGER_ERROR_OUT_OF_MEMORY;
+            } catch (const std::exception& e) {
+                SetError(e.what());
+                code = TASKMANAGER_ERROR_EXCEPTION;
+            } catch (...) {
+                SetError("Unknown exception");
+                code = TASKMANAGER_ERROR_EXCEPTION;
+            }
+            callback(context, code, value);
+        });
+    } catch (const std::bad_alloc&) {
+        SetError("Out of memory");
+        return false;
     } catch (const std::exception& e) {
         SetError(e.what());
-        return {};
+        return false;
+    } catch (...) {
+        SetError("Unknown exception");
+        return false;
     }
+    return true;
 }
 
 // Method: GetTasksByPriority
@@ -1007,14 +2649,23 @@ TaskManagerArray_Handle ITaskManager_GetTasksByPriority(
         SetError("Null handle");
         return {};
     }
+    if (!minimidl::enum_is_valid<TaskManager::Priority>(priority)) {
+        SetError("Invalid Priority value");
+        return {};
+    }
     try {
         auto* obj = HandleToPtr<TaskManager::ITaskManager>(handle);
-        auto result = obj->GetTasksByPriority(
-static_cast<TaskManager::Priority>(priority));
-        return result;
+        auto result = obj->GetTasksByPriority(static_cast<TaskManager::Priority>(priority));
+        return PtrToHandle(marshal::MarshalItems(result));
+    } catch (const std::bad_alloc&) {
+        SetError("Out of memory");
+        return {};
     } catch (const std::exception& e) {
         SetError(e.what());
         return {};
+    } catch (...) {
+        SetError("Unknown exception");
+        return {};
     }
 }
 
@@ -1027,12 +2678,17 @@ TaskManagerArray_Handle ITaskManager_GetOverdueTasks(
     }
     try {
         auto* obj = HandleToPtr<TaskManager::ITaskManager>(handle);
-        auto result = obj->GetOverdueTasks(
-);
-        return result;
+        auto result = obj->GetOverdueTasks();
+        return PtrToHandle(marshal::MarshalItems(result));
+    } catch (const std::bad_alloc&) {
+        SetError("Out of memory");
+        return {};
     } catch (const std::exception& e) {
         SetError(e.what());
         return {};
+    } catch (...) {
+        SetError("Unknown exception");
+        return {};
     }
 }
 
@@ -1045,12 +2701,17 @@ TaskManagerDict_Handle ITaskManager_GetSettings(
     }
     try {
         auto* obj = HandleToPtr<TaskManager::ITaskManager>(handle);
-        auto result = obj->GetSettings(
-);
-        return result;
+        auto result = obj->GetSettings();
+        return PtrToHandle(marshal::MarshalDict(result));
+    } catch (const std::bad_alloc&) {
+        SetError("Out of memory");
+        return {};
     } catch (const std::exception& e) {
         SetError(e.what());
         return {};
+    } catch (...) {
+        SetError("Unknown exception");
+        return {};
     }
 }
 
@@ -1063,114 +2724,369 @@ void ITaskManager_UpdateSettings(
     }
     try {
         auto* obj = HandleToPtr<TaskManager::ITaskManager>(handle);
-        obj->UpdateSettings(
-settings);
+        obj->UpdateSettings(marshal::CollectionArg{settings});
+    } catch (const std::bad_alloc&) {
+        SetError("Out of memory");
     } catch (const std::exception& e) {
         SetError(e.what());
+    } catch (...) {
+        SetError("Unknown exception");
     }
 }
 
-// Method: Save
-void ITaskManager_Save(
-    ITaskManager_Handle handle, IDynamicString_Handle path) {
+// Method: Save (async)
+bool ITaskManager_Save(ITaskManager_Handle handle, IDynamicString_Handle path, ITaskManager_Save_Callback callback, void* context) {
     if (!handle) {
         SetError("Null handle");
-        return;
+        return false;
+    }
+    if (!callback) {
+        SetError("Null callback");
+        return false;
     }
     try {
         auto* obj = HandleToPtr<TaskManager::ITaskManager>(handle);
-        obj->Save(
-HandleToPtr<IDynamicString>(path)->GetValue());
+        auto future = obj->Save(HandleToPtr<IDynamicString>(path)->GetValue());
+        if (!future.valid()) {
+            throw std::runtime_error("Save returned no future");
+        }
+        // The object is kept alive until its result has been delivered
+        WhenReady(std::move(future), [self = minimidl::object_ptr<TaskManager::ITaskManager>(obj), callback, context](auto& ready) {
+            TaskManager_ErrorCode code = TASKMANAGER_OK;
+            try {
+                ready.get();
+            } catch (const std::bad_alloc&) {
+                SetError("Out of memory");
+                code = TASKMANAGER_ERROR_OUT_OF_MEMORY;
+            } catch (const std::exception& e) {
+                SetError(e.what());
+                code = TASKMANAGER_ERROR_EXCEPTION;
+            } catch (...) {
+                SetError("Unknown exception");
+                code = TASKMANAGER_ERROR_EXCEPTION;
+            }
+            callback(context, code);
+        });
+    } catch (const std::bad_alloc&) {
+        SetError("Out of memory");
+        return false;
     } catch (const std::exception& e) {
         SetError(e.what());
+        return false;
+    } catch (...) {
+        SetError("Unknown exception");
+        return false;
     }
+    return true;
 }
 
-// Method: Load
-void ITaskManager_Load(
-    ITaskManager_Handle handle, IDynamicString_Handle path) {
+// Method: Load (async)
+bool ITaskManager_Load(ITaskManager_Handle handle, IDynamicString_Handle path, ITaskManager_Load_Callback callback, void* context) {
     if (!handle) {
         SetError("Null handle");
-        return;
+        return false;
+    }
+    if (!callback) {
+        SetError("Null callback");
+        return false;
     }
     try {
         auto* obj = HandleToPtr<TaskManager::ITaskManager>(handle);
-        obj->Load(
-HandleToPtr<IDynamicString>(path)->GetValue());
+        auto future = obj->Load(HandleToPtr<IDynamicString>(path)->GetValue());
+        if (!future.valid()) {
+            throw std::runtime_error("Load returned no future");
+        }
+        // The object is kept alive until its result has been delivered
+        WhenReady(std::move(future), [self = minimidl::object_ptr<TaskManager::ITaskManager>(obj), callback, context](auto& ready) {
+            TaskManager_ErrorCode code = TASKMANAGER_OK;
+            try {
+                ready.get();
+            } catch (const std::bad_alloc&) {
+                SetError("Out of memory");
+                code = TASKMANAGER_ERROR_OUT_OF_MEMORY;
+            } catch (const std::exception& e) {
+                SetError(e.what());
+                code = TASKMANAGER_ERROR_EXCEPTION;
+            } catch (...) {
+                SetError("Unknown exception");
+                code = TASKMANAGER_ERROR_EXCEPTION;
+            }
+            callback(context, code);
+        });
+    } catch (const std::bad_alloc&) {
+        SetError("Out of memory");
+        return false;
     } catch (const std::exception& e) {
         SetError(e.what());
+        return false;
+    } catch (...) {
+        SetError("Unknown exception");
+        return false;
     }
+    return true;
 }
 
-// Collection iteration helpers
+// Events posted by any object are delivered together
+size_t TaskManager_DispatchEvents() {
+    try {
+        // A callback that throws leaves the remaining events for the next call
+        return minimidl::dispatch_events();
+    } catch (const std::bad_alloc&) {
+        SetError("Out of memory");
+        return 0;
+    } catch (const std::exception& e) {
+        SetError(e.what());
+        return 0;
+    } catch (...) {
+        SetError("Unknown exception");
+        return 0;
+    }
+}
 
-struct ArrayIterator {
-    size_t current = 0;
-    // Would contain actual array data
-};
+// Ids are minimidl::id entries, shared with the C++ side as they are
+TaskManager_Id TaskManager_InternId(const char* value) {
+    try {
+        return minimidl::id(value ? value : "");
+    } catch (const std::bad_alloc&) {
+        SetError("Out of memory");
+        return nullptr;
+    } catch (const std::exception& e) {
+        SetError(e.what());
+        return nullptr;
+    } catch (...) {
+        SetError("Unknown exception");
+        return nullptr;
+    }
+}
 
-struct DictIterator {
-    size_t current = 0;
-    // Would contain actual map iterator
-};
+TaskManager_Id TaskManager_FindId(const char* value) {
+    try {
+        return minimidl::id::find(value ? value : "");
+    } catch (const std::bad_alloc&) {
+        SetError("Out of memory");
+        return nullptr;
+    } catch (const std::exception& e) {
+        SetError(e.what());
+        return nullptr;
+    } catch (...) {
+        SetError("Unknown exception");
+        return nullptr;
+    }
+}
 
-struct SetIterator {
-    size_t current = 0;
-    // Would contain actual set iterator
-};
+const char* TaskManager_GetIdValue(TaskManager_Id id) {
+    return minimidl::id(id).c_str();
+}
+
+size_t TaskManager_GetIdLength(TaskManager_Id id) {
+    return minimidl::id(id).size();
+}
+
+size_t TaskManager_GetIdHash(TaskManager_Id id) {
+    return minimidl::id(id).hash();
+}
+
+// Collections
+// Every collection handle is an immutable marshal::CollectionBuffer
 
 void TaskManagerArray_Release(TaskManagerArray_Handle handle) {
-    delete HandleToPtr<ArrayIterator>(handle);
+    marshal::CollectionBuffer::Destroy(HandleToPtr<marshal::CollectionBuffer>(handle));
 }
 
 size_t TaskManagerArray_Count(TaskManagerArray_Handle handle) {
     if (!handle) return 0;
-    // Implementation would return actual count
-    return 0;
+    return HandleToPtr<marshal::CollectionBuffer>(handle)->count;
+}
+
+size_t TaskManagerArray_GetItems(TaskManagerArray_Handle handle, size_t start, size_t count, void* items) {
+    if (!handle) {
+        SetError("Null handle");
+        return 0;
+    }
+    return HandleToPtr<marshal::CollectionBuffer>(handle)->Copy(0, start, count, items);
+}
+
+const void* TaskManagerArray_Data(TaskManagerArray_Handle handle) {
+    if (!handle) return nullptr;
+    const auto* buffer = HandleToPtr<marshal::CollectionBuffer>(handle);
+    return buffer->columns[0].kind == marshal::ColumnKind::Fixed ? buffer->columns[0].values : nullptr;
+}
+
+TaskManagerArray_Handle TaskManagerArray_CreateStrings(const TaskManager_StringView* items, size_t count) {
+    if (!items && count) {
+        SetError("Null items");
+        return nullptr;
+    }
+    try {
+        return PtrToHandle(marshal::FromStrings(items, count));
+    } catch (const std::bad_alloc&) {
+        SetError("Out of memory");
+        return nullptr;
+    } catch (const std::exception& e) {
+        SetError(e.what());
+        return nullptr;
+    } catch (...) {
+        SetError("Unknown exception");
+        return nullptr;
+    }
+}
+
+TaskManagerArray_Handle TaskManagerArray_CreateValues(const void* items, size_t count, size_t element_size) {
+    if (!items && count) {
+        SetError("Null items");
+        return nullptr;
+    }
+    if (!element_size) {
+        SetError("Invalid element size");
+        return nullptr;
+    }
+    try {
+        return PtrToHandle(marshal::FromValues(items, count, element_size));
+    } catch (const std::bad_alloc&) {
+        SetError("Out of memory");
+        return nullptr;
+    } catch (const std::exception& e) {
+        SetError(e.what());
+        return nullptr;
+    } catch (...) {
+        SetError("Unknown exception");
+        return nullptr;
+    }
 }
 
 void TaskManagerDict_Release(TaskManagerDict_Handle handle) {
-    delete HandleToPtr<DictIterator>(handle);
+    marshal::CollectionBuffer::Destroy(HandleToPtr<marshal::CollectionBuffer>(handle));
 }
 
 size_t TaskManagerDict_Count(TaskManagerDict_Handle handle) {
     if (!handle) return 0;
-    // Implementation would return actual count
-    return 0;
+    return HandleToPtr<marshal::CollectionBuffer>(handle)->count;
 }
 
-bool TaskManagerDict_Next(TaskManagerDict_Handle handle, const char** key, void** value) {
+size_t TaskManagerDict_GetKeys(TaskManagerDict_Handle handle, size_t start, size_t count, void* keys) {
+    if (!handle) {
+        SetError("Null handle");
+        return 0;
+    }
+    return HandleToPtr<marshal::CollectionBuffer>(handle)->Copy(0, start, count, keys);
+}
+
+size_t TaskManagerDict_GetValues(TaskManagerDict_Handle handle, size_t start, size_t count, void* values) {
+    if (!handle) {
+        SetError("Null handle");
+        return 0;
+    }
+    return HandleToPtr<marshal::CollectionBuffer>(handle)->Copy(1, start, count, values);
+}
+
+bool TaskManagerDict_Next(TaskManagerDict_Handle handle, const void** key, const void** value) {
     if (!handle) return false;
-    // Implementation would iterate through dictionary
-    return false;
+    auto* buffer = HandleToPtr<marshal::CollectionBuffer>(handle);
+    if (buffer->cursor >= buffer->count) return false;
+    if (key) *key = buffer->Element(0, buffer->cursor);
+    if (value) *value = buffer->Element(1, buffer->cursor);
+    ++buffer->cursor;
+    return true;
 }
 
 void TaskManagerDict_Reset(TaskManagerDict_Handle handle) {
     if (!handle) return;
-    auto* iter = HandleToPtr<DictIterator>(handle);
-    iter->current = 0;
+    HandleToPtr<marshal::CollectionBuffer>(handle)->cursor = 0;
+}
+
+TaskManagerDict_Handle TaskManagerDict_CreateFromArrays(TaskManagerArray_Handle keys, TaskManagerArray_Handle values) {
+    if (!keys || !values) {
+        SetError("Null handle");
+        return nullptr;
+    }
+    try {
+        const auto* keyBuffer = HandleToPtr<marshal::CollectionBuffer>(keys);
+        const auto* valueBuffer = HandleToPtr<marshal::CollectionBuffer>(values);
+        if (keyBuffer->count != valueBuffer->count) {
+            SetError("Key and value counts differ");
+            return nullptr;
+        }
+        marshal::ColumnPlan plans[2] = {marshal::PlanOf(*keyBuffer, 0), marshal::PlanOf(*valueBuffer, 0)};
+        auto* buffer = marshal::CollectionBuffer::Create(keyBuffer->count, plans, 2);
+        marshal::CopyColumn(*keyBuffer, 0, *buffer, 0);
+        marshal::CopyColumn(*valueBuffer, 0, *buffer, 1);
+        return PtrToHandle(buffer);
+    } catch (const std::bad_alloc&) {
+        SetError("Out of memory");
+        return nullptr;
+    } catch (const std::exception& e) {
+        SetError(e.what());
+        return nullptr;
+    } catch (...) {
+        SetError("Unknown exception");
+        return nullptr;
+    }
 }
 
 void TaskManagerSet_Release(TaskManagerSet_Handle handle) {
-    delete HandleToPtr<SetIterator>(handle);
+    marshal::CollectionBuffer::Destroy(HandleToPtr<marshal::CollectionBuffer>(handle));
 }
 
 size_t TaskManagerSet_Count(TaskManagerSet_Handle handle) {
     if (!handle) return 0;
-    // Implementation would return actual count
-    return 0;
+    return HandleToPtr<marshal::CollectionBuffer>(handle)->count;
+}
+
+size_t TaskManagerSet_GetItems(TaskManagerSet_Handle handle, size_t start, size_t count, void* items) {
+    if (!handle) {
+        SetError("Null handle");
+        return 0;
+    }
+    return HandleToPtr<marshal::CollectionBuffer>(handle)->Copy(0, start, count, items);
 }
 
-bool TaskManagerSet_Next(TaskManagerSet_Handle handle, void** value) {
+bool TaskManagerSet_Next(TaskManagerSet_Handle handle, const void** value) {
     if (!handle) return false;
-    // Implementation would iterate through set
-    return false;
+    auto* buffer = HandleToPtr<marshal::CollectionBuffer>(handle);
+    if (buffer->cursor >= buffer->count) return false;
+    if (value) *value = buffer->Element(0, buffer->cursor);
+    ++buffer->cursor;
+    return true;
 }
 
 void TaskManagerSet_Reset(TaskManagerSet_Handle handle) {
     if (!handle) return;
-    auto* iter = HandleToPtr<SetIterator>(handle);
-    iter->current = 0;
+    HandleToPtr<marshal::CollectionBuffer>(handle)->cursor = 0;
+}
+
+TaskManagerSet_Handle TaskManagerSet_CreateStrings(const TaskManager_StringView* items, size_t count) {
+    return TaskManagerArray_CreateStrings(items, count);
+}
+
+TaskManagerSet_Handle TaskManagerSet_CreateValues(const void* items, size_t count, size_t element_size) {
+    return TaskManagerArray_CreateValues(items, count, element_size);
+}
+
+size_t TaskManagerStream_Next(TaskManagerStream_Handle handle, void* items, size_t capacity) {
+    if (!handle) {
+        SetError("Null handle");
+        return 0;
+    }
+    if (!items && capacity) {
+        SetError("Null items");
+        return 0;
+    }
+    try {
+        return HandleToPtr<marshal::StreamReader>(handle)->Next(items, capacity);
+    } catch (const std::bad_alloc&) {
+        SetError("Out of memory");
+        return 0;
+    } catch (const std::exception& e) {
+        SetError(e.what());
+        return 0;
+    } catch (...) {
+        SetError("Unknown exception");
+        return 0;
+    }
+}
+
+void TaskManagerStream_Release(TaskManagerStream_Handle handle) {
+    delete HandleToPtr<marshal::StreamReader>(handle);
 }
 
 } // extern "C"
\ No newline at end of file
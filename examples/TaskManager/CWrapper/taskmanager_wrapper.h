@@ -29,27 +29,57 @@ typedef enum {
     TASKMANAGER_ERROR_OUT_OF_MEMORY = -3,
     TASKMANAGER_ERROR_INVALID_INDEX = -4,
     TASKMANAGER_ERROR_NOT_IMPLEMENTED = -5,
+    TASKMANAGER_ERROR_EXCEPTION = -6,
+    TASKMANAGER_ERROR_INVALID_ARGUMENT = -7,
 } TaskManager_ErrorCode;
 
 // Core handles
 typedef void* IDynamicString_Handle;
 
+// Borrowed string view. Does not own its data; see the _View getters for
+// how long a view stays valid. data is NUL-terminated in views the API
+// returns; views passed to _View setters need not be.
+typedef struct {
+    const char* data;
+    size_t length;
+} TaskManager_StringView;
+
+// Interned identifier (id_t). Equal strings intern to the same handle, so
+// ids compare and hash as pointers. A handle stays valid for the rest of the
+// process and is never released; NULL is the empty id.
+typedef const struct minimidl_id_entry* TaskManager_Id;
+
 // Forward declarations
 typedef void* ITask_Handle;
 typedef void* IProject_Handle;
 typedef void* ITaskManager_Handle;
 
 // Collection handles
+// A collection is an immutable snapshot held in a single allocation. Fixed
+// size elements (numbers, enums, structs, object handles) are packed by value;
+// strings are read as TaskManager_StringView pointing into the
+// collection, valid until it is released. Object handles are borrowed.
 typedef void* TaskManagerArray_Handle;
 typedef void* TaskManagerDict_Handle;
 typedef void* TaskManagerSet_Handle;
 
+// Stream handle: the results of a stream<T> method, produced as they are
+// read by TaskManagerStream_Next
+typedef void* TaskManagerStream_Handle;
+
 // Priority enum
 typedef int32_t Priority;
 #define Priority_LOW 0
 #define Priority_MEDIUM 1
 #define Priority_HIGH 2
 #define Priority_URGENT 3
+// Name of a declared value, or NULL
+TASKMANAGER_API const char* Priority_ToString(Priority value);
+// Looks up a value by name; returns false and leaves *out_value alone if none matches
+TASKMANAGER_API bool Priority_FromString(const char* name, Priority* out_value);
+// Whether value is declared. Setters and methods refuse any other value and
+// record an error.
+TASKMANAGER_API bool Priority_IsValid(Priority value);
 
 // Status enum
 typedef int32_t Status;
@@ -57,6 +87,23 @@ typedef int32_t Status;
 #define Status_IN_PROGRESS 1
 #define Status_COMPLETED 2
 #define Status_CANCELLED 3
+// Name of a declared value, or NULL
+TASKMANAGER_API const char* Status_ToString(Status value);
+// Looks up a value by name; returns false and leaves *out_value alone if none matches
+TASKMANAGER_API bool Status_FromString(const char* name, Status* out_value);
+// Whether value is declared. Setters and methods refuse any other value and
+// record an error.
+TASKMANAGER_API bool Status_IsValid(Status value);
+
+// TaskSummary struct, laid out like TaskManager::TaskSummary.
+// Passed by value; arrays of it are packed, see TaskManagerArray_Data.
+typedef struct TaskSummary {
+    Priority priority;
+    Status status;
+    bool overdue;
+    char id[40];
+    char title[120];
+} TaskSummary;
 
 // ITask interface
 TASKMANAGER_API ITask_Handle ITask_Create();
@@ -64,7 +111,7 @@ TASKMANAGER_API void ITask_Release(ITask_Handle handle);
 TASKMANAGER_API void ITask_AddRef(ITask_Handle handle);
 
 // Property: id
-TASKMANAGER_API IDynamicString_Handle ITask_Getid(ITask_Handle handle);
+TASKMANAGER_API TaskManager_Id ITask_Getid(ITask_Handle handle);
 
 // Property: title
 TASKMANAGER_API IDynamicString_Handle ITask_Gettitle(ITask_Handle handle);
@@ -75,6 +122,8 @@ TASKMANAGER_API IDynamicString_Handle ITask_Getcreated_at(ITask_Handle handle);
 // Property: description
 TASKMANAGER_API IDynamicString_Handle ITask_Getdescription(ITask_Handle handle);
 TASKMANAGER_API void ITask_Setdescription(ITask_Handle handle, IDynamicString_Handle value);
+// Copies value.length bytes, which need not be NUL-terminated
+TASKMANAGER_API void ITask_Setdescription_View(ITask_Handle handle, TaskManager_StringView value);
 
 // Property: priority
 TASKMANAGER_API Priority ITask_Getpriority(ITask_Handle handle);
@@ -87,12 +136,19 @@ TASKMANAGER_API void ITask_Setstatus(ITask_Handle handle, Status value);
 // Property: due_date
 TASKMANAGER_API IDynamicString_Handle ITask_Getdue_date(ITask_Handle handle);
 TASKMANAGER_API void ITask_Setdue_date(ITask_Handle handle, IDynamicString_Handle value);
+// Copies value.length bytes, which need not be NUL-terminated
+TASKMANAGER_API void ITask_Setdue_date_View(ITask_Handle handle, TaskManager_StringView value);
 
 // Property: tags
 TASKMANAGER_API size_t ITask_Gettags_Count(ITask_Handle handle);
 TASKMANAGER_API IDynamicString_Handle ITask_Gettags_Item(ITask_Handle handle, size_t index);
+// Copies up to capacity items in one call and returns the total count
+// Each copied string must be released with IDynamicString_Release
+TASKMANAGER_API size_t ITask_Gettags_GetAll(ITask_Handle handle, IDynamicString_Handle* items, size_t capacity);
 TASKMANAGER_API void ITask_Settags_Clear(ITask_Handle handle);
 TASKMANAGER_API void ITask_Settags_Add(ITask_Handle handle, IDynamicString_Handle value);
+// Replaces all items in one call
+TASKMANAGER_API void ITask_Settags_SetAll(ITask_Handle handle, const TaskManager_StringView* items, size_t count);
 
 // Method: Complete
 TASKMANAGER_API void ITask_Complete(
@@ -107,6 +163,7 @@ TASKMANAGER_API bool ITask_IsOverdue(
     ITask_Handle handle);
 
 // Method: GetMetadata
+// Returns TaskManager_StringView -> TaskManager_StringView; release with TaskManagerDict_Release
 TASKMANAGER_API TaskManagerDict_Handle ITask_GetMetadata(
     ITask_Handle handle);
 
@@ -114,21 +171,57 @@ TASKMANAGER_API TaskManagerDict_Handle ITask_GetMetadata(
 TASKMANAGER_API void ITask_SetMetadata(
     ITask_Handle handle, IDynamicString_Handle key, IDynamicString_Handle value);
 
+// Snapshot: every readable property from one ITask_Snapshot call.
+// Strings are views into the snapshot's own storage and collection or object
+// handles belong to it; all stay valid until ITask_Snapshot_Release.
+typedef struct ITask_Snapshot_t {
+    TaskManager_Id id;
+    TaskManager_StringView title;
+    TaskManager_StringView created_at;
+    TaskManager_StringView description;
+    Priority priority;
+    Status status;
+    TaskManager_StringView due_date;
+    TaskManagerArray_Handle tags;
+    void* _storage;
+} ITask_Snapshot_t;
+
+// out is overwritten, so release a snapshot before reusing it
+// Returns false, leaving out empty, if a getter fails
+TASKMANAGER_API bool ITask_Snapshot(ITask_Handle handle, ITask_Snapshot_t* out);
+TASKMANAGER_API void ITask_Snapshot_Release(ITask_Snapshot_t* snapshot);
+
+// Batch calls: each runs over handles[0..count) in one loop and returns the
+// number of handles done. A batch stops at the first null handle or
+// exception, with the error set. Value arrays hold count elements.
+TASKMANAGER_API size_t ITask_Getid_Batch(const ITask_Handle* handles, size_t count, TaskManager_Id* values);
+TASKMANAGER_API size_t ITask_Getpriority_Batch(const ITask_Handle* handles, size_t count, Priority* values);
+TASKMANAGER_API size_t ITask_Setpriority_Batch(const ITask_Handle* handles, size_t count, const Priority* values);
+TASKMANAGER_API size_t ITask_Getstatus_Batch(const ITask_Handle* handles, size_t count, Status* values);
+TASKMANAGER_API size_t ITask_Setstatus_Batch(const ITask_Handle* handles, size_t count, const Status* values);
+TASKMANAGER_API size_t ITask_Complete_Batch(const ITask_Handle* handles, size_t count);
+TASKMANAGER_API size_t ITask_Cancel_Batch(const ITask_Handle* handles, size_t count);
+TASKMANAGER_API size_t ITask_IsOverdue_Batch(const ITask_Handle* handles, size_t count, bool* results);
+
 // IProject interface
 TASKMANAGER_API IProject_Handle IProject_Create();
 TASKMANAGER_API void IProject_Release(IProject_Handle handle);
 TASKMANAGER_API void IProject_AddRef(IProject_Handle handle);
 
 // Property: id
-TASKMANAGER_API IDynamicString_Handle IProject_Getid(IProject_Handle handle);
+TASKMANAGER_API TaskManager_Id IProject_Getid(IProject_Handle handle);
 
 // Property: name
 TASKMANAGER_API IDynamicString_Handle IProject_Getname(IProject_Handle handle);
 TASKMANAGER_API void IProject_Setname(IProject_Handle handle, IDynamicString_Handle value);
+// Copies value.length bytes, which need not be NUL-terminated
+TASKMANAGER_API void IProject_Setname_View(IProject_Handle handle, TaskManager_StringView value);
 
 // Property: description
 TASKMANAGER_API IDynamicString_Handle IProject_Getdescription(IProject_Handle handle);
 TASKMANAGER_API void IProject_Setdescription(IProject_Handle handle, IDynamicString_Handle value);
+// Copies value.length bytes, which need not be NUL-terminated
+TASKMANAGER_API void IProject_Setdescription_View(IProject_Handle handle, TaskManager_StringView value);
 
 // Property: active
 TASKMANAGER_API bool IProject_Getactive(IProject_Handle handle);
@@ -140,19 +233,26 @@ TASKMANAGER_API ITask_Handle IProject_CreateTask(
 
 // Method: GetTask
 TASKMANAGER_API ITask_Handle IProject_GetTask(
-    IProject_Handle handle, IDynamicString_Handle taskId);
+    IProject_Handle handle, TaskManager_Id taskId);
 
 // Method: GetTasks
-TASKMANAGER_API TaskManagerArray_Handle IProject_GetTasks(
+// Streams ITask_Handle; read with TaskManagerStream_Next, release with TaskManagerStream_Release
+TASKMANAGER_API TaskManagerStream_Handle IProject_GetTasks(
     IProject_Handle handle);
 
 // Method: GetTasksByStatus
-TASKMANAGER_API TaskManagerArray_Handle IProject_GetTasksByStatus(
+// Streams ITask_Handle; read with TaskManagerStream_Next, release with TaskManagerStream_Release
+TASKMANAGER_API TaskManagerStream_Handle IProject_GetTasksByStatus(
     IProject_Handle handle, Status status);
 
 // Method: DeleteTask
 TASKMANAGER_API bool IProject_DeleteTask(
-    IProject_Handle handle, IDynamicString_Handle taskId);
+    IProject_Handle handle, TaskManager_Id taskId);
+
+// Method: GetTaskSummaries
+// Returns TaskSummary; release with TaskManagerArray_Release
+TASKMANAGER_API TaskManagerArray_Handle IProject_GetTaskSummaries(
+    IProject_Handle handle);
 
 // Method: GetTaskCount
 TASKMANAGER_API int32_t IProject_GetTaskCount(
@@ -163,9 +263,45 @@ TASKMANAGER_API int32_t IProject_GetCompletedCount(
     IProject_Handle handle);
 
 // Method: GetTaskCountByStatus
+// Returns TaskManager_StringView -> int32_t; release with TaskManagerDict_Release
 TASKMANAGER_API TaskManagerDict_Handle IProject_GetTaskCountByStatus(
     IProject_Handle handle);
 
+// Snapshot: every readable property from one IProject_Snapshot call.
+// Strings are views into the snapshot's own storage and collection or object
+// handles belong to it; all stay valid until IProject_Snapshot_Release.
+typedef struct IProject_Snapshot_t {
+    TaskManager_Id id;
+    TaskManager_StringView name;
+    TaskManager_StringView description;
+    bool active;
+    void* _storage;
+} IProject_Snapshot_t;
+
+// out is overwritten, so release a snapshot before reusing it
+// Returns false, leaving out empty, if a getter fails
+TASKMANAGER_API bool IProject_Snapshot(IProject_Handle handle, IProject_Snapshot_t* out);
+TASKMANAGER_API void IProject_Snapshot_Release(IProject_Snapshot_t* snapshot);
+
+// Batch calls: each runs over handles[0..count) in one loop and returns the
+// number of handles done. A batch stops at the first null handle or
+// exception, with the error set. Value arrays hold count elements.
+TASKMANAGER_API size_t IProject_Getid_Batch(const IProject_Handle* handles, size_t count, TaskManager_Id* values);
+TASKMANAGER_API size_t IProject_Getactive_Batch(const IProject_Handle* handles, size_t count, bool* values);
+TASKMANAGER_API size_t IProject_Setactive_Batch(const IProject_Handle* handles, size_t count, const bool* values);
+TASKMANAGER_API size_t IProject_DeleteTask_Batch(const IProject_Handle* handles, size_t count, const TaskManager_Id* taskId, bool* results);
+TASKMANAGER_API size_t IProject_GetTaskCount_Batch(const IProject_Handle* handles, size_t count, int32_t* results);
+TASKMANAGER_API size_t IProject_GetCompletedCount_Batch(const IProject_Handle* handles, size_t count, int32_t* results);
+
+// Events: a subscribed callback runs from TaskManager_DispatchEvents with
+// the latest arguments posted since the last dispatch, or from the emitting
+// call for events the implementation emits directly. String arguments are
+// borrowed for the duration of the callback. Subscribe hands out the id to
+// pass to Unsubscribe, or 0 on failure.
+typedef void (*IProject_TaskCountChanged_Callback)(void* context, int32_t count);
+TASKMANAGER_API uint64_t IProject_TaskCountChanged_Subscribe(IProject_Handle handle, IProject_TaskCountChanged_Callback callback, void* context);
+TASKMANAGER_API bool IProject_TaskCountChanged_Unsubscribe(IProject_Handle handle, uint64_t subscription);
+
 // ITaskManager interface
 TASKMANAGER_API ITaskManager_Handle ITaskManager_Create();
 TASKMANAGER_API void ITaskManager_Release(ITaskManager_Handle handle);
@@ -180,10 +316,12 @@ TASKMANAGER_API IProject_Handle ITaskManager_GetProject(
     ITaskManager_Handle handle, IDynamicString_Handle projectId);
 
 // Method: GetProjects
+// Returns IProject_Handle; release with TaskManagerArray_Release
 TASKMANAGER_API TaskManagerArray_Handle ITaskManager_GetProjects(
     ITaskManager_Handle handle);
 
 // Method: GetActiveProjects
+// Returns IProject_Handle; release with TaskManagerArray_Release
 TASKMANAGER_API TaskManagerArray_Handle ITaskManager_GetActiveProjects(
     ITaskManager_Handle handle);
 
@@ -192,46 +330,95 @@ TASKMANAGER_API bool ITaskManager_DeleteProject(
     ITaskManager_Handle handle, IDynamicString_Handle projectId);
 
 // Method: SearchTasks
-TASKMANAGER_API TaskManagerArray_Handle ITaskManager_SearchTasks(
-    ITaskManager_Handle handle, IDynamicString_Handle query);
+// Returns ITask_Handle; release with TaskManagerArray_Release
+// Async: callback gets the result, which it owns, exactly once if the call
+// starts; it may run before the call returns or on another thread
+typedef void (*ITaskManager_SearchTasks_Callback)(void* context, TaskManager_ErrorCode code, TaskManagerArray_Handle result);
+TASKMANAGER_API bool ITaskManager_SearchTasks(ITaskManager_Handle handle, IDynamicString_Handle query, ITaskManager_SearchTasks_Callback callback, void* context);
 
 // Method: GetTasksByPriority
+// Returns ITask_Handle; release with TaskManagerArray_Release
 TASKMANAGER_API TaskManagerArray_Handle ITaskManager_GetTasksByPriority(
     ITaskManager_Handle handle, Priority priority);
 
 // Method: GetOverdueTasks
+// Returns ITask_Handle; release with TaskManagerArray_Release
 TASKMANAGER_API TaskManagerArray_Handle ITaskManager_GetOverdueTasks(
     ITaskManager_Handle handle);
 
 // Method: GetSettings
+// Returns TaskManager_StringView -> TaskManager_StringView; release with TaskManagerDict_Release
 TASKMANAGER_API TaskManagerDict_Handle ITaskManager_GetSettings(
     ITaskManager_Handle handle);
 
 // Method: UpdateSettings
+// settings: TaskManager_StringView -> TaskManager_StringView, NULL for empty
 TASKMANAGER_API void ITaskManager_UpdateSettings(
     ITaskManager_Handle handle, TaskManagerDict_Handle settings);
 
 // Method: Save
-TASKMANAGER_API void ITaskManager_Save(
-    ITaskManager_Handle handle, IDynamicString_Handle path);
+// Async: callback gets the result, which it owns, exactly once if the call
+// starts; it may run before the call returns or on another thread
+typedef void (*ITaskManager_Save_Callback)(void* context, TaskManager_ErrorCode code);
+TASKMANAGER_API bool ITaskManager_Save(ITaskManager_Handle handle, IDynamicString_Handle path, ITaskManager_Save_Callback callback, void* context);
 
 // Method: Load
-TASKMANAGER_API void ITaskManager_Load(
-    ITaskManager_Handle handle, IDynamicString_Handle path);
-
-// Collection iteration helpers
+// Async: callback gets the result, which it owns, exactly once if the call
+// starts; it may run before the call returns or on another thread
+typedef void (*ITaskManager_Load_Callback)(void* context, TaskManager_ErrorCode code);
+TASKMANAGER_API bool ITaskManager_Load(ITaskManager_Handle handle, IDynamicString_Handle path, ITaskManager_Load_Callback callback, void* context);
+
+// Runs the callbacks of the events posted since the last call, on the calling
+// thread; returns the number of events delivered
+TASKMANAGER_API size_t TaskManager_DispatchEvents(void);
+
+// Ids: InternId adds value to the table the first time it is seen, FindId
+// only looks it up and returns NULL for a string never interned. Reading an
+// id never allocates; GetIdValue returns "" for the empty id.
+TASKMANAGER_API TaskManager_Id TaskManager_InternId(const char* value);
+TASKMANAGER_API TaskManager_Id TaskManager_FindId(const char* value);
+TASKMANAGER_API const char* TaskManager_GetIdValue(TaskManager_Id id);
+TASKMANAGER_API size_t TaskManager_GetIdLength(TaskManager_Id id);
+TASKMANAGER_API size_t TaskManager_GetIdHash(TaskManager_Id id);
+
+// Collections
+// GetItems/GetKeys/GetValues copy up to count elements starting at start
+// into the caller's buffer and return the number copied. The buffer holds
+// elements of the collection's element type (TaskManager_StringView for strings).
 TASKMANAGER_API void TaskManagerArray_Release(TaskManagerArray_Handle handle);
 TASKMANAGER_API size_t TaskManagerArray_Count(TaskManagerArray_Handle handle);
+TASKMANAGER_API size_t TaskManagerArray_GetItems(TaskManagerArray_Handle handle, size_t start, size_t count, void* items);
+// Packed elements, or NULL for string arrays
+TASKMANAGER_API const void* TaskManagerArray_Data(TaskManagerArray_Handle handle);
+// Builders copy their input
+TASKMANAGER_API TaskManagerArray_Handle TaskManagerArray_CreateStrings(const TaskManager_StringView* items, size_t count);
+TASKMANAGER_API TaskManagerArray_Handle TaskManagerArray_CreateValues(const void* items, size_t count, size_t element_size);
 
 TASKMANAGER_API void TaskManagerDict_Release(TaskManagerDict_Handle handle);
 TASKMANAGER_API size_t TaskManagerDict_Count(TaskManagerDict_Handle handle);
-TASKMANAGER_API bool TaskManagerDict_Next(TaskManagerDict_Handle handle, const char** key, void** value);
+TASKMANAGER_API size_t TaskManagerDict_GetKeys(TaskManagerDict_Handle handle, size_t start, size_t count, void* keys);
+TASKMANAGER_API size_t TaskManagerDict_GetValues(TaskManagerDict_Handle handle, size_t start, size_t count, void* values);
+// key/value point at the element, or at NUL-terminated characters for strings
+TASKMANAGER_API bool TaskManagerDict_Next(TaskManagerDict_Handle handle, const void** key, const void** value);
 TASKMANAGER_API void TaskManagerDict_Reset(TaskManagerDict_Handle handle);
+TASKMANAGER_API TaskManagerDict_Handle TaskManagerDict_CreateFromArrays(TaskManagerArray_Handle keys, TaskManagerArray_Handle values);
 
 TASKMANAGER_API void TaskManagerSet_Release(TaskManagerSet_Handle handle);
 TASKMANAGER_API size_t TaskManagerSet_Count(TaskManagerSet_Handle handle);
-TASKMANAGER_API bool TaskManagerSet_Next(TaskManagerSet_Handle handle, void** value);
+TASKMANAGER_API size_t TaskManagerSet_GetItems(TaskManagerSet_Handle handle, size_t start, size_t count, void* items);
+TASKMANAGER_API bool TaskManagerSet_Next(TaskManagerSet_Handle handle, const void** value);
 TASKMANAGER_API void TaskManagerSet_Reset(TaskManagerSet_Handle handle);
+TASKMANAGER_API TaskManagerSet_Handle TaskManagerSet_CreateStrings(const TaskManager_StringView* items, size_t count);
+TASKMANAGER_API TaskManagerSet_Handle TaskManagerSet_CreateValues(const void* items, size_t count, size_t element_size);
+
+// Streams
+// Next copies up to capacity items, pulled from the implementation, into
+// the caller's buffer and returns the number copied, which is less than
+// capacity only at the end of the stream or on an error. Strings (TaskManager_StringView) and
+// object handles are borrowed and stay valid until the next Next call or
+// Release; AddRef a handle to keep it.
+TASKMANAGER_API size_t TaskManagerStream_Next(TaskManagerStream_Handle handle, void* items, size_t capacity);
+TASKMANAGER_API void TaskManagerStream_Release(TaskManagerStream_Handle handle);
 
 // IDynamicString interface
 TASKMANAGER_API IDynamicString_Handle IDynamicString_Create(const char* value);
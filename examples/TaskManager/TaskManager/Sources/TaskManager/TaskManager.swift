@@ -3,11 +3,13 @@
 
 import Foundation
 import TaskManagerC
+#if canImport(Combine)
+import Combine
+#endif
 
 /// ITask wrapper class
 public class Task {
     internal let handle: OpaquePointer
-    private var isOwned: Bool
     
     /// Initialize with a new instance
     public init() {
@@ -15,95 +17,223 @@ public class Task {
             fatalError("Failed to create ITask instance")
         }
         self.handle = h
-        self.isOwned = true
     }
     
-    /// Initialize with existing handle (does not take ownership)
+    /// Initialize with a handle returned by the C API, taking over the
+    /// reference it carries
     internal init(handle: OpaquePointer) {
         self.handle = handle
-        self.isOwned = false
-        ITask_AddRef(handle)
     }
     
     deinit {
-        if isOwned {
-            ITask_Release(handle)
-        }
+        ITask_Release(handle)
     }
     
-    /// id property
-    public var id: String {
-        guard let cString = ITask_Getid(handle) else {
-            return ""
-        }
-        return String(cString: cString)
+    /// id property, read on first use and cached
+    public private(set) lazy var id: TaskManagerId = idValue()
+    
+    private func idValue() -> TaskManagerId {
+        return TaskManagerId(handle: ITask_Getid(handle))
     }
     
     /// title property
     public var title: String {
-        guard let cString = ITask_Gettitle(handle) else {
-            return ""
-        }
-        return String(cString: cString)
+        return takeString(ITask_Gettitle(handle)) ?? ""
     }
     
-    /// created_at property
-    public var created_at: String {
-        guard let cString = ITask_Getcreated_at(handle) else {
-            return ""
-        }
-        return String(cString: cString)
+    /// created_at property, read on first use and cached
+    public private(set) lazy var created_at: String = created_atValue()
+    
+    private func created_atValue() -> String {
+        return takeString(ITask_Getcreated_at(handle)) ?? ""
     }
     
     /// description property
     public var description: String {
         get {
-            guard let cString = ITask_Getdescription(handle) else {
-                return ""
-            }
-            return String(cString: cString)
+            return takeString(ITask_Getdescription(handle)) ?? ""
         }
         set {
-            ITask_Setdescription(handle, newValue)
+            withStringView(newValue) { ITask_Setdescription_View(handle, $0) }
         }
     }
     
     /// priority property
-    // TODO: Implement property priority of type line=None column=None name='Priority'
+    public var priority: Priority {
+        get {
+            return Priority(checkedCValue: ITask_Getpriority(handle))
+        }
+        set {
+            ITask_Setpriority(handle, newValue.cValue)
+        }
+    }
     
     /// status property
-    // TODO: Implement property status of type line=None column=None name='Status'
+    public var status: Status {
+        get {
+            return Status(checkedCValue: ITask_Getstatus(handle))
+        }
+        set {
+            ITask_Setstatus(handle, newValue.cValue)
+        }
+    }
     
     /// due_date property
     public var due_date: String {
         get {
-            guard let cString = ITask_Getdue_date(handle) else {
-                return ""
-            }
-            return String(cString: cString)
+            return takeString(ITask_Getdue_date(handle)) ?? ""
         }
         set {
-            ITask_Setdue_date(handle, newValue)
+            withStringView(newValue) { ITask_Setdue_date_View(handle, $0) }
         }
     }
     
     /// tags property
     public var tags: [String] {
         get {
-            let count = ITask_Gettags_Count(handle)
-            var result: [String] = []
-            result.reserveCapacity(Int(count))
-            for i in 0..<count {
-                if let cString = ITask_Gettags_Item(handle, i) {
-                    result.append(String(cString: cString))
-                }
-            }
-            return result
+            return tagsItems()
         }
         set {
-            ITask_Settags_Clear(handle)
+            // Pack all strings into one buffer and pass views into it
+            var bytes: [CChar] = []
+            var ranges: [(start: Int, length: Int)] = []
+            ranges.reserveCapacity(newValue.count)
             for item in newValue {
-                ITask_Settags_Add(handle, item)
+                let start = bytes.count
+                bytes.append(contentsOf: item.utf8CString.dropLast())
+                ranges.append((start, bytes.count - start))
+            }
+            bytes.withUnsafeBufferPointer { buffer in
+                let views = ranges.map { range in
+                    TaskManager_StringView(
+                        data: range.length > 0 ? buffer.baseAddress! + range.start : nil,
+                        length: range.length
+                    )
+                }
+                ITask_Settags_SetAll(handle, views, views.count)
+            }
+        }
+    }
+    
+    private func tagsItems() -> [String] {
+        let count = ITask_Gettags_Count(handle)
+        var items = [IDynamicString_Handle?](repeating: nil, count: count)
+        let copied = min(ITask_Gettags_GetAll(handle, &items, count), count)
+        var result: [String] = []
+        result.reserveCapacity(copied)
+        for item in items.prefix(copied) {
+            if let item = takeString(item) {
+                result.append(item)
+            }
+        }
+        return result
+    }
+    
+    /// Readable properties of a Task, captured together
+    public struct Snapshot {
+        public let id: TaskManagerId
+        public let title: String
+        public let created_at: String
+        public let description: String
+        /// nil if the value is not a declared Priority case
+        public let priority: Priority?
+        /// nil if the value is not a declared Status case
+        public let status: Status?
+        public let due_date: String
+        public let tags: [String]
+    }
+    
+    /// Reads the snapshot properties with a single call into the C API, or
+    /// returns nil if a getter failed (see getLastError())
+    public func snapshot() -> Snapshot? {
+        var raw = ITask_Snapshot_t()
+        guard ITask_Snapshot(handle, &raw) else {
+            return nil
+        }
+        defer { ITask_Snapshot_Release(&raw) }
+        return Snapshot(
+            id: TaskManagerId(handle: raw.id),
+            title: makeString(raw.title),
+            created_at: makeString(raw.created_at),
+            description: makeString(raw.description),
+            priority: Priority(rawValue: raw.priority),
+            status: Status(rawValue: raw.status),
+            due_date: makeString(raw.due_date),
+            tags: readStringArray(raw.tags)
+        )
+    }
+    
+    /// Reads priority from every object with one call into the C API.
+    /// The result is shorter than objects if a getter failed (see getLastError())
+    public static func priority(of objects: [Task]) -> [Priority] {
+        let handles = objects.map { ITask_Handle($0.handle) }
+        return withExtendedLifetime(objects) {
+            [Priority.RawValue](unsafeUninitializedCapacity: handles.count) { buffer, initializedCount in
+                initializedCount = ITask_Getpriority_Batch(handles, handles.count, buffer.baseAddress)
+            }.map { Priority(checkedCValue: $0) }
+        }
+    }
+    
+    /// Sets priority on every object with one call into the C API and
+    /// returns how many were set
+    @discardableResult
+    public static func setPriority(of objects: [Task], to values: [Priority]) -> Int {
+        precondition(values.count == objects.count, "One value per object")
+        let handles = objects.map { ITask_Handle($0.handle) }
+        return withExtendedLifetime(objects) {
+            ITask_Setpriority_Batch(handles, handles.count, values.map { $0.cValue })
+        }
+    }
+    
+    /// Reads status from every object with one call into the C API.
+    /// The result is shorter than objects if a getter failed (see getLastError())
+    public static func status(of objects: [Task]) -> [Status] {
+        let handles = objects.map { ITask_Handle($0.handle) }
+        return withExtendedLifetime(objects) {
+            [Status.RawValue](unsafeUninitializedCapacity: handles.count) { buffer, initializedCount in
+                initializedCount = ITask_Getstatus_Batch(handles, handles.count, buffer.baseAddress)
+            }.map { Status(checkedCValue: $0) }
+        }
+    }
+    
+    /// Sets status on every object with one call into the C API and
+    /// returns how many were set
+    @discardableResult
+    public static func setStatus(of objects: [Task], to values: [Status]) -> Int {
+        precondition(values.count == objects.count, "One value per object")
+        let handles = objects.map { ITask_Handle($0.handle) }
+        return withExtendedLifetime(objects) {
+            ITask_Setstatus_Batch(handles, handles.count, values.map { $0.cValue })
+        }
+    }
+    
+    /// Calls Complete on every object with one call into the C API.
+    /// Returns how many calls ran; fewer than objects if one failed
+    @discardableResult
+    public static func Complete(_ objects: [Task]) -> Int {
+        let handles = objects.map { ITask_Handle($0.handle) }
+        return withExtendedLifetime(objects) {
+            ITask_Complete_Batch(handles, handles.count)
+        }
+    }
+    
+    /// Calls Cancel on every object with one call into the C API.
+    /// Returns how many calls ran; fewer than objects if one failed
+    @discardableResult
+    public static func Cancel(_ objects: [Task]) -> Int {
+        let handles = objects.map { ITask_Handle($0.handle) }
+        return withExtendedLifetime(objects) {
+            ITask_Cancel_Batch(handles, handles.count)
+        }
+    }
+    
+    /// Calls IsOverdue on every object with one call into the C API.
+    /// The result is shorter than objects if a call failed (see getLastError())
+    public static func IsOverdue(_ objects: [Task]) -> [Bool] {
+        let handles = objects.map { ITask_Handle($0.handle) }
+        return withExtendedLifetime(objects) {
+            [Bool](unsafeUninitializedCapacity: handles.count) { buffer, initializedCount in
+                initializedCount = ITask_IsOverdue_Batch(handles, handles.count, buffer.baseAddress)
             }
         }
     }
@@ -137,7 +267,6 @@ public class Task {
 /// IProject wrapper class
 public class Project {
     internal let handle: OpaquePointer
-    private var isOwned: Bool
     
     /// Initialize with a new instance
     public init() {
@@ -145,53 +274,40 @@ public class Project {
             fatalError("Failed to create IProject instance")
         }
         self.handle = h
-        self.isOwned = true
     }
     
-    /// Initialize with existing handle (does not take ownership)
+    /// Initialize with a handle returned by the C API, taking over the
+    /// reference it carries
     internal init(handle: OpaquePointer) {
         self.handle = handle
-        self.isOwned = false
-        IProject_AddRef(handle)
     }
     
     deinit {
-        if isOwned {
-            IProject_Release(handle)
-        }
+        IProject_Release(handle)
     }
     
     /// id property
-    public var id: String {
-        guard let cString = IProject_Getid(handle) else {
-            return ""
-        }
-        return String(cString: cString)
+    public var id: TaskManagerId {
+        return TaskManagerId(handle: IProject_Getid(handle))
     }
     
     /// name property
     public var name: String {
         get {
-            guard let cString = IProject_Getname(handle) else {
-                return ""
-            }
-            return String(cString: cString)
+            return takeString(IProject_Getname(handle)) ?? ""
         }
         set {
-            IProject_Setname(handle, newValue)
+            withStringView(newValue) { IProject_Setname_View(handle, $0) }
         }
     }
     
     /// description property
     public var description: String {
         get {
-            guard let cString = IProject_Getdescription(handle) else {
-                return ""
-            }
-            return String(cString: cString)
+            return takeString(IProject_Getdescription(handle)) ?? ""
         }
         set {
-            IProject_Setdescription(handle, newValue)
+            withStringView(newValue) { IProject_Setdescription_View(handle, $0) }
         }
     }
     
@@ -205,6 +321,74 @@ public class Project {
         }
     }
     
+    /// Readable properties of a Project, captured together
+    public struct Snapshot {
+        public let id: TaskManagerId
+        public let name: String
+        public let description: String
+        public let active: Bool
+    }
+    
+    /// Reads the snapshot properties with a single call into the C API, or
+    /// returns nil if a getter failed (see getLastError())
+    public func snapshot() -> Snapshot? {
+        var raw = IProject_Snapshot_t()
+        guard IProject_Snapshot(handle, &raw) else {
+            return nil
+        }
+        defer { IProject_Snapshot_Release(&raw) }
+        return Snapshot(
+            id: TaskManagerId(handle: raw.id),
+            name: makeString(raw.name),
+            description: makeString(raw.description),
+            active: raw.active
+        )
+    }
+    
+    /// Reads active from every object with one call into the C API.
+    /// The result is shorter than objects if a getter failed (see getLastError())
+    public static func active(of objects: [Project]) -> [Bool] {
+        let handles = objects.map { IProject_Handle($0.handle) }
+        return withExtendedLifetime(objects) {
+            [Bool](unsafeUninitializedCapacity: handles.count) { buffer, initializedCount in
+                initializedCount = IProject_Getactive_Batch(handles, handles.count, buffer.baseAddress)
+            }
+        }
+    }
+    
+    /// Sets active on every object with one call into the C API and
+    /// returns how many were set
+    @discardableResult
+    public static func setActive(of objects: [Project], to values: [Bool]) -> Int {
+        precondition(values.count == objects.count, "One value per object")
+        let handles = objects.map { IProject_Handle($0.handle) }
+        return withExtendedLifetime(objects) {
+            IProject_Setactive_Batch(handles, handles.count, values)
+        }
+    }
+    
+    /// Calls GetTaskCount on every object with one call into the C API.
+    /// The result is shorter than objects if a call failed (see getLastError())
+    public static func GetTaskCount(_ objects: [Project]) -> [Int32] {
+        let handles = objects.map { IProject_Handle($0.handle) }
+        return withExtendedLifetime(objects) {
+            [Int32](unsafeUninitializedCapacity: handles.count) { buffer, initializedCount in
+                initializedCount = IProject_GetTaskCount_Batch(handles, handles.count, buffer.baseAddress)
+            }
+        }
+    }
+    
+    /// Calls GetCompletedCount on every object with one call into the C API.
+    /// The result is shorter than objects if a call failed (see getLastError())
+    public static func GetCompletedCount(_ objects: [Project]) -> [Int32] {
+        let handles = objects.map { IProject_Handle($0.handle) }
+        return withExtendedLifetime(objects) {
+            [Int32](unsafeUninitializedCapacity: handles.count) { buffer, initializedCount in
+                initializedCount = IProject_GetCompletedCount_Batch(handles, handles.count, buffer.baseAddress)
+            }
+        }
+    }
+    
     /// CreateTask method
     public func CreateTask(title: String, description: String) -> Task {
         guard let h = IProject_CreateTask(
@@ -215,27 +399,53 @@ public class Project {
     }
     
     /// GetTask method
-    public func GetTask(taskId: String) -> Task? {
+    public func GetTask(taskId: TaskManagerId) -> Task? {
         guard let h = IProject_GetTask(
-            handle, taskId) else {
+            handle, taskId.handle) else {
             return nil
         }
         return Task(handle: h)
     }
     
     /// GetTasks method
-    // TODO: Implement method GetTasks with return type line=None column=None element_type=TypeRef(line=None, column=None, name='ITask')
+    /// Produces the results while they are iterated, reading them from the
+    /// C API a chunk at a time
+    public func GetTasks() -> TaskManagerStream<Task> {
+        let stream = IProject_GetTasks(
+            handle)
+        // Handles are borrowed from the chunk, so each object takes a reference
+        return TaskManagerStream(stream, as: ITask_Handle?.self) { raw in
+            raw.map { item in
+                ITask_AddRef(item)
+                return Task(handle: OpaquePointer(item))
+            }
+        }
+    }
     
     /// GetTasksByStatus method
-    public func GetTasksByStatus(status: Status) -> [Task] {
-        // TODO: Implement method with complex return type
-        fatalError("Not implemented")
+    /// Produces the results while they are iterated, reading them from the
+    /// C API a chunk at a time
+    public func GetTasksByStatus(status: Status) -> TaskManagerStream<Task> {
+        let stream = IProject_GetTasksByStatus(
+            handle, status.cValue)
+        // Handles are borrowed from the chunk, so each object takes a reference
+        return TaskManagerStream(stream, as: ITask_Handle?.self) { raw in
+            raw.map { item in
+                ITask_AddRef(item)
+                return Task(handle: OpaquePointer(item))
+            }
+        }
     }
     
     /// DeleteTask method
-    public func DeleteTask(taskId: String) -> Bool {
+    public func DeleteTask(taskId: TaskManagerId) -> Bool {
         return IProject_DeleteTask(
-            handle, taskId)
+            handle, taskId.handle)
+    }
+    
+    /// GetTaskSummaries method
+    public func GetTaskSummaries() -> [TaskSummary] {
+        return takePackedArray(IProject_GetTaskSummaries(handle), as: TaskSummary.self)
     }
     
     /// GetTaskCount method
@@ -251,12 +461,45 @@ public class Project {
     /// GetTaskCountByStatus method
     // TODO: Implement method GetTaskCountByStatus with return type line=None column=None key_type=PrimitiveType(line=None, column=None, name='string_t') value_type=PrimitiveType(line=None, column=None, name='int32_t')
     
+    /// Subscribes to the TaskCountChanged event; see dispatchEvents(). The
+    /// subscription is inert if subscribing fails (see getLastError()).
+    public func onTaskCountChanged(_ handler: @escaping (Int32) -> Void) -> EventSubscription {
+        typealias Handler = (Int32) -> Void
+        let context = Unmanaged.passRetained(EventHandler<Handler>(handler)).toOpaque()
+        let callback: IProject_TaskCountChanged_Callback = { context, count in
+            let handler = Unmanaged<EventHandler<Handler>>.fromOpaque(context!).takeUnretainedValue().handler
+            handler(count)
+        }
+        let subscription = IProject_TaskCountChanged_Subscribe(handle, callback, context)
+        guard subscription != 0 else {
+            Unmanaged<EventHandler<Handler>>.fromOpaque(context).release()
+            return EventSubscription(nil)
+        }
+        return EventSubscription { [self] in
+            _ = IProject_TaskCountChanged_Unsubscribe(handle, subscription)
+            Unmanaged<EventHandler<Handler>>.fromOpaque(context).release()
+        }
+    }
+    
+    #if canImport(Combine)
+    /// TaskCountChanged events, subscribed while the publisher has a subscriber
+    public func taskCountChangedPublisher() -> AnyPublisher<Int32, Never> {
+        Deferred { [self] () -> AnyPublisher<Int32, Never> in
+            let subject = PassthroughSubject<Int32, Never>()
+            let subscription = onTaskCountChanged { count in subject.send(count) }
+            return subject
+                .handleEvents(receiveCancel: { subscription.cancel() })
+                .eraseToAnyPublisher()
+        }
+        .eraseToAnyPublisher()
+    }
+    #endif
+    
 }
 
 /// ITaskManager wrapper class
 public class TaskManager {
     internal let handle: OpaquePointer
-    private var isOwned: Bool
     
     /// Initialize with a new instance
     public init() {
@@ -264,20 +507,16 @@ public class TaskManager {
             fatalError("Failed to create ITaskManager instance")
         }
         self.handle = h
-        self.isOwned = true
     }
     
-    /// Initialize with existing handle (does not take ownership)
+    /// Initialize with a handle returned by the C API, taking over the
+    /// reference it carries
     internal init(handle: OpaquePointer) {
         self.handle = handle
-        self.isOwned = false
-        ITaskManager_AddRef(handle)
     }
     
     deinit {
-        if isOwned {
-            ITaskManager_Release(handle)
-        }
+        ITaskManager_Release(handle)
     }
     
     /// CreateProject method
@@ -311,10 +550,7 @@ public class TaskManager {
     }
     
     /// SearchTasks method
-    public func SearchTasks(query: String) -> [Task] {
-        // TODO: Implement method with complex return type
-        fatalError("Not implemented")
-    }
+    // TODO: Implement async method SearchTasks with return type line=None column=None element_type=TypeRef(line=None, column=None, name='ITask')
     
     /// GetTasksByPriority method
     public func GetTasksByPriority(priority: Priority) -> [Task] {
@@ -335,15 +571,45 @@ public class TaskManager {
     }
     
     /// Save method
-    public func Save(path: String) {
-        ITaskManager_Save(
-            handle, path)
+    /// Resumes once the C++ future has completed; throws TaskManagerError if it failed
+    public func Save(path: String) async throws {
+        try await withCheckedThrowingContinuation { (continuation: CheckedContinuation<Void, Error>) in
+            let context = Unmanaged.passRetained(AsyncCompletion(continuation)).toOpaque()
+            let started = ITaskManager_Save(
+                handle,
+                path,
+                { context, code in
+                    let completion = Unmanaged<AsyncCompletion<Void>>.fromOpaque(context!).takeRetainedValue()
+                    completion.finish(code) { () }
+                },
+                context
+            )
+            if !started {
+                Unmanaged<AsyncCompletion<Void>>.fromOpaque(context).release()
+                continuation.resume(throwing: TaskManagerError(code: TASKMANAGER_ERROR_EXCEPTION, message: getLastError()))
+            }
+        }
     }
     
     /// Load method
-    public func Load(path: String) {
-        ITaskManager_Load(
-            handle, path)
+    /// Resumes once the C++ future has completed; throws TaskManagerError if it failed
+    public func Load(path: String) async throws {
+        try await withCheckedThrowingContinuation { (continuation: CheckedContinuation<Void, Error>) in
+            let context = Unmanaged.passRetained(AsyncCompletion(continuation)).toOpaque()
+            let started = ITaskManager_Load(
+                handle,
+                path,
+                { context, code in
+                    let completion = Unmanaged<AsyncCompletion<Void>>.fromOpaque(context!).takeRetainedValue()
+                    completion.finish(code) { () }
+                },
+                context
+            )
+            if !started {
+                Unmanaged<AsyncCompletion<Void>>.fromOpaque(context).release()
+                continuation.resume(throwing: TaskManagerError(code: TASKMANAGER_ERROR_EXCEPTION, message: getLastError()))
+            }
+        }
     }
     
 }
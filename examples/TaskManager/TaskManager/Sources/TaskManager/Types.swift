@@ -3,6 +3,9 @@
 
 import Foundation
 import TaskManagerC
+#if canImport(Combine)
+import Combine
+#endif
 
 /// Priority enumeration
 public enum Priority: Int32, CaseIterable {
@@ -11,14 +14,37 @@ public enum Priority: Int32, CaseIterable {
     case high = 2
     case urgent = 3
     
-    /// Initialize from C value
-    public init?(cValue: TaskManager_Priority) {
-        self.init(rawValue: Int32(cValue.rawValue))
+    /// Initialize from C value; nil if it is not a declared case
+    public init?(cValue: TaskManagerC.Priority) {
+        self.init(rawValue: cValue)
+    }
+    
+    /// Initialize from a value the C API returned. C++ implementations only
+    /// hand out declared values, so anything else is a bug in one of them.
+    internal init(checkedCValue cValue: TaskManagerC.Priority) {
+        guard let value = Priority(rawValue: cValue) else {
+            fatalError("\(cValue) is not a Priority value")
+        }
+        self = value
+    }
+    
+    /// Initialize from the name declared in the IDL
+    public init?(name: String) {
+        var value: TaskManagerC.Priority = 0
+        guard Priority_FromString(name, &value) else {
+            return nil
+        }
+        self.init(rawValue: value)
     }
     
     /// Get C value
-    public var cValue: TaskManager_Priority {
-        return TaskManager_Priority(rawValue: CInt(self.rawValue))!
+    public var cValue: TaskManagerC.Priority {
+        return rawValue
+    }
+    
+    /// Name declared in the IDL
+    public var name: String {
+        return String(cString: Priority_ToString(rawValue))
     }
 }
 
@@ -29,14 +55,153 @@ public enum Status: Int32, CaseIterable {
     case completed = 2
     case cancelled = 3
     
-    /// Initialize from C value
-    public init?(cValue: TaskManager_Status) {
-        self.init(rawValue: Int32(cValue.rawValue))
+    /// Initialize from C value; nil if it is not a declared case
+    public init?(cValue: TaskManagerC.Status) {
+        self.init(rawValue: cValue)
+    }
+    
+    /// Initialize from a value the C API returned. C++ implementations only
+    /// hand out declared values, so anything else is a bug in one of them.
+    internal init(checkedCValue cValue: TaskManagerC.Status) {
+        guard let value = Status(rawValue: cValue) else {
+            fatalError("\(cValue) is not a Status value")
+        }
+        self = value
+    }
+    
+    /// Initialize from the name declared in the IDL
+    public init?(name: String) {
+        var value: TaskManagerC.Status = 0
+        guard Status_FromString(name, &value) else {
+            return nil
+        }
+        self.init(rawValue: value)
     }
     
     /// Get C value
-    public var cValue: TaskManager_Status {
-        return TaskManager_Status(rawValue: CInt(self.rawValue))!
+    public var cValue: TaskManagerC.Status {
+        return rawValue
+    }
+    
+    /// Name declared in the IDL
+    public var name: String {
+        return String(cString: Status_ToString(rawValue))
+    }
+}
+
+/// TaskSummary struct, shared with the C API by layout
+public typealias TaskSummary = TaskManagerC.TaskSummary
+
+extension TaskSummary {
+    /// id as a Swift string. Setting it truncates to 39 UTF-8 bytes.
+    public var idString: String {
+        get {
+            return withUnsafeBytes(of: id) { bytes in
+                let length = bytes.firstIndex(of: 0) ?? bytes.count
+                return String(decoding: bytes.prefix(length), as: UTF8.self)
+            }
+        }
+        set {
+            let utf8 = Array(newValue.utf8)
+            withUnsafeMutableBytes(of: &id) { bytes in
+                var length = min(utf8.count, bytes.count - 1)
+                // Never split a UTF-8 sequence when truncating
+                while length > 0 && length < utf8.count && utf8[length] & 0xC0 == 0x80 {
+                    length -= 1
+                }
+                bytes.copyBytes(from: utf8[0..<length])
+                bytes[length] = 0
+            }
+        }
+    }
+}
+
+extension TaskSummary {
+    /// title as a Swift string. Setting it truncates to 119 UTF-8 bytes.
+    public var titleString: String {
+        get {
+            return withUnsafeBytes(of: title) { bytes in
+                let length = bytes.firstIndex(of: 0) ?? bytes.count
+                return String(decoding: bytes.prefix(length), as: UTF8.self)
+            }
+        }
+        set {
+            let utf8 = Array(newValue.utf8)
+            withUnsafeMutableBytes(of: &title) { bytes in
+                var length = min(utf8.count, bytes.count - 1)
+                // Never split a UTF-8 sequence when truncating
+                while length > 0 && length < utf8.count && utf8[length] & 0xC0 == 0x80 {
+                    length -= 1
+                }
+                bytes.copyBytes(from: utf8[0..<length])
+                bytes[length] = 0
+            }
+        }
+    }
+}
+
+/// Copies the packed elements of an array handle without releasing it
+internal func readPackedArray<T>(_ array: TaskManagerArray_Handle?, as type: T.Type) -> [T] {
+    guard let array = array else {
+        return []
+    }
+    let count = TaskManagerArray_Count(array)
+    guard count > 0, let data = TaskManagerArray_Data(array) else {
+        return []
+    }
+    return Array(UnsafeBufferPointer(start: data.assumingMemoryBound(to: T.self), count: count))
+}
+
+/// Copies the packed elements of an array handle in one pass and releases it
+internal func takePackedArray<T>(_ array: TaskManagerArray_Handle?, as type: T.Type) -> [T] {
+    defer {
+        if let array = array {
+            TaskManagerArray_Release(array)
+        }
+    }
+    return readPackedArray(array, as: type)
+}
+
+/// Copies the strings of an array handle without releasing it
+internal func readStringArray(_ array: TaskManagerArray_Handle?) -> [String] {
+    guard let array = array else {
+        return []
+    }
+    let count = TaskManagerArray_Count(array)
+    var views = [TaskManager_StringView](repeating: TaskManager_StringView(), count: count)
+    let copied = TaskManagerArray_GetItems(array, 0, count, &views)
+    return views.prefix(copied).map(makeString)
+}
+
+/// Decodes a string view by its length, without scanning for the terminator
+internal func makeString(_ view: TaskManager_StringView) -> String {
+    guard let data = view.data, view.length > 0 else {
+        return ""
+    }
+    return String(decoding: UnsafeRawBufferPointer(start: data, count: view.length), as: UTF8.self)
+}
+
+/// Decodes a string handle by its length and releases it; nil for a null handle
+internal func takeString(_ string: IDynamicString_Handle?) -> String? {
+    guard let string = string else {
+        return nil
+    }
+    defer { IDynamicString_Release(string) }
+    guard let data = IDynamicString_GetValue(string) else {
+        return ""
+    }
+    return String(decoding: UnsafeRawBufferPointer(start: data, count: IDynamicString_GetLength(string)), as: UTF8.self)
+}
+
+/// Calls body with a view of the UTF-8 bytes of string. Native strings are
+/// viewed in place; the view is only valid while body runs.
+internal func withStringView<R>(_ string: String, _ body: (TaskManager_StringView) throws -> R) rethrows -> R {
+    var string = string
+    return try string.withUTF8 { bytes in
+        try body(TaskManager_StringView(
+            data: bytes.baseAddress.map { UnsafeRawPointer($0).assumingMemoryBound(to: CChar.self) },
+            length: bytes.count
+        ))
     }
 }
 
@@ -54,4 +219,183 @@ public func getLastError() -> String? {
 /// Clear the last error
 public func clearError() {
     TaskManager_ClearError()
-}
\ No newline at end of file
+}
+// MARK: - Async Calls
+
+/// Error thrown by an async call that failed on the C++ side
+public struct TaskManagerError: Error {
+    public let code: TaskManager_ErrorCode
+    public let message: String?
+}
+
+/// Carries the continuation of an async call through the context pointer
+/// of its C callback
+internal final class AsyncCompletion<T> {
+    private let continuation: CheckedContinuation<T, Error>
+
+    init(_ continuation: CheckedContinuation<T, Error>) {
+        self.continuation = continuation
+    }
+
+    /// Resumes with value() if the call succeeded, or throws its error
+    func finish(_ code: TaskManager_ErrorCode, _ value: () -> T) {
+        if code == TASKMANAGER_OK {
+            continuation.resume(returning: value())
+        } else {
+            continuation.resume(throwing: TaskManagerError(code: code, message: getLastError()))
+        }
+    }
+}
+
+// MARK: - Ids
+
+/// Interned identifier (id_t). Equal strings intern to the same entry, so
+/// ids compare and hash without touching their text, and reading one never
+/// allocates on the C++ side. The default value is the empty id.
+public struct TaskManagerId: Hashable, CustomStringConvertible, ExpressibleByStringLiteral {
+    internal let handle: TaskManager_Id
+
+    /// Initialize with a handle returned by the C API; ids are never released
+    internal init(handle: TaskManager_Id) {
+        self.handle = handle
+    }
+
+    /// The empty id
+    public init() {
+        self.handle = nil
+    }
+
+    /// Interns value, adding it to the table the first time it is seen
+    public init(_ value: String) {
+        self.handle = TaskManager_InternId(value)
+    }
+
+    public init(stringLiteral value: String) {
+        self.init(value)
+    }
+
+    /// The id of value if it was interned before, without adding it
+    public static func find(_ value: String) -> TaskManagerId? {
+        if value.isEmpty {
+            return TaskManagerId()
+        }
+        return TaskManager_FindId(value).map { TaskManagerId(handle: $0) }
+    }
+
+    public var string: String {
+        return String(cString: TaskManager_GetIdValue(handle))
+    }
+
+    public var isEmpty: Bool {
+        return handle == nil
+    }
+
+    public var description: String {
+        return string
+    }
+
+    public static func == (lhs: TaskManagerId, rhs: TaskManagerId) -> Bool {
+        return lhs.handle == rhs.handle
+    }
+
+    public func hash(into hasher: inout Hasher) {
+        hasher.combine(TaskManager_GetIdHash(handle))
+    }
+}
+
+// MARK: - Events
+
+/// Runs the handlers of the events posted since the last call, on the
+/// calling thread; call it once per frame or tick. Each posted event is
+/// delivered once with its latest arguments. Events the implementation
+/// emits directly reach their handlers right away, on the emitting thread.
+/// Returns the number of events delivered.
+@discardableResult
+public func dispatchEvents() -> Int {
+    return TaskManager_DispatchEvents()
+}
+
+/// Keeps an event handler subscribed until it is cancelled or released.
+/// The object stays alive while it has subscriptions.
+public final class EventSubscription {
+    private var unsubscribe: (() -> Void)?
+
+    internal init(_ unsubscribe: (() -> Void)?) {
+        self.unsubscribe = unsubscribe
+    }
+
+    deinit {
+        cancel()
+    }
+
+    /// Unsubscribes the handler; it is not called afterwards
+    public func cancel() {
+        unsubscribe?()
+        unsubscribe = nil
+    }
+}
+
+#if canImport(Combine)
+extension EventSubscription: Cancellable {}
+#endif
+
+/// Carries an event handler through the context pointer of its C callback
+internal final class EventHandler<Handler> {
+    let handler: Handler
+
+    init(_ handler: Handler) {
+        self.handler = handler
+    }
+}
+
+// MARK: - Streams
+
+/// Items of a stream method, pulled from the C API a chunk at a time while
+/// the sequence is iterated. A stream can be iterated once; it ends early
+/// if reading fails (see getLastError()).
+public final class TaskManagerStream<Element>: Sequence, IteratorProtocol {
+    private var handle: TaskManagerStream_Handle?
+    private let pull: (TaskManagerStream_Handle) -> (items: [Element], more: Bool)
+    private var chunk: [Element] = []
+    private var index = 0
+
+    /// Reads chunks of chunkSize Raw values, decoding them before the next
+    /// read invalidates borrowed strings and handles
+    internal init<Raw>(
+        _ handle: TaskManagerStream_Handle?,
+        as raw: Raw.Type,
+        chunkSize: Int = 256,
+        decode: @escaping (Raw) -> Element?
+    ) {
+        self.handle = handle
+        self.pull = { handle in
+            let values = [Raw](unsafeUninitializedCapacity: chunkSize) { buffer, initializedCount in
+                initializedCount = TaskManagerStream_Next(handle, buffer.baseAddress, chunkSize)
+            }
+            return (values.compactMap(decode), values.count == chunkSize)
+        }
+    }
+
+    deinit {
+        if let handle = handle {
+            TaskManagerStream_Release(handle)
+        }
+    }
+
+    public func next() -> Element? {
+        while index == chunk.count {
+            guard let current = handle else {
+                return nil
+            }
+            let (items, more) = pull(current)
+            if !more {
+                TaskManagerStream_Release(current)
+                handle = nil
+            }
+            chunk = items
+            index = 0
+        }
+        defer { index += 1 }
+        return chunk[index]
+    }
+}
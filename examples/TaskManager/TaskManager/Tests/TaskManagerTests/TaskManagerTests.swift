@@ -150,6 +150,10 @@ final class TaskManagerTests: XCTestCase {
     func testProjectGetTasksMethod() throws {
         let obj = Project()
         
+    }
+    func testProjectGetTaskSummariesMethod() throws {
+        let obj = Project()
+        
     }
     func testProjectGetTaskCountMethod() throws {
         let obj = Project()
@@ -212,6 +216,11 @@ final class TaskManagerTests: XCTestCase {
         let cValue = testCase.cValue
         let reconstructed = Priority(cValue: cValue)
         XCTAssertEqual(testCase, reconstructed)
+        
+        // Test name lookup
+        XCTAssertEqual(testCase.name, "LOW")
+        XCTAssertEqual(Priority(name: testCase.name), testCase)
+        XCTAssertNil(Priority(name: ""))
     }
     func testStatusEnum() throws {
         // Test all enum cases
@@ -228,6 +237,29 @@ final class TaskManagerTests: XCTestCase {
         let cValue = testCase.cValue
         let reconstructed = Status(cValue: cValue)
         XCTAssertEqual(testCase, reconstructed)
+        
+        // Test name lookup
+        XCTAssertEqual(testCase.name, "PENDING")
+        XCTAssertEqual(Status(name: testCase.name), testCase)
+        XCTAssertNil(Status(name: ""))
+    }
+    
+    // MARK: - Event Tests
+    
+    func testDispatchEventsWithNothingPosted() throws {
+        dispatchEvents()
+        XCTAssertEqual(dispatchEvents(), 0)
+    }
+    
+    // MARK: - Id Tests
+    
+    func testIdInterning() throws {
+        let id = TaskManagerId("alpha")
+        XCTAssertEqual(id, "alpha")
+        XCTAssertEqual(id.string, "alpha")
+        XCTAssertEqual(TaskManagerId.find("alpha"), id)
+        XCTAssertTrue(TaskManagerId().isEmpty)
+        XCTAssertEqual(TaskManagerId().string, "")
     }
     
     // MARK: - Error Handling Tests
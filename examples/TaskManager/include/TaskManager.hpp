@@ -8,6 +8,7 @@
 #include <unordered_map>
 #include <unordered_set>
 #include <cstdint>
+#include <future>
 #include "minimidl_runtime.hpp"
 
 namespace TaskManager {
@@ -29,21 +30,29 @@ enum class Status : int32_t {
     CANCELLED = 3,
 };
 
+struct TaskSummary {
+    Priority priority;
+    Status status;
+    bool overdue;
+    minimidl::fixed_string<40> id;
+    minimidl::fixed_string<120> title;
+};
+static_assert(std::is_standard_layout_v<TaskSummary> && std::is_trivially_copyable_v<TaskSummary>,
+              "TaskSummary is passed to C and Swift by layout");
+
 
 
-class ITask {
+class ITask : public virtual minimidl::RefCounted {
 public:
-    virtual ~ITask() = default;
-    
-    virtual std::string get_id() const = 0;
+    virtual minimidl::id get_id() const = 0;
     virtual std::string get_title() const = 0;
     virtual std::string get_created_at() const = 0;
     virtual std::string get_description() const = 0;
     virtual void set_description(const std::string& value) = 0;
     virtual Priority get_priority() const = 0;
-    virtual void set_priority(const Priority& value) = 0;
+    virtual void set_priority(Priority value) = 0;
     virtual Status get_status() const = 0;
-    virtual void set_status(const Status& value) = 0;
+    virtual void set_status(Status value) = 0;
     virtual std::string get_due_date() const = 0;
     virtual void set_due_date(const std::string& value) = 0;
     virtual std::vector<std::string> get_tags() const = 0;
@@ -54,13 +63,145 @@ public:
     virtual bool IsOverdue() = 0;
     virtual std::unordered_map<std::string, std::string> GetMetadata() = 0;
     virtual void SetMetadata(const std::string& key, const std::string& value) = 0;
+
+protected:
+    // Destroyed through Release() once the last reference is gone
+    ~ITask() override = default;
 };
 
-class IProject {
+// Shares an ITask between threads. [immutable] properties are read
+// once on construction and [readmostly] ones from a published copy, both
+// without locking. The copy is republished when a [readmostly] property is
+// set or a method is called through the wrapper; call refresh() after
+// changing the wrapped object directly. Other calls are serialised by a
+// mutex.
+class ITaskShared final : public ITask {
 public:
-    virtual ~IProject() = default;
-    
-    virtual std::string get_id() const = 0;
+    explicit ITaskShared(minimidl::object_ptr<ITask> inner)
+        : m_inner(checked(std::move(inner)))
+        , m_id(m_inner->get_id())
+        , m_created_at(m_inner->get_created_at())
+        , m_status(m_inner->get_status())
+    {
+    }
+
+    minimidl::id get_id() const override { return m_id; }
+    std::string get_title() const override {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_inner->get_title();
+    }
+    std::string get_created_at() const override { return m_created_at; }
+    std::string get_description() const override {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_inner->get_description();
+    }
+    void set_description(const std::string& value) override {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_inner->set_description(value);
+    }
+    Priority get_priority() const override {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_inner->get_priority();
+    }
+    void set_priority(Priority value) override {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_inner->set_priority(value);
+    }
+    Status get_status() const override { return m_status.load(); }
+    void set_status(Status value) override {
+        m_status.update([&] {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_inner->set_status(value);
+            return m_inner->get_status();
+        });
+    }
+    std::string get_due_date() const override {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_inner->get_due_date();
+    }
+    void set_due_date(const std::string& value) override {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_inner->set_due_date(value);
+    }
+    std::vector<std::string> get_tags() const override {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_inner->get_tags();
+    }
+    void set_tags(const std::vector<std::string>& value) override {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_inner->set_tags(value);
+    }
+
+    void Complete() override {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_inner->Complete();
+        }
+        refresh();
+    }
+
+    void Cancel() override {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_inner->Cancel();
+        }
+        refresh();
+    }
+
+    bool IsOverdue() override {
+        auto result = [&] {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            return m_inner->IsOverdue();
+        }();
+        refresh();
+        return result;
+    }
+
+    std::unordered_map<std::string, std::string> GetMetadata() override {
+        auto result = [&] {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            return m_inner->GetMetadata();
+        }();
+        refresh();
+        return result;
+    }
+
+    void SetMetadata(const std::string& key, const std::string& value) override {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_inner->SetMetadata(key, value);
+        }
+        refresh();
+    }
+
+    // Republishes the [readmostly] properties from the wrapped object
+    void refresh() {
+        m_status.update([&] {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            return m_inner->get_status();
+        });
+    }
+
+    const minimidl::object_ptr<ITask>& inner() const noexcept { return m_inner; }
+
+private:
+    static minimidl::object_ptr<ITask> checked(minimidl::object_ptr<ITask> inner) {
+        if (!inner) {
+            throw minimidl::null_pointer_exception("ITaskShared");
+        }
+        return inner;
+    }
+
+    minimidl::object_ptr<ITask> m_inner;
+    mutable std::mutex m_mutex;
+    const minimidl::id m_id;
+    const std::string m_created_at;
+    minimidl::read_mostly<Status> m_status;
+};
+
+class IProject : public virtual minimidl::RefCounted {
+public:
+    virtual minimidl::id get_id() const = 0;
     virtual std::string get_name() const = 0;
     virtual void set_name(const std::string& value) = 0;
     virtual std::string get_description() const = 0;
@@ -68,33 +209,154 @@ public:
     virtual bool get_active() const = 0;
     virtual void set_active(bool value) = 0;
     
-    virtual ITask CreateTask(const std::string& title, const std::string& description) = 0;
-    virtual std::shared_ptr<ITask> GetTask(const std::string& taskId) = 0;
-    virtual std::vector<ITask> GetTasks() = 0;
-    virtual std::vector<ITask> GetTasksByStatus(const Status& status) = 0;
-    virtual bool DeleteTask(const std::string& taskId) = 0;
+    virtual minimidl::object_ptr<ITask> CreateTask(const std::string& title, const std::string& description) = 0;
+    virtual minimidl::object_ptr<ITask> GetTask(minimidl::id taskId) = 0;
+    virtual minimidl::stream<minimidl::object_ptr<ITask>> GetTasks() = 0;
+    virtual minimidl::stream<minimidl::object_ptr<ITask>> GetTasksByStatus(Status status) = 0;
+    virtual bool DeleteTask(minimidl::id taskId) = 0;
+    virtual std::vector<TaskSummary> GetTaskSummaries() = 0;
     virtual int32_t GetTaskCount() = 0;
     virtual int32_t GetCompletedCount() = 0;
     virtual std::unordered_map<std::string, int32_t> GetTaskCountByStatus() = 0;
+
+    // Events: subscribe() to them, and emit() or post() them from the
+    // implementation; see minimidl::event
+    using TaskCountChangedEvent = minimidl::event<int32_t>;
+    virtual TaskCountChangedEvent& TaskCountChanged() noexcept { return m_TaskCountChanged; }
+
+protected:
+    // Destroyed through Release() once the last reference is gone
+    ~IProject() override = default;
+
+private:
+    TaskCountChangedEvent m_TaskCountChanged;
 };
 
-class ITaskManager {
+class ITaskManager : public virtual minimidl::RefCounted {
 public:
-    virtual ~ITaskManager() = default;
     
-    
-    virtual IProject CreateProject(const std::string& name) = 0;
-    virtual std::shared_ptr<IProject> GetProject(const std::string& projectId) = 0;
-    virtual std::vector<IProject> GetProjects() = 0;
-    virtual std::vector<IProject> GetActiveProjects() = 0;
+    virtual minimidl::object_ptr<IProject> CreateProject(const std::string& name) = 0;
+    virtual minimidl::object_ptr<IProject> GetProject(const std::string& projectId) = 0;
+    virtual std::vector<minimidl::object_ptr<IProject>> GetProjects() = 0;
+    virtual std::vector<minimidl::object_ptr<IProject>> GetActiveProjects() = 0;
     virtual bool DeleteProject(const std::string& projectId) = 0;
-    virtual std::vector<ITask> SearchTasks(const std::string& query) = 0;
-    virtual std::vector<ITask> GetTasksByPriority(const Priority& priority) = 0;
-    virtual std::vector<ITask> GetOverdueTasks() = 0;
+    virtual std::future<std::vector<minimidl::object_ptr<ITask>>> SearchTasks(const std::string& query) = 0;
+    virtual std::vector<minimidl::object_ptr<ITask>> GetTasksByPriority(Priority priority) = 0;
+    virtual std::vector<minimidl::object_ptr<ITask>> GetOverdueTasks() = 0;
     virtual std::unordered_map<std::string, std::string> GetSettings() = 0;
     virtual void UpdateSettings(const std::unordered_map<std::string, std::string>& settings) = 0;
-    virtual void Save(const std::string& path) = 0;
-    virtual void Load(const std::string& path) = 0;
+    virtual std::future<void> Save(const std::string& path) = 0;
+    virtual std::future<void> Load(const std::string& path) = 0;
+
+protected:
+    // Destroyed through Release() once the last reference is gone
+    ~ITaskManager() override = default;
 };
 
 } // namespace TaskManager
+
+// Compile-time descriptors of TaskManager
+namespace minimidl {
+
+template<>
+struct descriptor<TaskManager::Priority> {
+    static constexpr std::string_view name = "Priority";
+    static constexpr std::array<TaskManager::Priority, 4> values = {
+        TaskManager::Priority::LOW,
+        TaskManager::Priority::MEDIUM,
+        TaskManager::Priority::HIGH,
+        TaskManager::Priority::URGENT,
+    };
+    static constexpr std::array<std::string_view, 4> names = {
+        "LOW",
+        "MEDIUM",
+        "HIGH",
+        "URGENT",
+    };
+    static constexpr bool contiguous = detail::is_contiguous(values);
+};
+
+template<>
+struct descriptor<TaskManager::Status> {
+    static constexpr std::string_view name = "Status";
+    static constexpr std::array<TaskManager::Status, 4> values = {
+        TaskManager::Status::PENDING,
+        TaskManager::Status::IN_PROGRESS,
+        TaskManager::Status::COMPLETED,
+        TaskManager::Status::CANCELLED,
+    };
+    static constexpr std::array<std::string_view, 4> names = {
+        "PENDING",
+        "IN_PROGRESS",
+        "COMPLETED",
+        "CANCELLED",
+    };
+    static constexpr bool contiguous = detail::is_contiguous(values);
+};
+
+template<>
+struct descriptor<TaskManager::ITask> {
+    static constexpr std::string_view name = "ITask";
+    static constexpr auto properties = std::make_tuple(
+        property("id", "id_t", &TaskManager::ITask::get_id),
+        property("title", "string_t", &TaskManager::ITask::get_title),
+        property("created_at", "string_t", &TaskManager::ITask::get_created_at),
+        property("description", "string_t", &TaskManager::ITask::get_description, &TaskManager::ITask::set_description),
+        property("priority", "Priority", &TaskManager::ITask::get_priority, &TaskManager::ITask::set_priority),
+        property("status", "Status", &TaskManager::ITask::get_status, &TaskManager::ITask::set_status),
+        property("due_date", "string_t", &TaskManager::ITask::get_due_date, &TaskManager::ITask::set_due_date),
+        property("tags", "string_t[]", &TaskManager::ITask::get_tags, &TaskManager::ITask::set_tags)
+    );
+    static constexpr auto methods = std::make_tuple(
+        method("Complete", "void", &TaskManager::ITask::Complete),
+        method("Cancel", "void", &TaskManager::ITask::Cancel),
+        method("IsOverdue", "bool", &TaskManager::ITask::IsOverdue),
+        method("GetMetadata", "dict<string_t, string_t>", &TaskManager::ITask::GetMetadata),
+        method("SetMetadata", "void", &TaskManager::ITask::SetMetadata, "key", "value")
+    );
+};
+
+template<>
+struct descriptor<TaskManager::IProject> {
+    static constexpr std::string_view name = "IProject";
+    static constexpr auto properties = std::make_tuple(
+        property("id", "id_t", &TaskManager::IProject::get_id),
+        property("name", "string_t", &TaskManager::IProject::get_name, &TaskManager::IProject::set_name),
+        property("description", "string_t", &TaskManager::IProject::get_description, &TaskManager::IProject::set_description),
+        property("active", "bool", &TaskManager::IProject::get_active, &TaskManager::IProject::set_active)
+    );
+    static constexpr auto methods = std::make_tuple(
+        method("CreateTask", "ITask", &TaskManager::IProject::CreateTask, "title", "description"),
+        method("GetTask", "ITask?", &TaskManager::IProject::GetTask, "taskId"),
+        method("GetTasks", "stream<ITask>", &TaskManager::IProject::GetTasks),
+        method("GetTasksByStatus", "stream<ITask>", &TaskManager::IProject::GetTasksByStatus, "status"),
+        method("DeleteTask", "bool", &TaskManager::IProject::DeleteTask, "taskId"),
+        method("GetTaskSummaries", "TaskSummary[]", &TaskManager::IProject::GetTaskSummaries),
+        method("GetTaskCount", "int32_t", &TaskManager::IProject::GetTaskCount),
+        method("GetCompletedCount", "int32_t", &TaskManager::IProject::GetCompletedCount),
+        method("GetTaskCountByStatus", "dict<string_t, int32_t>", &TaskManager::IProject::GetTaskCountByStatus)
+    );
+};
+
+template<>
+struct descriptor<TaskManager::ITaskManager> {
+    static constexpr std::string_view name = "ITaskManager";
+    static constexpr auto properties = std::make_tuple(
+    );
+    static constexpr auto methods = std::make_tuple(
+        method("CreateProject", "IProject", &TaskManager::ITaskManager::CreateProject, "name"),
+        method("GetProject", "IProject?", &TaskManager::ITaskManager::GetProject, "projectId"),
+        method("GetProjects", "IProject[]", &TaskManager::ITaskManager::GetProjects),
+        method("GetActiveProjects", "IProject[]", &TaskManager::ITaskManager::GetActiveProjects),
+        method("DeleteProject", "bool", &TaskManager::ITaskManager::DeleteProject, "projectId"),
+        method("SearchTasks", "ITask[]", &TaskManager::ITaskManager::SearchTasks, "query"),
+        method("GetTasksByPriority", "ITask[]", &TaskManager::ITaskManager::GetTasksByPriority, "priority"),
+        method("GetOverdueTasks", "ITask[]", &TaskManager::ITaskManager::GetOverdueTasks),
+        method("GetSettings", "dict<string_t, string_t>", &TaskManager::ITaskManager::GetSettings),
+        method("UpdateSettings", "void", &TaskManager::ITaskManager::UpdateSettings, "settings"),
+        method("Save", "void", &TaskManager::ITaskManager::Save, "path"),
+        method("Load", "void", &TaskManager::ITaskManager::Load, "path")
+    );
+};
+
+} // namespace minimidl
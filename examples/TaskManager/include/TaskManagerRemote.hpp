@@ -0,0 +1,784 @@
+// Generated by MinimIDL
+// DO NOT EDIT - This file was automatically generated
+#pragma once
+
+#include "minimidl_ipc.hpp"
+#include "TaskManagerSerialization.hpp"
+
+namespace TaskManager {
+
+// Runs the calls a client made through ITaskProxy on the real object
+struct ITaskStub {
+    static void dispatch(minimidl::ipc::server& server, minimidl::RefCounted& target, uint32_t member,
+                         minimidl::wire::reader& args, minimidl::wire::writer& reply);
+};
+
+// Runs the calls a client made through IProjectProxy on the real object
+struct IProjectStub {
+    static void dispatch(minimidl::ipc::server& server, minimidl::RefCounted& target, uint32_t member,
+                         minimidl::wire::reader& args, minimidl::wire::writer& reply);
+};
+
+// Runs the calls a client made through ITaskManagerProxy on the real object
+struct ITaskManagerStub {
+    static void dispatch(minimidl::ipc::server& server, minimidl::RefCounted& target, uint32_t member,
+                         minimidl::wire::reader& args, minimidl::wire::writer& reply);
+};
+
+// ITask in a server process, called through a minimidl::ipc::client.
+// Calls without a result are queued and sent with the next call that has
+// one, which also reports their failures.
+class ITaskProxy final : public ITask, public minimidl::ipc::remote_object {
+public:
+    using remote_object::remote_object;
+
+    minimidl::id get_id() const override;
+    std::string get_title() const override;
+    std::string get_created_at() const override;
+    std::string get_description() const override;
+    void set_description(const std::string& value) override;
+    Priority get_priority() const override;
+    void set_priority(Priority value) override;
+    Status get_status() const override;
+    void set_status(Status value) override;
+    std::string get_due_date() const override;
+    void set_due_date(const std::string& value) override;
+    std::vector<std::string> get_tags() const override;
+    void set_tags(const std::vector<std::string>& value) override;
+    void Complete() override;
+    void Cancel() override;
+    bool IsOverdue() override;
+    std::unordered_map<std::string, std::string> GetMetadata() override;
+    void SetMetadata(const std::string& key, const std::string& value) override;
+};
+
+// IProject in a server process, called through a minimidl::ipc::client.
+// Calls without a result are queued and sent with the next call that has
+// one, which also reports their failures.
+// Events are local to the proxy: subscribing to them does not reach the
+// server, and only emit() or post() on the proxy calls its subscribers.
+class IProjectProxy final : public IProject, public minimidl::ipc::remote_object {
+public:
+    using remote_object::remote_object;
+
+    minimidl::id get_id() const override;
+    std::string get_name() const override;
+    void set_name(const std::string& value) override;
+    std::string get_description() const override;
+    void set_description(const std::string& value) override;
+    bool get_active() const override;
+    void set_active(bool value) override;
+    minimidl::object_ptr<ITask> CreateTask(const std::string& title, const std::string& description) override;
+    minimidl::object_ptr<ITask> GetTask(minimidl::id taskId) override;
+    minimidl::stream<minimidl::object_ptr<ITask>> GetTasks() override;
+    minimidl::stream<minimidl::object_ptr<ITask>> GetTasksByStatus(Status status) override;
+    bool DeleteTask(minimidl::id taskId) override;
+    std::vector<TaskSummary> GetTaskSummaries() override;
+    int32_t GetTaskCount() override;
+    int32_t GetCompletedCount() override;
+    std::unordered_map<std::string, int32_t> GetTaskCountByStatus() override;
+};
+
+// ITaskManager in a server process, called through a minimidl::ipc::client.
+// Calls without a result are queued and sent with the next call that has
+// one, which also reports their failures.
+class ITaskManagerProxy final : public ITaskManager, public minimidl::ipc::remote_object {
+public:
+    using remote_object::remote_object;
+
+    minimidl::object_ptr<IProject> CreateProject(const std::string& name) override;
+    minimidl::object_ptr<IProject> GetProject(const std::string& projectId) override;
+    std::vector<minimidl::object_ptr<IProject>> GetProjects() override;
+    std::vector<minimidl::object_ptr<IProject>> GetActiveProjects() override;
+    bool DeleteProject(const std::string& projectId) override;
+    std::future<std::vector<minimidl::object_ptr<ITask>>> SearchTasks(const std::string& query) override;
+    std::vector<minimidl::object_ptr<ITask>> GetTasksByPriority(Priority priority) override;
+    std::vector<minimidl::object_ptr<ITask>> GetOverdueTasks() override;
+    std::unordered_map<std::string, std::string> GetSettings() override;
+    void UpdateSettings(const std::unordered_map<std::string, std::string>& settings) override;
+    std::future<void> Save(const std::string& path) override;
+    std::future<void> Load(const std::string& path) override;
+};
+
+inline minimidl::id ITaskProxy::get_id() const {
+    auto request = remote_client().start(remote_id(), 1);
+    auto& response = request.send();
+    minimidl::id decoded{};
+    decode(response, decoded);
+    return decoded;
+}
+
+inline std::string ITaskProxy::get_title() const {
+    auto request = remote_client().start(remote_id(), 2);
+    auto& response = request.send();
+    std::string decoded{};
+    decode(response, decoded);
+    return decoded;
+}
+
+inline std::string ITaskProxy::get_created_at() const {
+    auto request = remote_client().start(remote_id(), 3);
+    auto& response = request.send();
+    std::string decoded{};
+    decode(response, decoded);
+    return decoded;
+}
+
+inline std::string ITaskProxy::get_description() const {
+    auto request = remote_client().start(remote_id(), 4);
+    auto& response = request.send();
+    std::string decoded{};
+    decode(response, decoded);
+    return decoded;
+}
+
+inline void ITaskProxy::set_description(const std::string& value) {
+    auto request = remote_client().start(remote_id(), 5);
+    encode(request.args(), value);
+    request.post();
+}
+
+inline Priority ITaskProxy::get_priority() const {
+    auto request = remote_client().start(remote_id(), 6);
+    auto& response = request.send();
+    Priority decoded{};
+    decode(response, decoded);
+    return decoded;
+}
+
+inline void ITaskProxy::set_priority(Priority value) {
+    auto request = remote_client().start(remote_id(), 7);
+    encode(request.args(), value);
+    request.post();
+}
+
+inline Status ITaskProxy::get_status() const {
+    auto request = remote_client().start(remote_id(), 8);
+    auto& response = request.send();
+    Status decoded{};
+    decode(response, decoded);
+    return decoded;
+}
+
+inline void ITaskProxy::set_status(Status value) {
+    auto request = remote_client().start(remote_id(), 9);
+    encode(request.args(), value);
+    request.post();
+}
+
+inline std::string ITaskProxy::get_due_date() const {
+    auto request = remote_client().start(remote_id(), 10);
+    auto& response = request.send();
+    std::string decoded{};
+    decode(response, decoded);
+    return decoded;
+}
+
+inline void ITaskProxy::set_due_date(const std::string& value) {
+    auto request = remote_client().start(remote_id(), 11);
+    encode(request.args(), value);
+    request.post();
+}
+
+inline std::vector<std::string> ITaskProxy::get_tags() const {
+    auto request = remote_client().start(remote_id(), 12);
+    auto& response = request.send();
+    std::vector<std::string> decoded{};
+    decode(response, decoded);
+    return decoded;
+}
+
+inline void ITaskProxy::set_tags(const std::vector<std::string>& value) {
+    auto request = remote_client().start(remote_id(), 13);
+    encode(request.args(), value);
+    request.post();
+}
+
+inline void ITaskProxy::Complete() {
+    auto request = remote_client().start(remote_id(), 14);
+    request.post();
+}
+
+inline void ITaskProxy::Cancel() {
+    auto request = remote_client().start(remote_id(), 15);
+    request.post();
+}
+
+inline bool ITaskProxy::IsOverdue() {
+    auto request = remote_client().start(remote_id(), 16);
+    auto& response = request.send();
+    bool decoded{};
+    decode(response, decoded);
+    return decoded;
+}
+
+inline std::unordered_map<std::string, std::string> ITaskProxy::GetMetadata() {
+    auto request = remote_client().start(remote_id(), 17);
+    auto& response = request.send();
+    std::unordered_map<std::string, std::string> decoded{};
+    decode(response, decoded);
+    return decoded;
+}
+
+inline void ITaskProxy::SetMetadata(const std::string& key, const std::string& value) {
+    auto request = remote_client().start(remote_id(), 18);
+    encode(request.args(), key);
+    encode(request.args(), value);
+    request.post();
+}
+
+inline void ITaskStub::dispatch([[maybe_unused]] minimidl::ipc::server& server,
+                                 minimidl::RefCounted& target, uint32_t member,
+                                 [[maybe_unused]] minimidl::wire::reader& args,
+                                 [[maybe_unused]] minimidl::wire::writer& reply) {
+    auto& object = dynamic_cast<ITask&>(target);
+    switch (member) {
+    case 1: {
+        auto result = object.get_id();
+        encode(reply, result);
+        return;
+    }
+    case 2: {
+        auto result = object.get_title();
+        encode(reply, result);
+        return;
+    }
+    case 3: {
+        auto result = object.get_created_at();
+        encode(reply, result);
+        return;
+    }
+    case 4: {
+        auto result = object.get_description();
+        encode(reply, result);
+        return;
+    }
+    case 5: {
+        std::string arg_value{};
+        decode(args, arg_value);
+        object.set_description(arg_value);
+        return;
+    }
+    case 6: {
+        auto result = object.get_priority();
+        encode(reply, result);
+        return;
+    }
+    case 7: {
+        Priority arg_value{};
+        decode(args, arg_value);
+        object.set_priority(arg_value);
+        return;
+    }
+    case 8: {
+        auto result = object.get_status();
+        encode(reply, result);
+        return;
+    }
+    case 9: {
+        Status arg_value{};
+        decode(args, arg_value);
+        object.set_status(arg_value);
+        return;
+    }
+    case 10: {
+        auto result = object.get_due_date();
+        encode(reply, result);
+        return;
+    }
+    case 11: {
+        std::string arg_value{};
+        decode(args, arg_value);
+        object.set_due_date(arg_value);
+        return;
+    }
+    case 12: {
+        auto result = object.get_tags();
+        encode(reply, result);
+        return;
+    }
+    case 13: {
+        std::vector<std::string> arg_value{};
+        decode(args, arg_value);
+        object.set_tags(arg_value);
+        return;
+    }
+    case 14: {
+        object.Complete();
+        return;
+    }
+    case 15: {
+        object.Cancel();
+        return;
+    }
+    case 16: {
+        auto result = object.IsOverdue();
+        encode(reply, result);
+        return;
+    }
+    case 17: {
+        auto result = object.GetMetadata();
+        encode(reply, result);
+        return;
+    }
+    case 18: {
+        std::string arg_key{};
+        decode(args, arg_key);
+        std::string arg_value{};
+        decode(args, arg_value);
+        object.SetMetadata(arg_key, arg_value);
+        return;
+    }
+    }
+    throw minimidl::idl_exception("Unknown member " + std::to_string(member) + " of ITask");
+}
+
+inline minimidl::id IProjectProxy::get_id() const {
+    auto request = remote_client().start(remote_id(), 1);
+    auto& response = request.send();
+    minimidl::id decoded{};
+    decode(response, decoded);
+    return decoded;
+}
+
+inline std::string IProjectProxy::get_name() const {
+    auto request = remote_client().start(remote_id(), 2);
+    auto& response = request.send();
+    std::string decoded{};
+    decode(response, decoded);
+    return decoded;
+}
+
+inline void IProjectProxy::set_name(const std::string& value) {
+    auto request = remote_client().start(remote_id(), 3);
+    encode(request.args(), value);
+    request.post();
+}
+
+inline std::string IProjectProxy::get_description() const {
+    auto request = remote_client().start(remote_id(), 4);
+    auto& response = request.send();
+    std::string decoded{};
+    decode(response, decoded);
+    return decoded;
+}
+
+inline void IProjectProxy::set_description(const std::string& value) {
+    auto request = remote_client().start(remote_id(), 5);
+    encode(request.args(), value);
+    request.post();
+}
+
+inline bool IProjectProxy::get_active() const {
+    auto request = remote_client().start(remote_id(), 6);
+    auto& response = request.send();
+    bool decoded{};
+    decode(response, decoded);
+    return decoded;
+}
+
+inline void IProjectProxy::set_active(bool value) {
+    auto request = remote_client().start(remote_id(), 7);
+    encode(request.args(), value);
+    request.post();
+}
+
+inline minimidl::object_ptr<ITask> IProjectProxy::CreateTask(const std::string& title, const std::string& description) {
+    auto request = remote_client().start(remote_id(), 8);
+    encode(request.args(), title);
+    encode(request.args(), description);
+    auto& response = request.send();
+    return remote_client().read_object<ITask, ITaskProxy>(response);
+}
+
+inline minimidl::object_ptr<ITask> IProjectProxy::GetTask(minimidl::id taskId) {
+    auto request = remote_client().start(remote_id(), 9);
+    encode(request.args(), taskId);
+    auto& response = request.send();
+    return remote_client().read_object<ITask, ITaskProxy>(response);
+}
+
+inline minimidl::stream<minimidl::object_ptr<ITask>> IProjectProxy::GetTasks() {
+    auto request = remote_client().start(remote_id(), 10);
+    auto& response = request.send();
+    std::vector<minimidl::object_ptr<ITask>> decoded(response.read_count());
+    for (auto& item : decoded) {
+        item = remote_client().read_object<ITask, ITaskProxy>(response);
+    }
+    return minimidl::make_stream(std::move(decoded));
+}
+
+inline minimidl::stream<minimidl::object_ptr<ITask>> IProjectProxy::GetTasksByStatus(Status status) {
+    auto request = remote_client().start(remote_id(), 11);
+    encode(request.args(), status);
+    auto& response = request.send();
+    std::vector<minimidl::object_ptr<ITask>> decoded(response.read_count());
+    for (auto& item : decoded) {
+        item = remote_client().read_object<ITask, ITaskProxy>(response);
+    }
+    return minimidl::make_stream(std::move(decoded));
+}
+
+inline bool IProjectProxy::DeleteTask(minimidl::id taskId) {
+    auto request = remote_client().start(remote_id(), 12);
+    encode(request.args(), taskId);
+    auto& response = request.send();
+    bool decoded{};
+    decode(response, decoded);
+    return decoded;
+}
+
+inline std::vector<TaskSummary> IProjectProxy::GetTaskSummaries() {
+    auto request = remote_client().start(remote_id(), 13);
+    auto& response = request.send();
+    std::vector<TaskSummary> decoded{};
+    decode(response, decoded);
+    return decoded;
+}
+
+inline int32_t IProjectProxy::GetTaskCount() {
+    auto request = remote_client().start(remote_id(), 14);
+    auto& response = request.send();
+    int32_t decoded{};
+    decode(response, decoded);
+    return decoded;
+}
+
+inline int32_t IProjectProxy::GetCompletedCount() {
+    auto request = remote_client().start(remote_id(), 15);
+    auto& response = request.send();
+    int32_t decoded{};
+    decode(response, decoded);
+    return decoded;
+}
+
+inline std::unordered_map<std::string, int32_t> IProjectProxy::GetTaskCountByStatus() {
+    auto request = remote_client().start(remote_id(), 16);
+    auto& response = request.send();
+    std::unordered_map<std::string, int32_t> decoded{};
+    decode(response, decoded);
+    return decoded;
+}
+
+inline void IProjectStub::dispatch([[maybe_unused]] minimidl::ipc::server& server,
+                                 minimidl::RefCounted& target, uint32_t member,
+                                 [[maybe_unused]] minimidl::wire::reader& args,
+                                 [[maybe_unused]] minimidl::wire::writer& reply) {
+    auto& object = dynamic_cast<IProject&>(target);
+    switch (member) {
+    case 1: {
+        auto result = object.get_id();
+        encode(reply, result);
+        return;
+    }
+    case 2: {
+        auto result = object.get_name();
+        encode(reply, result);
+        return;
+    }
+    case 3: {
+        std::string arg_value{};
+        decode(args, arg_value);
+        object.set_name(arg_value);
+        return;
+    }
+    case 4: {
+        auto result = object.get_description();
+        encode(reply, result);
+        return;
+    }
+    case 5: {
+        std::string arg_value{};
+        decode(args, arg_value);
+        object.set_description(arg_value);
+        return;
+    }
+    case 6: {
+        auto result = object.get_active();
+        encode(reply, result);
+        return;
+    }
+    case 7: {
+        bool arg_value{};
+        decode(args, arg_value);
+        object.set_active(arg_value);
+        return;
+    }
+    case 8: {
+        std::string arg_title{};
+        decode(args, arg_title);
+        std::string arg_description{};
+        decode(args, arg_description);
+        auto result = object.CreateTask(arg_title, arg_description);
+        server.write_object(reply, result, &ITaskStub::dispatch);
+        return;
+    }
+    case 9: {
+        minimidl::id arg_taskId{};
+        decode(args, arg_taskId);
+        auto result = object.GetTask(arg_taskId);
+        server.write_object(reply, result, &ITaskStub::dispatch);
+        return;
+    }
+    case 10: {
+        auto result = object.GetTasks();
+        auto items = minimidl::ipc::drain(std::move(result));
+        reply.write_varint(items.size());
+        for (const auto& item : items) {
+            server.write_object(reply, item, &ITaskStub::dispatch);
+        }
+        return;
+    }
+    case 11: {
+        Status arg_status{};
+        decode(args, arg_status);
+        auto result = object.GetTasksByStatus(arg_status);
+        auto items = minimidl::ipc::drain(std::move(result));
+        reply.write_varint(items.size());
+        for (const auto& item : items) {
+            server.write_object(reply, item, &ITaskStub::dispatch);
+        }
+        return;
+    }
+    case 12: {
+        minimidl::id arg_taskId{};
+        decode(args, arg_taskId);
+        auto result = object.DeleteTask(arg_taskId);
+        encode(reply, result);
+        return;
+    }
+    case 13: {
+        auto result = object.GetTaskSummaries();
+        encode(reply, result);
+        return;
+    }
+    case 14: {
+        auto result = object.GetTaskCount();
+        encode(reply, result);
+        return;
+    }
+    case 15: {
+        auto result = object.GetCompletedCount();
+        encode(reply, result);
+        return;
+    }
+    case 16: {
+        auto result = object.GetTaskCountByStatus();
+        encode(reply, result);
+        return;
+    }
+    }
+    throw minimidl::idl_exception("Unknown member " + std::to_string(member) + " of IProject");
+}
+
+inline minimidl::object_ptr<IProject> ITaskManagerProxy::CreateProject(const std::string& name) {
+    auto request = remote_client().start(remote_id(), 1);
+    encode(request.args(), name);
+    auto& response = request.send();
+    return remote_client().read_object<IProject, IProjectProxy>(response);
+}
+
+inline minimidl::object_ptr<IProject> ITaskManagerProxy::GetProject(const std::string& projectId) {
+    auto request = remote_client().start(remote_id(), 2);
+    encode(request.args(), projectId);
+    auto& response = request.send();
+    return remote_client().read_object<IProject, IProjectProxy>(response);
+}
+
+inline std::vector<minimidl::object_ptr<IProject>> ITaskManagerProxy::GetProjects() {
+    auto request = remote_client().start(remote_id(), 3);
+    auto& response = request.send();
+    std::vector<minimidl::object_ptr<IProject>> decoded(response.read_count());
+    for (auto& item : decoded) {
+        item = remote_client().read_object<IProject, IProjectProxy>(response);
+    }
+    return decoded;
+}
+
+inline std::vector<minimidl::object_ptr<IProject>> ITaskManagerProxy::GetActiveProjects() {
+    auto request = remote_client().start(remote_id(), 4);
+    auto& response = request.send();
+    std::vector<minimidl::object_ptr<IProject>> decoded(response.read_count());
+    for (auto& item : decoded) {
+        item = remote_client().read_object<IProject, IProjectProxy>(response);
+    }
+    return decoded;
+}
+
+inline bool ITaskManagerProxy::DeleteProject(const std::string& projectId) {
+    auto request = remote_client().start(remote_id(), 5);
+    encode(request.args(), projectId);
+    auto& response = request.send();
+    bool decoded{};
+    decode(response, decoded);
+    return decoded;
+}
+
+inline std::future<std::vector<minimidl::object_ptr<ITask>>> ITaskManagerProxy::SearchTasks(const std::string& query) {
+    return minimidl::ipc::ready_future([&] {
+        auto request = remote_client().start(remote_id(), 6);
+        encode(request.args(), query);
+        auto& response = request.send();
+        std::vector<minimidl::object_ptr<ITask>> decoded(response.read_count());
+        for (auto& item : decoded) {
+            item = remote_client().read_object<ITask, ITaskProxy>(response);
+        }
+        return decoded;
+    });
+}
+
+inline std::vector<minimidl::object_ptr<ITask>> ITaskManagerProxy::GetTasksByPriority(Priority priority) {
+    auto request = remote_client().start(remote_id(), 7);
+    encode(request.args(), priority);
+    auto& response = request.send();
+    std::vector<minimidl::object_ptr<ITask>> decoded(response.read_count());
+    for (auto& item : decoded) {
+        item = remote_client().read_object<ITask, ITaskProxy>(response);
+    }
+    return decoded;
+}
+
+inline std::vector<minimidl::object_ptr<ITask>> ITaskManagerProxy::GetOverdueTasks() {
+    auto request = remote_client().start(remote_id(), 8);
+    auto& response = request.send();
+    std::vector<minimidl::object_ptr<ITask>> decoded(response.read_count());
+    for (auto& item : decoded) {
+        item = remote_client().read_object<ITask, ITaskProxy>(response);
+    }
+    return decoded;
+}
+
+inline std::unordered_map<std::string, std::string> ITaskManagerProxy::GetSettings() {
+    auto request = remote_client().start(remote_id(), 9);
+    auto& response = request.send();
+    std::unordered_map<std::string, std::string> decoded{};
+    decode(response, decoded);
+    return decoded;
+}
+
+inline void ITaskManagerProxy::UpdateSettings(const std::unordered_map<std::string, std::string>& settings) {
+    auto request = remote_client().start(remote_id(), 10);
+    encode(request.args(), settings);
+    request.post();
+}
+
+inline std::future<void> ITaskManagerProxy::Save(const std::string& path) {
+    return minimidl::ipc::ready_future([&] {
+        auto request = remote_client().start(remote_id(), 11);
+        encode(request.args(), path);
+        request.send();
+    });
+}
+
+inline std::future<void> ITaskManagerProxy::Load(const std::string& path) {
+    return minimidl::ipc::ready_future([&] {
+        auto request = remote_client().start(remote_id(), 12);
+        encode(request.args(), path);
+        request.send();
+    });
+}
+
+inline void ITaskManagerStub::dispatch([[maybe_unused]] minimidl::ipc::server& server,
+                                 minimidl::RefCounted& target, uint32_t member,
+                                 [[maybe_unused]] minimidl::wire::reader& args,
+                                 [[maybe_unused]] minimidl::wire::writer& reply) {
+    auto& object = dynamic_cast<ITaskManager&>(target);
+    switch (member) {
+    case 1: {
+        std::string arg_name{};
+        decode(args, arg_name);
+        auto result = object.CreateProject(arg_name);
+        server.write_object(reply, result, &IProjectStub::dispatch);
+        return;
+    }
+    case 2: {
+        std::string arg_projectId{};
+        decode(args, arg_projectId);
+        auto result = object.GetProject(arg_projectId);
+        server.write_object(reply, result, &IProjectStub::dispatch);
+        return;
+    }
+    case 3: {
+        auto result = object.GetProjects();
+        const auto& items = result;
+        reply.write_varint(items.size());
+        for (const auto& item : items) {
+            server.write_object(reply, item, &IProjectStub::dispatch);
+        }
+        return;
+    }
+    case 4: {
+        auto result = object.GetActiveProjects();
+        const auto& items = result;
+        reply.write_varint(items.size());
+        for (const auto& item : items) {
+            server.write_object(reply, item, &IProjectStub::dispatch);
+        }
+        return;
+    }
+    case 5: {
+        std::string arg_projectId{};
+        decode(args, arg_projectId);
+        auto result = object.DeleteProject(arg_projectId);
+        encode(reply, result);
+        return;
+    }
+    case 6: {
+        std::string arg_query{};
+        decode(args, arg_query);
+        auto result = object.SearchTasks(arg_query).get();
+        const auto& items = result;
+        reply.write_varint(items.size());
+        for (const auto& item : items) {
+            server.write_object(reply, item, &ITaskStub::dispatch);
+        }
+        return;
+    }
+    case 7: {
+        Priority arg_priority{};
+        decode(args, arg_priority);
+        auto result = object.GetTasksByPriority(arg_priority);
+        const auto& items = result;
+        reply.write_varint(items.size());
+        for (const auto& item : items) {
+            server.write_object(reply, item, &ITaskStub::dispatch);
+        }
+        return;
+    }
+    case 8: {
+        auto result = object.GetOverdueTasks();
+        const auto& items = result;
+        reply.write_varint(items.size());
+        for (const auto& item : items) {
+            server.write_object(reply, item, &ITaskStub::dispatch);
+        }
+        return;
+    }
+    case 9: {
+        auto result = object.GetSettings();
+        encode(reply, result);
+        return;
+    }
+    case 10: {
+        std::unordered_map<std::string, std::string> arg_settings{};
+        decode(args, arg_settings);
+        object.UpdateSettings(arg_settings);
+        return;
+    }
+    case 11: {
+        std::string arg_path{};
+        decode(args, arg_path);
+        object.Save(arg_path).get();
+        return;
+    }
+    case 12: {
+        std::string arg_path{};
+        decode(args, arg_path);
+        object.Load(arg_path).get();
+        return;
+    }
+    }
+    throw minimidl::idl_exception("Unknown member " + std::to_string(member) + " of ITaskManager");
+}
+
+} // namespace TaskManager
@@ -0,0 +1,152 @@
+// Generated by MinimIDL
+// DO NOT EDIT - This file was automatically generated
+#pragma once
+
+#include <optional>
+#include <string_view>
+#include "TaskManager.hpp"
+
+namespace TaskManager {
+
+// The runtime codecs for primitives and collections, next to the generated
+// ones for this namespace's types
+using minimidl::wire::decode;
+using minimidl::wire::encode;
+
+inline void encode(minimidl::wire::writer& out, const TaskSummary& value) {
+    encode(out, value.priority);
+    encode(out, value.status);
+    encode(out, value.overdue);
+    encode(out, value.id);
+    encode(out, value.title);
+}
+
+inline void decode(minimidl::wire::reader& in, TaskSummary& value) {
+    decode(in, value.priority);
+    decode(in, value.status);
+    decode(in, value.overdue);
+    decode(in, value.id);
+    decode(in, value.title);
+}
+
+// Property values of a ITask, as written by encode(). Object
+// references are not part of the record.
+struct ITaskRecord {
+    minimidl::id id{};
+    std::string title{};
+    std::string created_at{};
+    std::string description{};
+    Priority priority{};
+    Status status{};
+    std::string due_date{};
+    std::vector<std::string> tags{};
+};
+
+// ITaskRecord read in place: strings point into the encoded bytes
+// and collections are decoded on demand, so it is only valid while the
+// bytes are
+struct ITaskView {
+    minimidl::id id{};
+    std::string_view title{};
+    std::string_view created_at{};
+    std::string_view description{};
+    Priority priority{};
+    Status status{};
+    std::string_view due_date{};
+    minimidl::wire::encoded<std::vector<std::string>> tags{};
+};
+
+// Writes the current property values of object, reading each once
+inline void encode(minimidl::wire::writer& out, const ITask& object) {
+    encode(out, object.get_id());
+    encode(out, object.get_title());
+    encode(out, object.get_created_at());
+    encode(out, object.get_description());
+    encode(out, object.get_priority());
+    encode(out, object.get_status());
+    encode(out, object.get_due_date());
+    encode(out, object.get_tags());
+}
+
+inline void encode(minimidl::wire::writer& out, const ITaskRecord& record) {
+    encode(out, record.id);
+    encode(out, record.title);
+    encode(out, record.created_at);
+    encode(out, record.description);
+    encode(out, record.priority);
+    encode(out, record.status);
+    encode(out, record.due_date);
+    encode(out, record.tags);
+}
+
+inline void decode(minimidl::wire::reader& in, ITaskRecord& record) {
+    decode(in, record.id);
+    decode(in, record.title);
+    decode(in, record.created_at);
+    decode(in, record.description);
+    decode(in, record.priority);
+    decode(in, record.status);
+    decode(in, record.due_date);
+    decode(in, record.tags);
+}
+
+inline void decode(minimidl::wire::reader& in, ITaskView& view) {
+    decode(in, view.id);
+    view.title = in.read_view();
+    view.created_at = in.read_view();
+    view.description = in.read_view();
+    decode(in, view.priority);
+    decode(in, view.status);
+    view.due_date = in.read_view();
+    view.tags = minimidl::wire::encoded<std::vector<std::string>>::read(in);
+}
+
+// Property values of a IProject, as written by encode(). Object
+// references are not part of the record.
+struct IProjectRecord {
+    minimidl::id id{};
+    std::string name{};
+    std::string description{};
+    bool active{};
+};
+
+// IProjectRecord read in place: strings point into the encoded bytes
+// and collections are decoded on demand, so it is only valid while the
+// bytes are
+struct IProjectView {
+    minimidl::id id{};
+    std::string_view name{};
+    std::string_view description{};
+    bool active{};
+};
+
+// Writes the current property values of object, reading each once
+inline void encode(minimidl::wire::writer& out, const IProject& object) {
+    encode(out, object.get_id());
+    encode(out, object.get_name());
+    encode(out, object.get_description());
+    encode(out, object.get_active());
+}
+
+inline void encode(minimidl::wire::writer& out, const IProjectRecord& record) {
+    encode(out, record.id);
+    encode(out, record.name);
+    encode(out, record.description);
+    encode(out, record.active);
+}
+
+inline void decode(minimidl::wire::reader& in, IProjectRecord& record) {
+    decode(in, record.id);
+    decode(in, record.name);
+    decode(in, record.description);
+    decode(in, record.active);
+}
+
+inline void decode(minimidl::wire::reader& in, IProjectView& view) {
+    decode(in, view.id);
+    view.name = in.read_view();
+    view.description = in.read_view();
+    decode(in, view.active);
+}
+
+} // namespace TaskManager
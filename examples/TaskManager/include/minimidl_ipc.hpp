@@ -0,0 +1,751 @@
+// MinimIDL Out-of-Process Transport
+// Shared-memory channel, client and server used by the generated
+// <Namespace>Remote.hpp proxies and stubs
+#pragma once
+
+#include "minimidl_runtime.hpp"
+
+#include <chrono>
+#include <exception>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <optional>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <cerrno>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace minimidl {
+namespace ipc {
+
+// The channel is unusable: the other side closed it, stopped replying or
+// sent bytes that are not a valid message
+class transport_error : public idl_exception {
+public:
+    explicit transport_error(const std::string& msg) : idl_exception("Transport error: " + msg) {}
+};
+
+// An exception thrown by the implementation in the server process, carrying
+// its message
+class remote_exception : public idl_exception {
+public:
+    explicit remote_exception(const std::string& msg) : idl_exception(msg) {}
+};
+
+// Id of the first object a server exports, which clients start from
+constexpr uint64_t root_object = 1;
+
+static_assert(std::atomic<uint64_t>::is_always_lock_free && std::atomic<uint32_t>::is_always_lock_free,
+              "ring positions are shared between processes");
+
+namespace detail {
+
+constexpr size_t align8(size_t size) noexcept { return (size + 7) & ~size_t(7); }
+constexpr size_t align64(size_t size) noexcept { return (size + 63) & ~size_t(63); }
+
+// Spins briefly, then yields, until ready() returns true or the deadline passes
+template<typename Ready>
+bool wait_until(Ready ready, std::chrono::steady_clock::time_point deadline) {
+    for (unsigned spins = 0;; ++spins) {
+        if (ready()) {
+            return true;
+        }
+        if (spins >= 64) {
+            if ((spins & 63) == 0 && std::chrono::steady_clock::now() >= deadline) {
+                return false;
+            }
+            std::this_thread::yield();
+        }
+    }
+}
+
+} // namespace detail
+
+// Read and write positions of a ring, on separate cache lines so producer
+// and consumer do not contend. Both only ever grow.
+struct ring_header {
+    alignas(64) std::atomic<uint64_t> head{0};
+    alignas(64) std::atomic<uint64_t> tail{0};
+};
+
+// Single-producer single-consumer queue of variable-size messages in memory
+// shared by two processes. Each message is an 8-byte length followed by its
+// bytes, padded to 8 bytes, and is always contiguous: a message that would
+// cross the end of the buffer is written at the start instead, after a wrap
+// marker. The consumer reads messages where they are.
+class ring {
+public:
+    ring() = default;
+    ring(ring_header* header, uint8_t* data, size_t capacity) noexcept
+        : m_header(header), m_data(data), m_capacity(capacity) {}
+
+    // Largest message the ring accepts
+    size_t max_message() const noexcept { return m_capacity / 2 - sizeof(uint64_t); }
+
+    // Room for a size byte message, or nullptr while the ring is too full.
+    // The message is sent by commit().
+    uint8_t* try_reserve(size_t size) {
+        if (size > max_message()) {
+            throw transport_error("message of " + std::to_string(size) + " bytes is too large for the channel");
+        }
+        uint64_t head = m_header->head.load(std::memory_order_relaxed);
+        uint64_t tail = m_header->tail.load(std::memory_order_acquire);
+        size_t record = detail::align8(sizeof(uint64_t) + size);
+        size_t offset = static_cast<size_t>(head % m_capacity);
+        size_t to_end = m_capacity - offset;
+        size_t needed = record <= to_end ? record : record + to_end;
+        if (m_capacity - (head - tail) < needed) {
+            return nullptr;
+        }
+        if (record > to_end) {
+            std::memcpy(m_data + offset, &wrap_marker, sizeof(wrap_marker));
+            head += to_end;
+            offset = 0;
+        }
+        uint64_t length = size;
+        std::memcpy(m_data + offset, &length, sizeof(length));
+        m_reserved = head + record;
+        return m_data + offset + sizeof(uint64_t);
+    }
+
+    void commit() noexcept { m_header->head.store(m_reserved, std::memory_order_release); }
+
+    // The oldest message, left in place until pop(), or nullptr if there is none
+    const uint8_t* try_peek(size_t& size) {
+        uint64_t tail = m_header->tail.load(std::memory_order_relaxed);
+        uint64_t head = m_header->head.load(std::memory_order_acquire);
+        if (tail == head) {
+            return nullptr;
+        }
+        size_t offset = static_cast<size_t>(tail % m_capacity);
+        uint64_t length;
+        std::memcpy(&length, m_data + offset, sizeof(length));
+        if (length == wrap_marker) {
+            tail += m_capacity - offset;
+            offset = 0;
+            std::memcpy(&length, m_data, sizeof(length));
+        }
+        if (length > max_message() || tail + sizeof(uint64_t) + length > head) {
+            throw transport_error("corrupt message in channel");
+        }
+        m_popped = tail + detail::align8(sizeof(uint64_t) + static_cast<size_t>(length));
+        size = static_cast<size_t>(length);
+        return m_data + offset + sizeof(uint64_t);
+    }
+
+    void pop() noexcept { m_header->tail.store(m_popped, std::memory_order_release); }
+
+private:
+    static constexpr uint64_t wrap_marker = ~uint64_t(0);
+
+    ring_header* m_header = nullptr;
+    uint8_t* m_data = nullptr;
+    size_t m_capacity = 0;
+    uint64_t m_reserved = 0;
+    uint64_t m_popped = 0;
+};
+
+// Request and response rings laid out in one block of shared memory, which
+// the server creates and the client attaches to
+class channel {
+public:
+    static size_t required_size(size_t ring_capacity) noexcept {
+        return sizeof(layout) + 2 * (sizeof(ring_header) + detail::align64(ring_capacity));
+    }
+
+    // Initializes memory, which must be 64-byte aligned, as an empty channel
+    static channel create(void* memory, size_t size) {
+        if (size < required_size(256)) {
+            throw transport_error("channel memory is too small");
+        }
+        auto* header = new (memory) layout();
+        header->ring_capacity = ((size - required_size(0)) / 2) & ~size_t(63);
+        new (ring_memory(header, 0)) ring_header();
+        new (ring_memory(header, 1)) ring_header();
+        header->magic.store(layout::expected_magic, std::memory_order_release);
+        return channel(header);
+    }
+
+    // Uses memory initialized by create(), typically in another process
+    static channel attach(void* memory, size_t size) {
+        auto* header = static_cast<layout*>(memory);
+        if (size < sizeof(layout) || header->magic.load(std::memory_order_acquire) != layout::expected_magic ||
+            required_size(header->ring_capacity) > size) {
+            throw transport_error("memory does not hold a channel");
+        }
+        return channel(header);
+    }
+
+    ring& requests() noexcept { return m_requests; }
+    ring& responses() noexcept { return m_responses; }
+
+    bool closed() const noexcept { return m_layout->closed.load(std::memory_order_acquire) != 0; }
+    void close() noexcept { m_layout->closed.store(1, std::memory_order_release); }
+
+private:
+    struct layout {
+        static constexpr uint64_t expected_magic = 0x4C44494D494D0001;  // "MIMIDL", version 1
+
+        alignas(64) std::atomic<uint64_t> magic{0};
+        uint64_t ring_capacity = 0;
+        std::atomic<uint32_t> closed{0};
+    };
+
+    static uint8_t* ring_memory(layout* header, int index) noexcept {
+        return reinterpret_cast<uint8_t*>(header) + sizeof(layout) +
+               index * (sizeof(ring_header) + header->ring_capacity);
+    }
+
+    explicit channel(layout* header) noexcept : m_layout(header) {
+        for (int index = 0; index < 2; ++index) {
+            uint8_t* memory = ring_memory(header, index);
+            ring view(reinterpret_cast<ring_header*>(memory), memory + sizeof(ring_header),
+                      header->ring_capacity);
+            (index == 0 ? m_requests : m_responses) = view;
+        }
+    }
+
+    layout* m_layout;
+    ring m_requests;
+    ring m_responses;
+};
+
+class client;
+
+// Base of generated proxies: the object a proxy stands for in the server.
+// The server's reference is dropped when the proxy is destroyed.
+class remote_object {
+public:
+    remote_object(std::shared_ptr<client> owner, uint64_t id) noexcept
+        : m_client(std::move(owner)), m_id(id) {}
+    remote_object(const remote_object&) = delete;
+    remote_object& operator=(const remote_object&) = delete;
+    virtual ~remote_object();
+
+    client& remote_client() const noexcept { return *m_client; }
+    uint64_t remote_id() const noexcept { return m_id; }
+
+private:
+    std::shared_ptr<client> m_client;
+    uint64_t m_id;
+};
+
+// Client side of a channel, shared by the proxies of one server. Each
+// message is a frame of calls; calls without a result are batched into the
+// next frame instead of waiting for a reply, so only calls with a result
+// cost a round trip. A frame is a reply flag byte followed by calls, and a
+// call is the object id, the member id, the length of its arguments as 4
+// bytes, and the arguments.
+class client : public std::enable_shared_from_this<client> {
+public:
+    static std::shared_ptr<client> connect(channel ch,
+                                           std::chrono::milliseconds timeout = std::chrono::seconds(5)) {
+        return std::shared_ptr<client>(new client(ch, timeout));
+    }
+
+    // Sends the calls still queued, then closes the channel
+    ~client() {
+        try {
+            std::lock_guard<std::recursive_mutex> lock(m_mutex);
+            if (!m_broken && m_batch.size()) {
+                transmit(false);
+            }
+        } catch (...) {
+        }
+        m_channel.close();
+    }
+
+    // One call being encoded; holds the client until it is done
+    class call {
+    public:
+        call(client& owner, uint64_t object, uint32_t member) : m_owner(&owner), m_lock(owner.m_mutex) {
+            m_owner->check();
+            m_start = m_owner->m_batch.size();
+            m_owner->m_batch.write_varint(object);
+            m_owner->m_batch.write_varint(member);
+            m_owner->m_batch.write_fixed(0, 4);
+            m_arguments = m_owner->m_batch.size();
+        }
+
+        call(const call&) = delete;
+        call& operator=(const call&) = delete;
+
+        ~call() {
+            if (m_reply) {
+                m_owner->m_channel.responses().pop();
+            } else if (!m_done) {
+                m_owner->m_batch.truncate(m_start);
+            }
+        }
+
+        wire::writer& args() noexcept { return m_owner->m_batch; }
+
+        // Queues the call without waiting for it to run
+        void post() {
+            finish();
+            if (m_owner->m_batch.size() >= m_owner->m_batch_limit) {
+                m_owner->transmit(false);
+            }
+        }
+
+        // Sends the queued calls and this one and waits for its result. A
+        // queued call that failed is reported here, after this call has run.
+        wire::reader& send() {
+            finish();
+            m_owner->transmit(true);
+            size_t size = 0;
+            const uint8_t* reply = m_owner->await(size);
+            m_reply = true;
+            m_reader.emplace(reply, size);
+            std::string_view deferred = m_reader->read_view();
+            if (m_reader->read_byte() != 0) {
+                throw remote_exception(std::string(m_reader->read_view()));
+            }
+            if (!deferred.empty()) {
+                throw remote_exception(std::string(deferred));
+            }
+            return *m_reader;
+        }
+
+    private:
+        void finish() {
+            m_done = true;
+            // Bounded so that a call always fits with the queued ones
+            if (m_owner->m_batch.size() - m_start >= m_owner->m_batch_limit) {
+                m_owner->m_batch.truncate(m_start);
+                throw transport_error("call arguments are too large for the channel");
+            }
+            size_t length = m_owner->m_batch.size() - m_arguments;
+            m_owner->m_batch.patch_fixed(m_arguments - 4, length, 4);
+        }
+
+        client* m_owner;
+        std::unique_lock<std::recursive_mutex> m_lock;
+        size_t m_start = 0;
+        size_t m_arguments = 0;
+        bool m_done = false;
+        bool m_reply = false;
+        std::optional<wire::reader> m_reader;
+    };
+
+    call start(uint64_t object, uint32_t member) { return call(*this, object, member); }
+
+    // Sends the queued calls and waits for them, reporting the first failure
+    void flush() { start(0, 0).send(); }
+
+    // Writes the id of an object argument, which must be a proxy of this client
+    template<typename T>
+    void write_object(wire::writer& out, const T* object) const {
+        if (!object) {
+            out.write_varint(0);
+            return;
+        }
+        const auto* remote = dynamic_cast<const remote_object*>(object);
+        if (!remote || &remote->remote_client() != this) {
+            throw idl_exception("Only objects from the same server can be passed to a remote call");
+        }
+        out.write_varint(remote->remote_id());
+    }
+
+    // Reads an object result as a new proxy
+    template<typename Interface, typename Proxy>
+    object_ptr<Interface> read_object(wire::reader& in) {
+        uint64_t id = in.read_varint();
+        if (!id) {
+            return nullptr;
+        }
+        return make_object<Proxy>(shared_from_this(), id);
+    }
+
+    // Drops the server's reference held for a proxy; failures are ignored
+    // because there is nobody left to report them to
+    void release(uint64_t object) noexcept {
+        try {
+            start(object, 0).post();
+        } catch (...) {
+        }
+    }
+
+private:
+    client(channel ch, std::chrono::milliseconds timeout)
+        : m_channel(ch), m_timeout(timeout), m_batch_limit(ch.requests().max_message() / 2) {}
+
+    void check() const {
+        if (m_broken) {
+            throw transport_error("channel is broken");
+        }
+        if (m_channel.closed()) {
+            throw transport_error("channel is closed");
+        }
+    }
+
+    void transmit(bool reply) {
+        ring& requests = m_channel.requests();
+        size_t size = 1 + m_batch.size();
+        uint8_t* frame = nullptr;
+        if (!detail::wait_until(
+                [&] { return (frame = requests.try_reserve(size)) != nullptr || m_channel.closed(); },
+                deadline()) ||
+            !frame) {
+            fail(m_channel.closed() ? "channel is closed" : "server is not reading requests");
+        }
+        frame[0] = reply ? 1 : 0;
+        std::memcpy(frame + 1, m_batch.bytes().data(), m_batch.size());
+        requests.commit();
+        m_batch.truncate(0);
+    }
+
+    const uint8_t* await(size_t& size) {
+        const uint8_t* reply = nullptr;
+        if (!detail::wait_until(
+                [&] { return (reply = m_channel.responses().try_peek(size)) != nullptr || m_channel.closed(); },
+                deadline()) ||
+            !reply) {
+            fail(m_channel.closed() ? "channel is closed" : "no reply from server");
+        }
+        return reply;
+    }
+
+    // A late reply would be taken for the next call's, so give up on the channel
+    [[noreturn]] void fail(const char* reason) {
+        m_broken = true;
+        m_batch.truncate(0);
+        throw transport_error(reason);
+    }
+
+    std::chrono::steady_clock::time_point deadline() const { return std::chrono::steady_clock::now() + m_timeout; }
+
+    channel m_channel;
+    std::chrono::milliseconds m_timeout;
+    size_t m_batch_limit;
+    std::recursive_mutex m_mutex;
+    wire::writer m_batch;
+    bool m_broken = false;
+};
+
+inline remote_object::~remote_object() { m_client->release(m_id); }
+
+// Server side of a channel: owns the objects exported to the client and
+// runs the calls it receives on the serving thread. A reply is the first
+// failure of a queued call since the previous reply (empty if none), a
+// status byte, and the result or the error message.
+class server {
+public:
+    using dispatch_fn = void (*)(server& owner, RefCounted& object, uint32_t member,
+                                 wire::reader& in, wire::writer& out);
+
+    explicit server(channel ch, std::chrono::milliseconds timeout = std::chrono::seconds(5))
+        : m_channel(ch), m_timeout(timeout) {}
+
+    ~server() { m_channel.close(); }
+
+    server(const server&) = delete;
+    server& operator=(const server&) = delete;
+
+    // Makes object callable by the client and returns its id. Exporting an
+    // object again returns the same id; each export is one client reference.
+    template<typename T>
+    uint64_t export_object(const object_ptr<T>& object, dispatch_fn dispatch) {
+        if (!object) {
+            return 0;
+        }
+        const RefCounted* key = object.get();
+        auto found = m_ids.find(key);
+        if (found != m_ids.end()) {
+            ++m_objects.at(found->second).references;
+            return found->second;
+        }
+        uint64_t id = m_next_id++;
+        m_objects.emplace(id, entry{object_ptr<RefCounted>(object), dispatch, 1});
+        m_ids.emplace(key, id);
+        return id;
+    }
+
+    template<typename T>
+    void write_object(wire::writer& out, const object_ptr<T>& object, dispatch_fn dispatch) {
+        out.write_varint(export_object(object, dispatch));
+    }
+
+    // Reads an object argument sent by the client
+    template<typename T>
+    T& read_object(wire::reader& in) {
+        auto object = read_nullable_object<T>(in);
+        if (!object) {
+            throw null_pointer_exception("remote object argument");
+        }
+        return *object;
+    }
+
+    template<typename T>
+    object_ptr<T> read_nullable_object(wire::reader& in) {
+        uint64_t id = in.read_varint();
+        if (!id) {
+            return nullptr;
+        }
+        T* object = dynamic_cast<T*>(lookup(id).object.get());
+        if (!object) {
+            throw idl_exception("Remote object " + std::to_string(id) + " has the wrong type");
+        }
+        return object_ptr<T>(object);
+    }
+
+    // Runs the calls of one request, if there is one
+    bool poll() {
+        size_t size = 0;
+        const uint8_t* frame = m_channel.requests().try_peek(size);
+        if (!frame) {
+            return false;
+        }
+        wire::reader in(frame, size);
+        bool reply = false;
+        try {
+            reply = in.read_byte() != 0;
+            while (!in.at_end()) {
+                run_call(in, reply);
+            }
+        } catch (const std::exception& e) {
+            // The frame itself is malformed; drop the rest of it
+            if (reply) {
+                respond(false, e.what());
+            }
+        }
+        m_channel.requests().pop();
+        return true;
+    }
+
+    // Serves requests until stop is set or the client closes the channel,
+    // backing off to short sleeps while idle
+    void run(const std::atomic<bool>& stop) {
+        auto idle_since = std::chrono::steady_clock::now();
+        while (!stop.load(std::memory_order_relaxed)) {
+            if (poll()) {
+                idle_since = std::chrono::steady_clock::now();
+            } else if (m_channel.closed()) {
+                break;
+            } else if (std::chrono::steady_clock::now() - idle_since < std::chrono::milliseconds(1)) {
+                std::this_thread::yield();
+            } else {
+                std::this_thread::sleep_for(std::chrono::microseconds(50));
+            }
+        }
+    }
+
+private:
+    struct entry {
+        object_ptr<RefCounted> object;
+        dispatch_fn dispatch;
+        uint64_t references;
+    };
+
+    entry& lookup(uint64_t id) {
+        auto found = m_objects.find(id);
+        if (found == m_objects.end()) {
+            throw idl_exception("Unknown remote object " + std::to_string(id));
+        }
+        return found->second;
+    }
+
+    void run_call(wire::reader& in, bool reply) {
+        uint64_t id = in.read_varint();
+        uint32_t member = static_cast<uint32_t>(in.read_varint());
+        size_t length = static_cast<size_t>(in.read_fixed(4));
+        if (length > in.remaining()) {
+            throw transport_error("call is longer than its request");
+        }
+        wire::reader arguments(in.position(), length);
+        in = wire::reader(in.position() + length, in.remaining() - length);
+        bool last = reply && in.at_end();
+
+        m_result.truncate(0);
+        try {
+            if (member == 0) {
+                if (id) {
+                    release(id);
+                }
+            } else {
+                entry& target = lookup(id);
+                // Keep the object alive through a call that releases it
+                object_ptr<RefCounted> object = target.object;
+                target.dispatch(*this, *object, member, arguments, m_result);
+            }
+        } catch (const std::exception& e) {
+            if (last) {
+                respond(false, e.what());
+            } else if (m_deferred.empty()) {
+                m_deferred = e.what();
+            }
+            return;
+        } catch (...) {
+            if (last) {
+                respond(false, "Unknown exception");
+            } else if (m_deferred.empty()) {
+                m_deferred = "Unknown exception";
+            }
+            return;
+        }
+        if (last) {
+            respond(true, {});
+        }
+    }
+
+    void release(uint64_t id) {
+        entry& target = lookup(id);
+        if (--target.references == 0) {
+            m_ids.erase(target.object.get());
+            m_objects.erase(id);
+        }
+    }
+
+    void respond(bool ok, std::string_view error) {
+        m_reply.truncate(0);
+        m_reply.write_string(m_deferred);
+        m_deferred.clear();
+        m_reply.write_byte(ok ? 0 : 1);
+        if (ok) {
+            m_reply.write_bytes(m_result.bytes().data(), m_result.size());
+        } else {
+            m_reply.write_string(error);
+        }
+        if (m_reply.size() > m_channel.responses().max_message()) {
+            m_reply.truncate(0);
+            m_reply.write_string({});
+            m_reply.write_byte(1);
+            m_reply.write_string("result is too large for the channel");
+        }
+        ring& responses = m_channel.responses();
+        uint8_t* message = nullptr;
+        auto deadline = std::chrono::steady_clock::now() + m_timeout;
+        if (!detail::wait_until(
+                [&] { return (message = responses.try_reserve(m_reply.size())) != nullptr || m_channel.closed(); },
+                deadline) ||
+            !message) {
+            // The client is gone or stuck; it gives up on the channel too
+            m_channel.close();
+            return;
+        }
+        std::memcpy(message, m_reply.bytes().data(), m_reply.size());
+        responses.commit();
+    }
+
+    channel m_channel;
+    std::chrono::milliseconds m_timeout;
+    std::unordered_map<uint64_t, entry> m_objects;
+    std::unordered_map<const RefCounted*, uint64_t> m_ids;
+    uint64_t m_next_id = root_object;
+    wire::writer m_result;
+    wire::writer m_reply;
+    std::string m_deferred;
+};
+
+// Collects the items of a stream result, which is sent to the client whole
+template<typename T>
+std::vector<T> drain(stream<T> items) {
+    std::vector<T> result;
+    T item{};
+    while (items.next(item)) {
+        result.push_back(std::move(item));
+    }
+    return result;
+}
+
+// Runs body now and returns its result as a ready future, for async methods
+// called through a proxy
+template<typename Body>
+auto ready_future(Body body) -> std::future<decltype(body())> {
+    using result_type = decltype(body());
+    std::promise<result_type> promise;
+    try {
+        if constexpr (std::is_void_v<result_type>) {
+            body();
+            promise.set_value();
+        } else {
+            promise.set_value(body());
+        }
+    } catch (...) {
+        promise.set_exception(std::current_exception());
+    }
+    return promise.get_future();
+}
+
+#if defined(__unix__) || defined(__APPLE__)
+// Named POSIX shared memory holding a channel, mapped into this process
+class shared_memory {
+public:
+    // Creates the named block; fails if it already exists
+    static shared_memory create(const std::string& name, size_t size) {
+        int fd = ::shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+        if (fd < 0) {
+            throw transport_error("shm_open " + name + ": " + std::strerror(errno));
+        }
+        if (::ftruncate(fd, static_cast<off_t>(size)) != 0) {
+            int error = errno;
+            ::close(fd);
+            ::shm_unlink(name.c_str());
+            throw transport_error("ftruncate " + name + ": " + std::strerror(error));
+        }
+        return map(fd, name, size);
+    }
+
+    static shared_memory open(const std::string& name) {
+        int fd = ::shm_open(name.c_str(), O_RDWR, 0);
+        if (fd < 0) {
+            throw transport_error("shm_open " + name + ": " + std::strerror(errno));
+        }
+        struct stat info;
+        if (::fstat(fd, &info) != 0) {
+            int error = errno;
+            ::close(fd);
+            throw transport_error("fstat " + name + ": " + std::strerror(error));
+        }
+        return map(fd, name, static_cast<size_t>(info.st_size));
+    }
+
+    // Removes the name; mappings stay valid until they are unmapped
+    static void remove(const std::string& name) noexcept { ::shm_unlink(name.c_str()); }
+
+    shared_memory(shared_memory&& other) noexcept
+        : m_data(std::exchange(other.m_data, nullptr)), m_size(std::exchange(other.m_size, 0)) {}
+    shared_memory& operator=(shared_memory other) noexcept {
+        std::swap(m_data, other.m_data);
+        std::swap(m_size, other.m_size);
+        return *this;
+    }
+    ~shared_memory() {
+        if (m_data) {
+            ::munmap(m_data, m_size);
+        }
+    }
+
+    void* data() const noexcept { return m_data; }
+    size_t size() const noexcept { return m_size; }
+
+private:
+    shared_memory(void* data, size_t size) noexcept : m_data(data), m_size(size) {}
+
+    static shared_memory map(int fd, const std::string& name, size_t size) {
+        void* data = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        int error = errno;
+        ::close(fd);
+        if (data == MAP_FAILED) {
+            throw transport_error("mmap " + name + ": " + std::strerror(error));
+        }
+        return shared_memory(data, size);
+    }
+
+    void* m_data;
+    size_t m_size;
+};
+#endif
+
+} // namespace ipc
+} // namespace minimidl
@@ -1,43 +1,1739 @@
-#pragma once
 // MinimIDL Runtime Support Library
-// This header provides base classes and utilities for generated code
+// Provides helper types and utilities for generated code
+#pragma once
 
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstring>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <memory>
+#if __has_include(<memory_resource>)
+#include <memory_resource>
+#define MINIMIDL_HAS_PMR 1
+#endif
+#include <mutex>
+#include <new>
+#include <optional>
 #include <string>
+#include <string_view>
+#include <thread>
+#include <tuple>
 #include <vector>
-#include <memory>
 #include <unordered_map>
-#include <atomic>
+#include <unordered_set>
+#include <cstdint>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+// An interned identifier, as the C wrapper's <NS>_Id handles point to it.
+// The NUL-terminated text is stored right after the entry.
+struct minimidl_id_entry {
+    size_t hash;
+    size_t size;
+    const char* text;
+};
 
 namespace minimidl {
 
-// Base class for reference counted objects
+// Exception types
+class idl_exception : public std::runtime_error {
+public:
+    explicit idl_exception(const std::string& msg) : std::runtime_error(msg) {}
+};
+
+class null_pointer_exception : public idl_exception {
+public:
+    explicit null_pointer_exception(const std::string& msg) 
+        : idl_exception("Null pointer access: " + msg) {}
+};
+
+// Intrusive reference count shared by all generated interfaces.
+// The count lives in the object itself, so object_ptr needs no separate
+// control block and a C handle is just the object pointer. Objects start
+// with one reference, owned by whoever created them; interfaces derive
+// from this class virtually so an object implementing several of them
+// still has a single count.
 class RefCounted {
-protected:
-    mutable std::atomic<int32_t> m_refCount{1};
-    
 public:
-    virtual ~RefCounted() = default;
-    
-    void AddRef() const {
+    void AddRef() const noexcept {
         m_refCount.fetch_add(1, std::memory_order_relaxed);
     }
-    
-    void Release() const {
+
+    void Release() const noexcept {
         if (m_refCount.fetch_sub(1, std::memory_order_acq_rel) == 1) {
             delete this;
         }
     }
+
+protected:
+    RefCounted() noexcept = default;
+    // Copies are new objects with their own count
+    RefCounted(const RefCounted&) noexcept {}
+    RefCounted& operator=(const RefCounted&) noexcept { return *this; }
+    virtual ~RefCounted() = default;
+
+private:
+    mutable std::atomic<int32_t> m_refCount{1};
+};
+
+// Intrusive smart pointer for RefCounted objects
+template<typename T>
+class object_ptr {
+public:
+    object_ptr() noexcept = default;
+    object_ptr(std::nullptr_t) noexcept {}
+
+    // Shares ownership of ptr by taking a new reference
+    explicit object_ptr(T* ptr) noexcept : m_ptr{ptr} {
+        if (m_ptr) {
+            m_ptr->AddRef();
+        }
+    }
+
+    object_ptr(const object_ptr& other) noexcept : object_ptr(other.m_ptr) {}
+    object_ptr(object_ptr&& other) noexcept : m_ptr{other.m_ptr} {
+        other.m_ptr = nullptr;
+    }
+
+    template<typename U, typename = std::enable_if_t<std::is_convertible_v<U*, T*>>>
+    object_ptr(const object_ptr<U>& other) noexcept : object_ptr(other.get()) {}
+
+    template<typename U, typename = std::enable_if_t<std::is_convertible_v<U*, T*>>>
+    object_ptr(object_ptr<U>&& other) noexcept : m_ptr{other.detach()} {}
+
+    ~object_ptr() {
+        if (m_ptr) {
+            m_ptr->Release();
+        }
+    }
+
+    object_ptr& operator=(object_ptr other) noexcept {
+        std::swap(m_ptr, other.m_ptr);
+        return *this;
+    }
+
+    // Takes over a reference the caller already owns
+    static object_ptr adopt(T* ptr) noexcept {
+        object_ptr result;
+        result.m_ptr = ptr;
+        return result;
+    }
+
+    // Gives up ownership without releasing; the caller now owns the reference
+    T* detach() noexcept {
+        T* ptr = m_ptr;
+        m_ptr = nullptr;
+        return ptr;
+    }
+
+    void reset() noexcept {
+        object_ptr().swap(*this);
+    }
+
+    void swap(object_ptr& other) noexcept {
+        std::swap(m_ptr, other.m_ptr);
+    }
+
+    T* get() const noexcept { return m_ptr; }
+    T& operator*() const noexcept { return *m_ptr; }
+    T* operator->() const noexcept { return m_ptr; }
+    explicit operator bool() const noexcept { return m_ptr != nullptr; }
+
+    friend bool operator==(const object_ptr& a, const object_ptr& b) noexcept { return a.m_ptr == b.m_ptr; }
+    friend bool operator!=(const object_ptr& a, const object_ptr& b) noexcept { return a.m_ptr != b.m_ptr; }
+    friend bool operator==(const object_ptr& a, std::nullptr_t) noexcept { return !a.m_ptr; }
+    friend bool operator!=(const object_ptr& a, std::nullptr_t) noexcept { return a.m_ptr != nullptr; }
+
+private:
+    T* m_ptr = nullptr;
+};
+
+// Factory function for creating objects; the new object's initial
+// reference is adopted by the returned pointer
+template<typename T, typename... Args>
+object_ptr<T> make_object(Args&&... args) {
+    return object_ptr<T>::adopt(new T(std::forward<Args>(args)...));
+}
+
+// Safe nullable access
+template<typename T>
+T& deref(const object_ptr<T>& ptr, const char* context = "") {
+    if (!ptr) {
+        throw null_pointer_exception(context);
+    }
+    return *ptr;
+}
+
+namespace detail {
+
+template<typename T, typename = void>
+struct has_equal : std::false_type {};
+
+template<typename T>
+struct has_equal<T, std::void_t<decltype(std::declval<const T&>() == std::declval<const T&>())>>
+    : std::true_type {};
+
+// Containers declare operator== for any element type, so look at the
+// elements: generated structs have no operator==
+template<typename T>
+struct is_equality_comparable : has_equal<T> {};
+
+template<typename T, typename A>
+struct is_equality_comparable<std::vector<T, A>> : is_equality_comparable<T> {};
+
+template<typename K, typename V, typename H, typename E, typename A>
+struct is_equality_comparable<std::unordered_map<K, V, H, E, A>> : is_equality_comparable<V> {};
+
+template<typename T>
+struct is_equality_comparable<std::optional<T>> : is_equality_comparable<T> {};
+
+} // namespace detail
+
+// Value shared between threads that is read far more often than written.
+// Two copies are kept: readers copy the one currently published without
+// locking or waiting, while a writer updates the other copy, switches
+// readers over to it and waits for readers still on the old copy before
+// updating that one too (the left-right technique). Writers are serialised
+// by a mutex.
+template<typename T>
+class read_mostly {
+public:
+    explicit read_mostly(const T& value) : m_values{value, value} {}
+
+    read_mostly(const read_mostly&) = delete;
+    read_mostly& operator=(const read_mostly&) = delete;
+
+    T load() const {
+        const int version = m_version.load();
+        m_readers[version].fetch_add(1);
+        T value = m_values[m_active.load()];
+        m_readers[version].fetch_sub(1, std::memory_order_release);
+        return value;
+    }
+
+    void store(const T& value) {
+        std::lock_guard<std::mutex> lock(m_writer);
+        publish(value);
+    }
+
+    // Calls produce() with writers locked out and publishes its result,
+    // unless it compares equal to the value already published
+    template<typename Produce>
+    void update(Produce&& produce) {
+        std::lock_guard<std::mutex> lock(m_writer);
+        T value = produce();
+        if constexpr (detail::is_equality_comparable<T>::value) {
+            if (value == m_values[m_active.load(std::memory_order_relaxed)]) {
+                return;
+            }
+        }
+        publish(value);
+    }
+
+private:
+    void publish(const T& value) {
+        const int active = m_active.load(std::memory_order_relaxed);
+        m_values[1 - active] = value;
+        m_active.store(1 - active);
+        const int version = m_version.load(std::memory_order_relaxed);
+        wait_for_readers(1 - version);
+        m_version.store(1 - version);
+        wait_for_readers(version);
+        m_values[active] = value;
+    }
+
+    void wait_for_readers(int version) const {
+        while (m_readers[version].load(std::memory_order_acquire) != 0) {
+            std::this_thread::yield();
+        }
+    }
+
+    T m_values[2];
+    std::atomic<int> m_active{0};
+    std::atomic<int> m_version{0};
+    mutable std::atomic<size_t> m_readers[2]{};
+    std::mutex m_writer;
+};
+
+// Result of a stream<T> method. Items are pulled one at a time from a
+// source function, so the implementation never has to hold the whole
+// result. A stream is read once, with next() or a range-for loop.
+template<typename T>
+class stream {
+public:
+    // Stores the next item in out and returns true, or returns false once
+    // there are no more items
+    using source_type = std::function<bool(T& out)>;
+
+    stream() = default;
+    explicit stream(source_type source) : m_source(std::move(source)) {}
+
+    stream(stream&&) = default;
+    stream& operator=(stream&&) = default;
+    stream(const stream&) = delete;
+    stream& operator=(const stream&) = delete;
+
+    bool next(T& out) {
+        if (m_source && m_source(out)) {
+            return true;
+        }
+        m_source = nullptr;
+        return false;
+    }
+
+    class iterator {
+    public:
+        using iterator_category = std::input_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = T*;
+        using reference = T&;
+
+        iterator() = default;
+        explicit iterator(stream* owner) : m_owner(owner) { ++*this; }
+
+        reference operator*() { return m_value; }
+        pointer operator->() { return &m_value; }
+
+        iterator& operator++() {
+            if (!m_owner->next(m_value)) {
+                m_owner = nullptr;
+            }
+            return *this;
+        }
+
+        bool operator==(const iterator& other) const { return m_owner == other.m_owner; }
+        bool operator!=(const iterator& other) const { return m_owner != other.m_owner; }
+
+    private:
+        stream* m_owner = nullptr;
+        T m_value{};
+    };
+
+    iterator begin() { return iterator(this); }
+    iterator end() { return iterator(); }
+
+private:
+    source_type m_source;
+};
+
+// Streams the items of a container, which the stream takes over
+template<typename Container>
+stream<typename Container::value_type> make_stream(Container items) {
+    struct state {
+        Container items;
+        typename Container::iterator position;
+    };
+    auto shared = std::make_shared<state>();
+    shared->items = std::move(items);
+    shared->position = shared->items.begin();
+    return stream<typename Container::value_type>(
+        [shared](typename Container::value_type& out) {
+            if (shared->position == shared->items.end()) {
+                return false;
+            }
+            out = std::move(*shared->position);
+            ++shared->position;
+            return true;
+        });
+}
+
+// Change notifications.
+// Objects have an event<Args...> for every event their interface declares.
+// Implementations either emit() to call the handlers right away, or post()
+// a notification: posts to one event replace each other until the next
+// dispatch_events(), which calls the handlers once with the latest
+// arguments. A host calls dispatch_events() once per frame or tick, so a
+// burst of changes costs one call per handler.
+namespace detail {
+
+class event_state_base {
+public:
+    virtual ~event_state_base() = default;
+
+    // Calls the handlers with the posted notification, if there still is one
+    virtual bool deliver() = 0;
+};
+
+// Process-wide list of events with a posted notification
+class event_queue {
+public:
+    static event_queue& instance() {
+        // Leaked, so events posted during static destruction find it
+        static event_queue* queue = new event_queue;
+        return *queue;
+    }
+
+    void enqueue(std::shared_ptr<event_state_base> state) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_queued.push_back(std::move(state));
+    }
+
+    size_t dispatch() {
+        std::vector<std::shared_ptr<event_state_base>> batch;
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            batch.swap(m_queued);
+        }
+        size_t delivered = 0;
+        for (size_t i = 0; i < batch.size(); ++i) {
+            try {
+                delivered += batch[i]->deliver() ? 1 : 0;
+            } catch (...) {
+                // Keep the rest for the next dispatch
+                std::lock_guard<std::mutex> lock(m_mutex);
+                m_queued.insert(m_queued.begin(), batch.begin() + static_cast<std::ptrdiff_t>(i) + 1, batch.end());
+                throw;
+            }
+        }
+        return delivered;
+    }
+
+private:
+    std::mutex m_mutex;
+    std::vector<std::shared_ptr<event_state_base>> m_queued;
+};
+
+// Handlers and pending notification of an event. Shared with the queue and
+// with deliveries in progress, so neither outlives it.
+template<typename... Args>
+class event_state final : public event_state_base {
+public:
+    struct subscription {
+        uint64_t id;
+        std::function<void(const Args&...)> handler;
+        bool active;
+    };
+
+    void emit(const Args&... args) {
+        std::lock_guard<std::recursive_mutex> lock(handlers_mutex);
+        // Handlers may subscribe and unsubscribe while they run
+        auto current = handlers;
+        for (const auto& entry : current) {
+            if (closed) {
+                break;
+            }
+            if (entry->active) {
+                entry->handler(args...);
+            }
+        }
+    }
+
+    bool deliver() override {
+        std::optional<std::tuple<Args...>> notification;
+        {
+            std::lock_guard<std::mutex> lock(pending_mutex);
+            notification.swap(pending);
+            queued = false;
+        }
+        if (!notification) {
+            return false;
+        }
+        std::apply([this](const Args&... args) { emit(args...); }, *notification);
+        return true;
+    }
+
+    // Held while handlers run, so unsubscribing waits for them
+    std::recursive_mutex handlers_mutex;
+    std::vector<std::shared_ptr<subscription>> handlers;
+    uint64_t last_id = 0;
+    bool closed = false;
+    std::atomic<size_t> subscribers{0};
+
+    std::mutex pending_mutex;
+    std::optional<std::tuple<Args...>> pending;
+    bool queued = false;
+};
+
+} // namespace detail
+
+template<typename... Args>
+class event {
+public:
+    using handler_type = std::function<void(const Args&...)>;
+
+    event() : m_state(std::make_shared<detail::event_state<Args...>>()) {}
+
+    event(const event&) = delete;
+    event& operator=(const event&) = delete;
+
+    // Waits for handlers running on other threads; none runs afterwards
+    ~event() {
+        std::lock_guard<std::recursive_mutex> lock(m_state->handlers_mutex);
+        m_state->closed = true;
+        for (const auto& entry : m_state->handlers) {
+            entry->active = false;
+        }
+        m_state->handlers.clear();
+    }
+
+    // Registers a handler and returns its subscription id, which is never 0
+    uint64_t subscribe(handler_type handler) {
+        std::lock_guard<std::recursive_mutex> lock(m_state->handlers_mutex);
+        const uint64_t id = ++m_state->last_id;
+        m_state->handlers.push_back(std::make_shared<typename detail::event_state<Args...>::subscription>(
+            typename detail::event_state<Args...>::subscription{id, std::move(handler), true}));
+        m_state->subscribers.fetch_add(1, std::memory_order_relaxed);
+        return id;
+    }
+
+    // Removes a handler, waiting for it if it is running on another thread.
+    // Returns false if there is no such subscription.
+    bool unsubscribe(uint64_t id) {
+        std::lock_guard<std::recursive_mutex> lock(m_state->handlers_mutex);
+        auto& handlers = m_state->handlers;
+        for (auto it = handlers.begin(); it != handlers.end(); ++it) {
+            if ((*it)->id == id) {
+                (*it)->active = false;
+                handlers.erase(it);
+                m_state->subscribers.fetch_sub(1, std::memory_order_relaxed);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    bool has_subscribers() const noexcept {
+        return m_state->subscribers.load(std::memory_order_relaxed) != 0;
+    }
+
+    // Calls the handlers now, on the calling thread
+    void emit(const Args&... args) { m_state->emit(args...); }
+
+    // Queues a notification for the next dispatch_events(), replacing one
+    // posted since the last. Does nothing while there are no subscribers.
+    void post(Args... args) {
+        if (!has_subscribers()) {
+            return;
+        }
+        {
+            std::lock_guard<std::mutex> lock(m_state->pending_mutex);
+            m_state->pending.emplace(std::move(args)...);
+            if (m_state->queued) {
+                return;
+            }
+            m_state->queued = true;
+        }
+        detail::event_queue::instance().enqueue(m_state);
+    }
+
+private:
+    std::shared_ptr<detail::event_state<Args...>> m_state;
 };
 
-// String type for IDL compatibility
+// Delivers the notifications posted since the last call on the calling
+// thread and returns how many events had one
+inline size_t dispatch_events() {
+    return detail::event_queue::instance().dispatch();
+}
+
+// Type traits for IDL types
+template<typename T>
+struct is_idl_primitive : std::false_type {};
+
+template<> struct is_idl_primitive<bool> : std::true_type {};
+template<> struct is_idl_primitive<int32_t> : std::true_type {};
+template<> struct is_idl_primitive<int64_t> : std::true_type {};
+template<> struct is_idl_primitive<float> : std::true_type {};
+template<> struct is_idl_primitive<double> : std::true_type {};
+
+template<typename T>
+constexpr bool is_idl_primitive_v = is_idl_primitive<T>::value;
+
+// String utilities
 using string_t = std::string;
 
-// Array type template
+// Fixed-capacity string for struct fields. It has the layout of char[N]
+// and holds up to N - 1 bytes followed by a NUL, so a struct containing it
+// stays plain data and crosses the C ABI as raw bytes.
+template<size_t N>
+struct fixed_string {
+    static_assert(N > 0, "fixed_string needs room for the terminator");
+
+    char data[N];
+
+    static constexpr size_t capacity() noexcept { return N - 1; }
+
+    std::string_view view() const noexcept {
+        size_t length = 0;
+        while (length < N - 1 && data[length] != '\0') {
+            ++length;
+        }
+        return {data, length};
+    }
+
+    std::string str() const { return std::string(view()); }
+
+    // Copies value, truncated to capacity() without splitting a UTF-8 sequence
+    void assign(std::string_view value) noexcept {
+        size_t length = std::min(value.size(), N - 1);
+        if (length < value.size()) {
+            while (length > 0 && (static_cast<unsigned char>(value[length]) & 0xC0) == 0x80) {
+                --length;
+            }
+        }
+        if (length) {
+            std::memcpy(data, value.data(), length);
+        }
+        data[length] = '\0';
+    }
+
+    fixed_string& operator=(std::string_view value) noexcept {
+        assign(value);
+        return *this;
+    }
+};
+
+namespace detail {
+
+// FNV-1a, computed once when an identifier is interned
+constexpr size_t hash_id_text(std::string_view text) noexcept {
+    uint64_t hash = 14695981039346656037ull;
+    for (char c : text) {
+        hash = (hash ^ static_cast<unsigned char>(c)) * 1099511628211ull;
+    }
+    return static_cast<size_t>(hash);
+}
+
+// Process-wide table of interned identifiers. It is split into shards, so
+// threads interning different strings rarely wait for each other, and its
+// entries are never freed, so an id stays valid for the rest of the process.
+class id_table {
+public:
+    static id_table& instance() {
+        // Leaked, so ids held by static objects stay readable
+        static id_table* table = new id_table;
+        return *table;
+    }
+
+    const minimidl_id_entry* find(std::string_view text) {
+        size_t hash = hash_id_text(text);
+        shard& owner = m_shards[hash % kShards];
+        std::lock_guard<std::mutex> lock(owner.mutex);
+        auto it = owner.entries.find(key{hash, text});
+        return it == owner.entries.end() ? nullptr : it->second;
+    }
+
+    const minimidl_id_entry* intern(std::string_view text) {
+        size_t hash = hash_id_text(text);
+        shard& owner = m_shards[hash % kShards];
+        std::lock_guard<std::mutex> lock(owner.mutex);
+        auto it = owner.entries.find(key{hash, text});
+        if (it != owner.entries.end()) {
+            return it->second;
+        }
+        void* block = ::operator new(sizeof(minimidl_id_entry) + text.size() + 1);
+        char* chars = reinterpret_cast<char*>(static_cast<minimidl_id_entry*>(block) + 1);
+        std::memcpy(chars, text.data(), text.size());
+        chars[text.size()] = '\0';
+        auto* entry = new (block) minimidl_id_entry{hash, text.size(), chars};
+        try {
+            owner.entries.emplace(key{hash, std::string_view(chars, text.size())}, entry);
+        } catch (...) {
+            ::operator delete(block);
+            throw;
+        }
+        return entry;
+    }
+
+private:
+    static constexpr size_t kShards = 16;
+
+    struct key {
+        size_t hash;
+        std::string_view text;
+
+        bool operator==(const key& other) const noexcept {
+            return hash == other.hash && text == other.text;
+        }
+    };
+
+    struct key_hash {
+        size_t operator()(const key& k) const noexcept { return k.hash; }
+    };
+
+    struct shard {
+        std::mutex mutex;
+        std::unordered_map<key, const minimidl_id_entry*, key_hash> entries;
+    };
+
+    std::array<shard, kShards> m_shards;
+};
+
+} // namespace detail
+
+// Interned identifier for id_t. Equal strings intern to the same entry, so
+// an id is one pointer: copying, comparing and hashing it never touch the
+// characters, and reading it never allocates. Interning takes a lock and
+// allocates the first time a string is seen. The empty id has no entry.
+// An id converts to and from the entry pointer the C wrapper hands out as
+// <NS>_Id, so it crosses the C ABI unchanged.
+class id {
+public:
+    constexpr id() noexcept = default;
+    constexpr id(const minimidl_id_entry* entry) noexcept : m_entry(entry) {}
+    explicit id(std::string_view text)
+        : m_entry(text.empty() ? nullptr : detail::id_table::instance().intern(text)) {}
+
+    // The id for text if it was interned before, or the empty id; never
+    // allocates, so lookups with unknown strings don't grow the table
+    static id find(std::string_view text) {
+        return text.empty() ? id() : id(detail::id_table::instance().find(text));
+    }
+
+    std::string_view view() const noexcept {
+        return m_entry ? std::string_view(m_entry->text, m_entry->size) : std::string_view();
+    }
+
+    const char* c_str() const noexcept { return m_entry ? m_entry->text : ""; }
+    std::string str() const { return std::string(view()); }
+    size_t size() const noexcept { return m_entry ? m_entry->size : 0; }
+    bool empty() const noexcept { return m_entry == nullptr; }
+    size_t hash() const noexcept { return m_entry ? m_entry->hash : 0; }
+
+    constexpr operator const minimidl_id_entry*() const noexcept { return m_entry; }
+
+    friend bool operator==(id a, id b) noexcept { return a.m_entry == b.m_entry; }
+    friend bool operator!=(id a, id b) noexcept { return a.m_entry != b.m_entry; }
+
+private:
+    const minimidl_id_entry* m_entry = nullptr;
+};
+
+static_assert(sizeof(id) == sizeof(void*) && std::is_trivially_copyable_v<id>,
+              "an id must cross the C ABI as a plain pointer");
+
+template<> struct is_idl_primitive<id> : std::true_type {};
+
+// Collection type aliases for clarity
+template<typename T>
+using array = std::vector<T>;
+
+template<typename K, typename V>
+using dict = std::unordered_map<K, V>;
+
+template<typename T>
+using set = std::unordered_set<T>;
+
+namespace detail {
+
+// Ordering of flat container keys. Ids and object references order by
+// address, which is stable within a process and all a lookup needs.
+template<typename T>
+struct flat_less {
+    bool operator()(const T& a, const T& b) const { return a < b; }
+};
+
+template<>
+struct flat_less<id> {
+    bool operator()(id a, id b) const noexcept {
+        return std::less<const minimidl_id_entry*>()(a, b);
+    }
+};
+
+template<typename T>
+struct flat_less<object_ptr<T>> {
+    bool operator()(const object_ptr<T>& a, const object_ptr<T>& b) const noexcept {
+        return std::less<T*>()(a.get(), b.get());
+    }
+};
+
+} // namespace detail
+
+// Sorted-vector map, used for dict<K, V> with --flat-containers. The entries
+// share one allocation, so a small map is built with a single allocation and
+// iterated like an array. Lookups are binary searches; an insert shifts the
+// entries after it, which is cheap while maps stay small. Iteration is in
+// key order.
+template<typename K, typename V, typename A = std::allocator<std::pair<K, V>>>
+class flat_map {
+public:
+    using key_type = K;
+    using mapped_type = V;
+    using value_type = std::pair<K, V>;
+    using size_type = size_t;
+    using allocator_type = A;
+    using iterator = typename std::vector<value_type, A>::iterator;
+    using const_iterator = typename std::vector<value_type, A>::const_iterator;
+
+    flat_map() = default;
+    explicit flat_map(const A& alloc) : m_items(alloc) {}
+    flat_map(const flat_map& other, const A& alloc) : m_items(other.m_items, alloc) {}
+    flat_map(flat_map&& other, const A& alloc) : m_items(std::move(other.m_items), alloc) {}
+    flat_map(std::initializer_list<value_type> items) { insert(items.begin(), items.end()); }
+
+    template<typename It>
+    flat_map(It first, It last) {
+        insert(first, last);
+    }
+
+    allocator_type get_allocator() const noexcept { return m_items.get_allocator(); }
+
+    iterator begin() noexcept { return m_items.begin(); }
+    iterator end() noexcept { return m_items.end(); }
+    const_iterator begin() const noexcept { return m_items.begin(); }
+    const_iterator end() const noexcept { return m_items.end(); }
+
+    bool empty() const noexcept { return m_items.empty(); }
+    size_t size() const noexcept { return m_items.size(); }
+    void reserve(size_t count) { m_items.reserve(count); }
+    void clear() noexcept { m_items.clear(); }
+
+    iterator find(const K& key) {
+        auto it = lower_bound(key);
+        return it != end() && !detail::flat_less<K>()(key, it->first) ? it : end();
+    }
+
+    const_iterator find(const K& key) const {
+        auto it = lower_bound(key);
+        return it != end() && !detail::flat_less<K>()(key, it->first) ? it : end();
+    }
+
+    size_t count(const K& key) const { return find(key) != end() ? 1 : 0; }
+    bool contains(const K& key) const { return find(key) != end(); }
+
+    V& at(const K& key) {
+        auto it = find(key);
+        if (it == end()) {
+            throw std::out_of_range("flat_map::at");
+        }
+        return it->second;
+    }
+
+    const V& at(const K& key) const {
+        auto it = find(key);
+        if (it == end()) {
+            throw std::out_of_range("flat_map::at");
+        }
+        return it->second;
+    }
+
+    V& operator[](const K& key) { return try_emplace(key).first->second; }
+    V& operator[](K&& key) { return try_emplace(std::move(key)).first->second; }
+
+    template<typename Key, typename... Args>
+    std::pair<iterator, bool> try_emplace(Key&& key, Args&&... args) {
+        auto it = lower_bound(key);
+        if (it != end() && !detail::flat_less<K>()(key, it->first)) {
+            return {it, false};
+        }
+        it = m_items.emplace(it, std::piecewise_construct,
+                             std::forward_as_tuple(std::forward<Key>(key)),
+                             std::forward_as_tuple(std::forward<Args>(args)...));
+        return {it, true};
+    }
+
+    template<typename Key, typename M>
+    std::pair<iterator, bool> insert_or_assign(Key&& key, M&& value) {
+        auto it = lower_bound(key);
+        if (it != end() && !detail::flat_less<K>()(key, it->first)) {
+            it->second = std::forward<M>(value);
+            return {it, false};
+        }
+        return {m_items.emplace(it, std::forward<Key>(key), std::forward<M>(value)), true};
+    }
+
+    std::pair<iterator, bool> insert(value_type item) {
+        auto it = lower_bound(item.first);
+        if (it != end() && !detail::flat_less<K>()(item.first, it->first)) {
+            return {it, false};
+        }
+        return {m_items.insert(it, std::move(item)), true};
+    }
+
+    // Keeps the first of several items with the same key, as std::map does
+    template<typename It>
+    void insert(It first, It last) {
+        for (; first != last; ++first) {
+            insert(value_type(*first));
+        }
+    }
+
+    template<typename... Args>
+    std::pair<iterator, bool> emplace(Args&&... args) {
+        return insert(value_type(std::forward<Args>(args)...));
+    }
+
+    size_t erase(const K& key) {
+        auto it = find(key);
+        if (it == end()) {
+            return 0;
+        }
+        m_items.erase(it);
+        return 1;
+    }
+
+    iterator erase(const_iterator pos) { return m_items.erase(pos); }
+
+    friend bool operator==(const flat_map& a, const flat_map& b) { return a.m_items == b.m_items; }
+    friend bool operator!=(const flat_map& a, const flat_map& b) { return a.m_items != b.m_items; }
+
+private:
+    iterator lower_bound(const K& key) {
+        return std::lower_bound(m_items.begin(), m_items.end(), key, key_before);
+    }
+
+    const_iterator lower_bound(const K& key) const {
+        return std::lower_bound(m_items.begin(), m_items.end(), key, key_before);
+    }
+
+    static bool key_before(const value_type& item, const K& key) {
+        return detail::flat_less<K>()(item.first, key);
+    }
+
+    std::vector<value_type, A> m_items;
+};
+
+// Sorted-vector set, used for set<T> with --flat-containers; see flat_map.
+// Elements cannot be changed in place, since that could break the order.
+template<typename T, typename A = std::allocator<T>>
+class flat_set {
+public:
+    using key_type = T;
+    using value_type = T;
+    using size_type = size_t;
+    using allocator_type = A;
+    using iterator = typename std::vector<T, A>::const_iterator;
+    using const_iterator = iterator;
+
+    flat_set() = default;
+    explicit flat_set(const A& alloc) : m_items(alloc) {}
+    flat_set(const flat_set& other, const A& alloc) : m_items(other.m_items, alloc) {}
+    flat_set(flat_set&& other, const A& alloc) : m_items(std::move(other.m_items), alloc) {}
+    flat_set(std::initializer_list<T> items) { insert(items.begin(), items.end()); }
+
+    template<typename It>
+    flat_set(It first, It last) {
+        insert(first, last);
+    }
+
+    allocator_type get_allocator() const noexcept { return m_items.get_allocator(); }
+
+    iterator begin() const noexcept { return m_items.begin(); }
+    iterator end() const noexcept { return m_items.end(); }
+
+    bool empty() const noexcept { return m_items.empty(); }
+    size_t size() const noexcept { return m_items.size(); }
+    void reserve(size_t count) { m_items.reserve(count); }
+    void clear() noexcept { m_items.clear(); }
+
+    iterator find(const T& item) const {
+        auto it = lower_bound(item);
+        return it != end() && !detail::flat_less<T>()(item, *it) ? it : end();
+    }
+
+    size_t count(const T& item) const { return find(item) != end() ? 1 : 0; }
+    bool contains(const T& item) const { return find(item) != end(); }
+
+    std::pair<iterator, bool> insert(T item) {
+        auto it = lower_bound(item);
+        if (it != end() && !detail::flat_less<T>()(item, *it)) {
+            return {it, false};
+        }
+        return {m_items.insert(it, std::move(item)), true};
+    }
+
+    template<typename It>
+    void insert(It first, It last) {
+        for (; first != last; ++first) {
+            insert(T(*first));
+        }
+    }
+
+    template<typename... Args>
+    std::pair<iterator, bool> emplace(Args&&... args) {
+        return insert(T(std::forward<Args>(args)...));
+    }
+
+    size_t erase(const T& item) {
+        auto it = find(item);
+        if (it == end()) {
+            return 0;
+        }
+        m_items.erase(it);
+        return 1;
+    }
+
+    iterator erase(iterator pos) { return m_items.erase(pos); }
+
+    friend bool operator==(const flat_set& a, const flat_set& b) { return a.m_items == b.m_items; }
+    friend bool operator!=(const flat_set& a, const flat_set& b) { return a.m_items != b.m_items; }
+
+private:
+    iterator lower_bound(const T& item) const {
+        return std::lower_bound(m_items.begin(), m_items.end(), item, detail::flat_less<T>());
+    }
+
+    std::vector<T, A> m_items;
+};
+
+namespace detail {
+
+template<typename K, typename V, typename A>
+struct is_equality_comparable<flat_map<K, V, A>> : is_equality_comparable<V> {};
+
+// A default T that allocates with alloc when T is allocator-aware, so items
+// decoded into a pmr container come from the container's resource
+template<typename T, typename A>
+T make_with(const A& alloc) {
+    if constexpr (std::uses_allocator_v<T, A>) {
+        return T(alloc);
+    } else {
+        return T{};
+    }
+}
+
+} // namespace detail
+#ifdef MINIMIDL_HAS_PMR
+
+// Memory resources. With --pmr, strings and collections in generated
+// signatures are std::pmr types, and implementations build the values they
+// return on current_resource(). A caller points that at its own resource for
+// the current thread with a resource_scope, or an arena_scope that frees
+// everything allocated during a request at once.
+
+namespace detail {
+
+inline std::pmr::memory_resource*& scoped_resource() noexcept {
+    static thread_local std::pmr::memory_resource* resource = nullptr;
+    return resource;
+}
+
+} // namespace detail
+
+// Resource for results on this thread: the innermost scope's, otherwise
+// std::pmr::get_default_resource()
+inline std::pmr::memory_resource* current_resource() noexcept {
+    std::pmr::memory_resource* resource = detail::scoped_resource();
+    return resource ? resource : std::pmr::get_default_resource();
+}
+
+// Makes resource the current_resource() of this thread until destroyed
+class resource_scope {
+public:
+    explicit resource_scope(std::pmr::memory_resource* resource) noexcept
+        : m_previous(std::exchange(detail::scoped_resource(), resource)) {}
+    ~resource_scope() { detail::scoped_resource() = m_previous; }
+
+    resource_scope(const resource_scope&) = delete;
+    resource_scope& operator=(const resource_scope&) = delete;
+
+private:
+    std::pmr::memory_resource* m_previous;
+};
+
+// Monotonic arena that is current_resource() while it lives. The first Size
+// bytes come from inline storage and the rest from upstream; all of it is
+// released at once when the arena goes out of scope, so values allocated
+// from it must not outlive it.
+template<size_t Size = 4096>
+class arena_scope {
+public:
+    explicit arena_scope(std::pmr::memory_resource* upstream = std::pmr::get_default_resource())
+        : m_resource(m_buffer, Size, upstream), m_scope(&m_resource) {}
+
+    arena_scope(const arena_scope&) = delete;
+    arena_scope& operator=(const arena_scope&) = delete;
+
+    std::pmr::memory_resource* resource() noexcept { return &m_resource; }
+
+private:
+    alignas(std::max_align_t) std::byte m_buffer[Size];
+    std::pmr::monotonic_buffer_resource m_resource;
+    resource_scope m_scope;
+};
+
+// A default T on current_resource() when T is allocator-aware
+template<typename T>
+T make_value() {
+    return detail::make_with<T>(std::pmr::polymorphic_allocator<std::byte>(current_resource()));
+}
+
+// value moved onto the default resource, for values kept after the
+// resource they were built on may be gone; a copy if the resources differ
 template<typename T>
-using array_t = std::vector<T>;
+T on_default_resource(T value) {
+    if constexpr (std::uses_allocator_v<T, std::pmr::polymorphic_allocator<std::byte>>) {
+        return T(std::move(value), std::pmr::get_default_resource());
+    } else {
+        return value;
+    }
+}
+
+namespace pmr {
 
-// Dictionary type template
 template<typename K, typename V>
-using dict_t = std::unordered_map<K, V>;
+using flat_map = minimidl::flat_map<K, V, std::pmr::polymorphic_allocator<std::pair<K, V>>>;
+
+template<typename T>
+using flat_set = minimidl::flat_set<T, std::pmr::polymorphic_allocator<T>>;
+
+} // namespace pmr
+#endif
+
+// Optional support for nullable primitives
+template<typename T>
+using nullable = std::optional<T>;
+
+// Enum utilities
+template<typename E>
+constexpr auto to_underlying(E e) noexcept {
+    return static_cast<std::underlying_type_t<E>>(e);
+}
+
+// Compile-time reflection.
+// The generated header specialises descriptor<T> for every interface and
+// enum. Interface descriptors hold constexpr tuples of property_info and
+// method_info, which for_each visits with each member's own type; enum
+// descriptors hold parallel arrays of values and names.
+template<typename T>
+struct descriptor;
+
+template<typename T, typename = void>
+struct has_descriptor : std::false_type {};
+
+template<typename T>
+struct has_descriptor<T, std::void_t<decltype(descriptor<T>::name)>> : std::true_type {};
+
+template<typename T>
+constexpr bool has_descriptor_v = has_descriptor<T>::value;
+
+// A property with its getter and, if it is writable, its setter
+template<typename Getter, typename Setter = std::nullptr_t>
+struct property_info {
+    static constexpr bool writable = !std::is_same_v<Setter, std::nullptr_t>;
+
+    std::string_view name;
+    std::string_view type;  // As written in the IDL
+    Getter getter;          // Member function pointers
+    Setter setter;
+};
+
+template<typename Getter>
+constexpr property_info<Getter> property(std::string_view name, std::string_view type,
+                                         Getter getter) noexcept {
+    return {name, type, getter, nullptr};
+}
+
+template<typename Getter, typename Setter>
+constexpr property_info<Getter, Setter> property(std::string_view name, std::string_view type,
+                                                 Getter getter, Setter setter) noexcept {
+    return {name, type, getter, setter};
+}
+
+template<typename Function, size_t N>
+struct method_info {
+    std::string_view name;
+    std::string_view return_type;  // As written in the IDL
+    Function function;             // Member function pointer
+    std::array<std::string_view, N> parameters;
+};
+
+template<typename Function, typename... Names>
+constexpr method_info<Function, sizeof...(Names)> method(std::string_view name,
+                                                         std::string_view return_type,
+                                                         Function function,
+                                                         Names... parameters) noexcept {
+    return {name, return_type, function, {std::string_view(parameters)...}};
+}
+
+// Calls visit with every element of a descriptor tuple, in declaration order
+template<typename Tuple, typename Visit>
+constexpr void for_each(const Tuple& members, Visit&& visit) {
+    std::apply([&](const auto&... member) { (visit(member), ...); }, members);
+}
+
+namespace detail {
+
+template<typename E, size_t N>
+constexpr bool is_contiguous(const std::array<E, N>& values) noexcept {
+    for (size_t i = 1; i < N; ++i) {
+        if (static_cast<long long>(to_underlying(values[i])) !=
+            static_cast<long long>(to_underlying(values[0])) + static_cast<long long>(i)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+} // namespace detail
+
+// Name of an enum value, or an empty view if it has none. Enums whose
+// values count up from the first are looked up by index.
+template<typename E>
+constexpr std::string_view enum_name(E value) noexcept {
+    using info = descriptor<E>;
+    if constexpr (info::contiguous && info::values.size() > 0) {
+        auto index = static_cast<long long>(to_underlying(value)) -
+                     static_cast<long long>(to_underlying(info::values[0]));
+        if (index < 0 || index >= static_cast<long long>(info::values.size())) {
+            return {};
+        }
+        return info::names[static_cast<size_t>(index)];
+    } else {
+        for (size_t i = 0; i < info::values.size(); ++i) {
+            if (info::values[i] == value) {
+                return info::names[i];
+            }
+        }
+        return {};
+    }
+}
+
+template<typename E>
+constexpr std::optional<E> enum_from_name(std::string_view name) noexcept {
+    using info = descriptor<E>;
+    for (size_t i = 0; i < info::names.size(); ++i) {
+        if (info::names[i] == name) {
+            return info::values[i];
+        }
+    }
+    return std::nullopt;
+}
+
+// Whether an underlying value is one of the declared values of E, e.g. an
+// integer received over a C ABI. Contiguous enums take a single range check.
+template<typename E>
+constexpr bool enum_is_valid(std::underlying_type_t<E> value) noexcept {
+    using info = descriptor<E>;
+    if constexpr (info::contiguous && info::values.size() > 0) {
+        // Unsigned distance from the first value, so one compare covers both ends
+        using wide = std::make_unsigned_t<std::common_type_t<std::underlying_type_t<E>, int>>;
+        return static_cast<wide>(static_cast<wide>(value) -
+                                 static_cast<wide>(to_underlying(info::values[0]))) <
+               info::values.size();
+    } else {
+        for (size_t i = 0; i < info::values.size(); ++i) {
+            if (to_underlying(info::values[i]) == value) {
+                return true;
+            }
+        }
+        return false;
+    }
+}
+
+// Compact binary encoding used by the generated <Namespace>Serialization.hpp.
+// Integers and enums are zigzag varints, floating point values are
+// little-endian IEEE bytes, strings and collections are prefixed with their
+// length as a varint, and nullable values with a presence byte. Structs and
+// interface records are their fields in declaration order.
+namespace wire {
+
+class decode_error : public idl_exception {
+public:
+    explicit decode_error(const std::string& msg) : idl_exception("Decode error: " + msg) {}
+};
+
+// Appends encoded values to a byte buffer
+class writer {
+public:
+    void write_byte(uint8_t value) { m_bytes.push_back(value); }
+
+    void write_varint(uint64_t value) {
+        while (value >= 0x80) {
+            m_bytes.push_back(static_cast<uint8_t>(value | 0x80));
+            value >>= 7;
+        }
+        m_bytes.push_back(static_cast<uint8_t>(value));
+    }
+
+    void write_fixed(uint64_t value, size_t size) {
+        for (size_t i = 0; i < size; ++i) {
+            m_bytes.push_back(static_cast<uint8_t>(value >> (8 * i)));
+        }
+    }
+
+    void write_string(std::string_view value) {
+        write_varint(value.size());
+        m_bytes.insert(m_bytes.end(), value.begin(), value.end());
+    }
+
+    void write_bytes(const void* data, size_t size) {
+        const uint8_t* bytes = static_cast<const uint8_t*>(data);
+        m_bytes.insert(m_bytes.end(), bytes, bytes + size);
+    }
+
+    // Overwrites size bytes at offset, for a length only known afterwards
+    void patch_fixed(size_t offset, uint64_t value, size_t size) noexcept {
+        for (size_t i = 0; i < size; ++i) {
+            m_bytes[offset + i] = static_cast<uint8_t>(value >> (8 * i));
+        }
+    }
+
+    size_t size() const noexcept { return m_bytes.size(); }
+
+    // Drops everything after the first size bytes, keeping the capacity
+    void truncate(size_t size) noexcept {
+        if (size < m_bytes.size()) {
+            m_bytes.resize(size);
+        }
+    }
+
+    const std::vector<uint8_t>& bytes() const noexcept { return m_bytes; }
+    std::vector<uint8_t> release() noexcept { return std::move(m_bytes); }
+
+private:
+    std::vector<uint8_t> m_bytes;
+};
+
+// Reads encoded values from borrowed bytes, such as a memory-mapped file.
+// Views returned by read_view() point into those bytes and stay valid only
+// as long as they do.
+class reader {
+public:
+    reader(const void* data, size_t size) noexcept
+        : m_pos(static_cast<const uint8_t*>(data)), m_end(m_pos + size) {}
+    explicit reader(const std::vector<uint8_t>& bytes) noexcept
+        : reader(bytes.data(), bytes.size()) {}
+
+    const uint8_t* position() const noexcept { return m_pos; }
+    size_t remaining() const noexcept { return static_cast<size_t>(m_end - m_pos); }
+    bool at_end() const noexcept { return m_pos == m_end; }
+
+    uint8_t read_byte() {
+        require(1);
+        return *m_pos++;
+    }
+
+    uint64_t read_varint() {
+        uint64_t value = 0;
+        for (unsigned shift = 0; shift < 64; shift += 7) {
+            uint8_t byte = read_byte();
+            value |= static_cast<uint64_t>(byte & 0x7F) << shift;
+            if (!(byte & 0x80)) {
+                return value;
+            }
+        }
+        throw decode_error("varint is too long");
+    }
+
+    uint64_t read_fixed(size_t size) {
+        require(size);
+        uint64_t value = 0;
+        for (size_t i = 0; i < size; ++i) {
+            value |= static_cast<uint64_t>(m_pos[i]) << (8 * i);
+        }
+        m_pos += size;
+        return value;
+    }
+
+    // Element count of a collection. Every element takes at least one byte,
+    // so a corrupt count cannot make the caller reserve more than the input.
+    size_t read_count() {
+        uint64_t count = read_varint();
+        if (count > remaining()) {
+            throw decode_error("collection is longer than the input");
+        }
+        return static_cast<size_t>(count);
+    }
+
+    std::string_view read_view() {
+        uint64_t size = read_varint();
+        require(size);
+        std::string_view value(reinterpret_cast<const char*>(m_pos), static_cast<size_t>(size));
+        m_pos += size;
+        return value;
+    }
+
+private:
+    void require(uint64_t size) const {
+        if (size > remaining()) {
+            throw decode_error("unexpected end of input");
+        }
+    }
+
+    const uint8_t* m_pos;
+    const uint8_t* m_end;
+};
+
+inline uint64_t zigzag(int64_t value) noexcept {
+    return (static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> 63);
+}
+
+inline int64_t unzigzag(uint64_t value) noexcept {
+    return static_cast<int64_t>(value >> 1) ^ -static_cast<int64_t>(value & 1);
+}
+
+inline void encode(writer& out, bool value) { out.write_byte(value ? 1 : 0); }
+inline void encode(writer& out, int32_t value) { out.write_varint(zigzag(value)); }
+inline void encode(writer& out, int64_t value) { out.write_varint(zigzag(value)); }
+
+inline void encode(writer& out, float value) {
+    uint32_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    out.write_fixed(bits, sizeof(bits));
+}
+
+inline void encode(writer& out, double value) {
+    uint64_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    out.write_fixed(bits, sizeof(bits));
+}
+
+inline void encode(writer& out, const std::string& value) { out.write_string(value); }
+#ifdef MINIMIDL_HAS_PMR
+inline void encode(writer& out, const std::pmr::string& value) { out.write_string(value); }
+#endif
+
+template<size_t N>
+void encode(writer& out, const fixed_string<N>& value) { out.write_string(value.view()); }
+
+// Ids travel as their text, since entries are local to a process
+inline void encode(writer& out, id value) { out.write_string(value.view()); }
+
+template<typename E, std::enable_if_t<std::is_enum_v<E>, int> = 0>
+void encode(writer& out, E value) {
+    out.write_varint(zigzag(static_cast<int64_t>(static_cast<std::underlying_type_t<E>>(value))));
+}
+
+inline void decode(reader& in, bool& value) {
+    uint8_t byte = in.read_byte();
+    if (byte > 1) {
+        throw decode_error("invalid bool");
+    }
+    value = byte == 1;
+}
+
+inline void decode(reader& in, int64_t& value) { value = unzigzag(in.read_varint()); }
+
+inline void decode(reader& in, int32_t& value) {
+    int64_t wide = unzigzag(in.read_varint());
+    if (wide < std::numeric_limits<int32_t>::min() || wide > std::numeric_limits<int32_t>::max()) {
+        throw decode_error("int32_t out of range");
+    }
+    value = static_cast<int32_t>(wide);
+}
+
+inline void decode(reader& in, float& value) {
+    uint32_t bits = static_cast<uint32_t>(in.read_fixed(sizeof(bits)));
+    std::memcpy(&value, &bits, sizeof(value));
+}
+
+inline void decode(reader& in, double& value) {
+    uint64_t bits = in.read_fixed(sizeof(bits));
+    std::memcpy(&value, &bits, sizeof(value));
+}
+
+inline void decode(reader& in, std::string& value) { value.assign(in.read_view()); }
+#ifdef MINIMIDL_HAS_PMR
+inline void decode(reader& in, std::pmr::string& value) { value.assign(in.read_view()); }
+#endif
+
+template<size_t N>
+void decode(reader& in, fixed_string<N>& value) { value.assign(in.read_view()); }
+
+inline void decode(reader& in, id& value) { value = id(in.read_view()); }
+
+template<typename E, std::enable_if_t<std::is_enum_v<E>, int> = 0>
+void decode(reader& in, E& value) {
+    using U = std::underlying_type_t<E>;
+    int64_t wide = unzigzag(in.read_varint());
+    if (wide < static_cast<int64_t>(std::numeric_limits<U>::min()) ||
+        wide > static_cast<int64_t>(std::numeric_limits<U>::max())) {
+        throw decode_error("enum value out of range");
+    }
+    value = static_cast<E>(static_cast<U>(wide));
+}
+
+// Collections and nullable values. Declared first so nested collections
+// find each other; generated structs and records are found by ADL.
+template<typename T, typename A> void encode(writer& out, const std::vector<T, A>& value);
+template<typename T, typename H, typename E, typename A>
+void encode(writer& out, const std::unordered_set<T, H, E, A>& value);
+template<typename K, typename V, typename H, typename E, typename A>
+void encode(writer& out, const std::unordered_map<K, V, H, E, A>& value);
+template<typename T, typename A> void encode(writer& out, const flat_set<T, A>& value);
+template<typename K, typename V, typename A> void encode(writer& out, const flat_map<K, V, A>& value);
+template<typename T> void encode(writer& out, const std::optional<T>& value);
+template<typename T> void encode(writer& out, const std::shared_ptr<T>& value);
+template<typename T, typename A> void decode(reader& in, std::vector<T, A>& value);
+template<typename T, typename H, typename E, typename A>
+void decode(reader& in, std::unordered_set<T, H, E, A>& value);
+template<typename K, typename V, typename H, typename E, typename A>
+void decode(reader& in, std::unordered_map<K, V, H, E, A>& value);
+template<typename T, typename A> void decode(reader& in, flat_set<T, A>& value);
+template<typename K, typename V, typename A> void decode(reader& in, flat_map<K, V, A>& value);
+template<typename T> void decode(reader& in, std::optional<T>& value);
+template<typename T> void decode(reader& in, std::shared_ptr<T>& value);
+
+template<typename T, typename A>
+void encode(writer& out, const std::vector<T, A>& value) {
+    out.write_varint(value.size());
+    for (const auto& item : value) {
+        encode(out, item);
+    }
+}
+
+template<typename T, typename H, typename E, typename A>
+void encode(writer& out, const std::unordered_set<T, H, E, A>& value) {
+    out.write_varint(value.size());
+    for (const auto& item : value) {
+        encode(out, item);
+    }
+}
+
+template<typename K, typename V, typename H, typename E, typename A>
+void encode(writer& out, const std::unordered_map<K, V, H, E, A>& value) {
+    out.write_varint(value.size());
+    for (const auto& [key, item] : value) {
+        encode(out, key);
+        encode(out, item);
+    }
+}
+
+template<typename T, typename A>
+void encode(writer& out, const flat_set<T, A>& value) {
+    out.write_varint(value.size());
+    for (const auto& item : value) {
+        encode(out, item);
+    }
+}
+
+template<typename K, typename V, typename A>
+void encode(writer& out, const flat_map<K, V, A>& value) {
+    out.write_varint(value.size());
+    for (const auto& [key, item] : value) {
+        encode(out, key);
+        encode(out, item);
+    }
+}
+
+template<typename T>
+void encode(writer& out, const std::optional<T>& value) {
+    out.write_byte(value ? 1 : 0);
+    if (value) {
+        encode(out, *value);
+    }
+}
+
+template<typename T>
+void encode(writer& out, const std::shared_ptr<T>& value) {
+    out.write_byte(value ? 1 : 0);
+    if (value) {
+        encode(out, *value);
+    }
+}
+
+template<typename T, typename A>
+void decode(reader& in, std::vector<T, A>& value) {
+    size_t count = in.read_count();
+    value.clear();
+    value.reserve(count);
+    for (size_t i = 0; i < count; ++i) {
+        T item = detail::make_with<T>(value.get_allocator());
+        decode(in, item);
+        value.push_back(std::move(item));
+    }
+}
+
+template<typename T, typename H, typename E, typename A>
+void decode(reader& in, std::unordered_set<T, H, E, A>& value) {
+    size_t count = in.read_count();
+    value.clear();
+    value.reserve(count);
+    for (size_t i = 0; i < count; ++i) {
+        T item = detail::make_with<T>(value.get_allocator());
+        decode(in, item);
+        value.insert(std::move(item));
+    }
+}
+
+template<typename K, typename V, typename H, typename E, typename A>
+void decode(reader& in, std::unordered_map<K, V, H, E, A>& value) {
+    size_t count = in.read_count();
+    value.clear();
+    value.reserve(count);
+    for (size_t i = 0; i < count; ++i) {
+        K key = detail::make_with<K>(value.get_allocator());
+        decode(in, key);
+        decode(in, value[std::move(key)]);
+    }
+}
+
+template<typename T, typename A>
+void decode(reader& in, flat_set<T, A>& value) {
+    size_t count = in.read_count();
+    value.clear();
+    value.reserve(count);
+    for (size_t i = 0; i < count; ++i) {
+        T item = detail::make_with<T>(value.get_allocator());
+        decode(in, item);
+        value.insert(std::move(item));
+    }
+}
+
+// Encoded flat maps are in key order, so each entry is appended
+template<typename K, typename V, typename A>
+void decode(reader& in, flat_map<K, V, A>& value) {
+    size_t count = in.read_count();
+    value.clear();
+    value.reserve(count);
+    for (size_t i = 0; i < count; ++i) {
+        K key = detail::make_with<K>(value.get_allocator());
+        decode(in, key);
+        decode(in, value[std::move(key)]);
+    }
+}
+
+template<typename T>
+void decode(reader& in, std::optional<T>& value) {
+    bool present = false;
+    decode(in, present);
+    value.reset();
+    if (present) {
+        decode(in, value.emplace());
+    }
+}
+
+template<typename T>
+void decode(reader& in, std::shared_ptr<T>& value) {
+    bool present = false;
+    decode(in, present);
+    value.reset();
+    if (present) {
+        value = std::make_shared<T>();
+        decode(in, *value);
+    }
+}
+
+// Nullable string read in place
+inline std::optional<std::string_view> read_optional_view(reader& in) {
+    bool present = false;
+    decode(in, present);
+    if (!present) {
+        return std::nullopt;
+    }
+    return in.read_view();
+}
+
+namespace detail {
+
+template<typename T>
+void decode_item(reader& in, T& value) {
+    decode(in, value);
+}
+
+template<typename T> struct is_sequence : std::false_type {};
+template<typename T, typename A> struct is_sequence<std::vector<T, A>> : std::true_type {};
+template<typename T, typename H, typename E, typename A>
+struct is_sequence<std::unordered_set<T, H, E, A>> : std::true_type {};
+template<typename T, typename A> struct is_sequence<flat_set<T, A>> : std::true_type {};
+
+template<typename T> struct is_map : std::false_type {};
+template<typename K, typename V, typename H, typename E, typename A>
+struct is_map<std::unordered_map<K, V, H, E, A>> : std::true_type {};
+template<typename K, typename V, typename A> struct is_map<flat_map<K, V, A>> : std::true_type {};
+
+template<typename T> struct is_string : std::false_type {};
+template<typename A>
+struct is_string<std::basic_string<char, std::char_traits<char>, A>> : std::true_type {};
+
+template<typename T> struct is_nullable : std::false_type {};
+template<typename T> struct is_nullable<std::optional<T>> : std::true_type { using element = T; };
+template<typename T> struct is_nullable<std::shared_ptr<T>> : std::true_type { using element = T; };
+
+} // namespace detail
+
+// Steps over an encoded T without allocating. Strings and containers are
+// only walked; anything else is plain data and decoded into a temporary.
+template<typename T>
+void skip(reader& in) {
+    if constexpr (detail::is_string<T>::value) {
+        in.read_view();
+    } else if constexpr (detail::is_sequence<T>::value) {
+        for (size_t count = in.read_count(); count > 0; --count) {
+            skip<typename T::value_type>(in);
+        }
+    } else if constexpr (detail::is_map<T>::value) {
+        for (size_t count = in.read_count(); count > 0; --count) {
+            skip<typename T::key_type>(in);
+            skip<typename T::mapped_type>(in);
+        }
+    } else if constexpr (detail::is_nullable<T>::value) {
+        bool present = false;
+        decode(in, present);
+        if (present) {
+            skip<typename detail::is_nullable<T>::element>(in);
+        }
+    } else {
+        T value{};
+        detail::decode_item(in, value);
+    }
+}
+
+// Encoded T left in the input bytes, decoded only when asked for. Views use
+// it for collections so reading a record does not build them up front.
+template<typename T>
+class encoded {
+public:
+    encoded() = default;
+    encoded(const uint8_t* data, size_t size) noexcept : m_data(data), m_size(size) {}
+
+    // Reads the encoded value from in, leaving in after it
+    static encoded read(reader& in) {
+        const uint8_t* start = in.position();
+        skip<T>(in);
+        return encoded(start, static_cast<size_t>(in.position() - start));
+    }
+
+    const uint8_t* data() const noexcept { return m_data; }
+    size_t size() const noexcept { return m_size; }
+
+    T decode() const {
+        T value{};
+        if (m_data) {
+            reader in(m_data, m_size);
+            detail::decode_item(in, value);
+        }
+        return value;
+    }
+
+private:
+    const uint8_t* m_data = nullptr;
+    size_t m_size = 0;
+};
+
+} // namespace wire
+
+// Interface casting utilities
+template<typename To, typename From>
+object_ptr<To> interface_cast(const object_ptr<From>& from) {
+    return object_ptr<To>(dynamic_cast<To*>(from.get()));
+}
+
+template<typename To, typename From>
+object_ptr<To> interface_cast_required(const object_ptr<From>& from, 
+                                      const char* context = "") {
+    auto result = interface_cast<To>(from);
+    if (!result && from) {
+        throw idl_exception(std::string("Invalid cast: ") + context);
+    }
+    return result;
+}
 
 } // namespace minimidl
+
+// Hashing by identity, so object pointers and ids can be set elements and map keys
+namespace std {
+template<typename T>
+struct hash<minimidl::object_ptr<T>> {
+    size_t operator()(const minimidl::object_ptr<T>& ptr) const noexcept {
+        return hash<T*>()(ptr.get());
+    }
+};
+
+// The hash computed when the id was interned
+template<>
+struct hash<minimidl::id> {
+    size_t operator()(minimidl::id value) const noexcept { return value.hash(); }
+};
+} // namespace std
+
+// Convenience aliases in global namespace (optional)
+namespace idl = minimidl;
\ No newline at end of file
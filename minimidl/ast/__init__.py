@@ -8,7 +8,9 @@ from minimidl.ast.nodes import (
     DictType,
     Enum,
     EnumValue,
+    Event,
     Expression,
+    FixedStringType,
     ForwardDeclaration,
     IDLFile,
     Interface,
@@ -19,6 +21,9 @@ from minimidl.ast.nodes import (
     PrimitiveType,
     Property,
     SetType,
+    StreamType,
+    Struct,
+    StructField,
     Type,
     Typedef,
     TypeRef,
@@ -35,6 +40,7 @@ __all__ = [
     "IDLFile",
     "Namespace",
     "Interface",
+    "Struct",
     "Enum",
     "Typedef",
     "Constant",
@@ -42,14 +48,19 @@ __all__ = [
     # Interface members
     "Method",
     "Property",
+    "Event",
     "Parameter",
+    # Struct members
+    "StructField",
     # Types
     "PrimitiveType",
     "TypeRef",
     "ArrayType",
     "DictType",
     "SetType",
+    "StreamType",
     "NullableType",
+    "FixedStringType",
     # Values
     "EnumValue",
     "ConstantValue",
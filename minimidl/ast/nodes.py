@@ -82,6 +82,7 @@ class PrimitiveType(Type):
             "float",
             "double",
             "string_t",
+            "id_t",
         }
         if v not in valid_types:
             raise ValueError(f"Invalid primitive type: {v}")
@@ -113,12 +114,24 @@ class SetType(Type):
     element_type: Type
 
 
+class StreamType(Type):
+    """Pull-based sequence returned by a method, read item by item."""
+
+    element_type: Type
+
+
 class NullableType(Type):
     """Nullable type wrapper."""
 
     inner_type: Type
 
 
+class FixedStringType(Type):
+    """Fixed-capacity string stored inline in a struct field."""
+
+    capacity: int  # Buffer size in bytes, including the NUL terminator
+
+
 class Parameter(ASTNode):
     """Method parameter definition."""
 
@@ -132,6 +145,15 @@ class Method(ASTNode):
     name: str
     return_type: Type
     parameters: list[Parameter] = Field(default_factory=list)
+    noexcept: bool = False
+    is_async: bool = False  # Declared with the async modifier
+
+
+class Event(ASTNode):
+    """Interface event definition: a notification sent to subscribers."""
+
+    name: str
+    parameters: list[Parameter] = Field(default_factory=list)
 
 
 class Property(ASTNode):
@@ -140,6 +162,7 @@ class Property(ASTNode):
     name: str
     type: Type
     writable: bool = False
+    attributes: list[str] = Field(default_factory=list)
 
 
 class Interface(ASTNode):
@@ -148,6 +171,22 @@ class Interface(ASTNode):
     name: str
     methods: list[Method] = Field(default_factory=list)
     properties: list[Property] = Field(default_factory=list)
+    events: list[Event] = Field(default_factory=list)
+    attributes: list[str] = Field(default_factory=list)
+
+
+class StructField(ASTNode):
+    """Struct field definition."""
+
+    name: str
+    type: Type
+
+
+class Struct(ASTNode):
+    """Plain-data struct definition."""
+
+    name: str
+    fields: list[StructField] = Field(default_factory=list)
 
 
 class ForwardDeclaration(ASTNode):
@@ -220,6 +259,7 @@ class Namespace(ASTNode):
 
     name: str
     interfaces: list[Interface] = Field(default_factory=list)
+    structs: list[Struct] = Field(default_factory=list)
     enums: list[Enum] = Field(default_factory=list)
     typedefs: list[Typedef] = Field(default_factory=list)
     constants: list[Constant] = Field(default_factory=list)
@@ -234,7 +274,16 @@ class IDLFile(ASTNode):
 
 
 # Type aliases for better readability
-AnyType = Union[PrimitiveType, TypeRef, ArrayType, DictType, SetType, NullableType]
+AnyType = Union[
+    PrimitiveType,
+    TypeRef,
+    ArrayType,
+    DictType,
+    SetType,
+    StreamType,
+    NullableType,
+    FixedStringType,
+]
 AnyExpression = Union[
     LiteralExpression,
     IdentifierExpression,
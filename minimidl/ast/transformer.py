@@ -12,7 +12,9 @@ from minimidl.ast.nodes import (
     DictType,
     Enum,
     EnumValue,
+    Event,
     Expression,
+    FixedStringType,
     ForwardDeclaration,
     IdentifierExpression,
     IDLFile,
@@ -26,6 +28,9 @@ from minimidl.ast.nodes import (
     PrimitiveType,
     Property,
     SetType,
+    StreamType,
+    Struct,
+    StructField,
     Type,
     Typedef,
     TypeRef,
@@ -65,6 +70,7 @@ class IDLTransformer(Transformer):
         return Namespace(
             name=name,
             interfaces=namespace_body.get("interfaces", []),
+            structs=namespace_body.get("structs", []),
             enums=namespace_body.get("enums", []),
             typedefs=namespace_body.get("typedefs", []),
             constants=namespace_body.get("constants", []),
@@ -77,6 +83,7 @@ class IDLTransformer(Transformer):
         """Transform namespace body."""
         result: dict[str, list[Any]] = {
             "interfaces": [],
+            "structs": [],
             "enums": [],
             "typedefs": [],
             "constants": [],
@@ -86,6 +93,8 @@ class IDLTransformer(Transformer):
         for item in items:
             if isinstance(item, Interface):
                 result["interfaces"].append(item)
+            elif isinstance(item, Struct):
+                result["structs"].append(item)
             elif isinstance(item, Enum):
                 result["enums"].append(item)
             elif isinstance(item, Typedef):
@@ -109,31 +118,50 @@ class IDLTransformer(Transformer):
     # Interface
     def interface_decl(self, items: list[Any]) -> Interface:
         """Transform interface declaration."""
+        attributes: list[str] = []
+        if isinstance(items[0], list):
+            attributes = items[0]
+            items = items[1:]
+
         name = items[0].value
         methods = []
         properties = []
+        events = []
 
         for item in items[1:]:
             if isinstance(item, Method):
                 methods.append(item)
             elif isinstance(item, Property):
                 properties.append(item)
+            elif isinstance(item, Event):
+                events.append(item)
 
         return Interface(
             name=name,
             methods=methods,
             properties=properties,
+            events=events,
+            attributes=attributes,
             line=self._update_position(items[0])[0],
             column=self._update_position(items[0])[1],
         )
 
-    def interface_member(self, items: list[Any]) -> Union[Method, Property]:
+    def attribute_list(self, items: list[Token]) -> list[str]:
+        """Transform attribute list."""
+        return [item.value for item in items]
+
+    def interface_member(self, items: list[Any]) -> Union[Method, Property, Event]:
         """Transform interface member."""
         return items[0]
 
     # Property
     def property_decl(self, items: list[Any]) -> Property:
         """Transform property declaration."""
+        attributes: list[str] = []
+        if isinstance(items[0], list):
+            attributes = items[0]
+            items = items[1:]
+
         type_spec = items[0]
         name = items[1].value
         writable = len(items) > 2 and items[2] is not None
@@ -142,6 +170,7 @@ class IDLTransformer(Transformer):
             name=name,
             type=type_spec,
             writable=writable,
+            attributes=attributes,
             line=self._update_position(items[1])[0],
             column=self._update_position(items[1])[1],
         )
@@ -153,18 +182,47 @@ class IDLTransformer(Transformer):
     # Method
     def method_decl(self, items: list[Any]) -> Method:
         """Transform method declaration."""
+        is_async = items[0] == "async"
+        if is_async:
+            items = items[1:]
         return_type = items[0]
         name = items[1].value
-        parameters = items[2] if len(items) > 2 and items[2] else []
+        parameters: list[Parameter] = []
+        noexcept = False
+        for item in items[2:]:
+            if isinstance(item, list):
+                parameters = item
+            elif item is True:
+                noexcept = True
 
         return Method(
             name=name,
             return_type=return_type,
             parameters=parameters,
+            noexcept=noexcept,
+            is_async=is_async,
             line=self._update_position(items[1])[0],
             column=self._update_position(items[1])[1],
         )
 
+    def async_modifier(self, items: list[Any]) -> str:
+        """Transform async modifier."""
+        return "async"
+
+    def noexcept(self, items: list[Any]) -> bool:
+        """Transform noexcept specifier."""
+        return True
+
+    # Event
+    def event_decl(self, items: list[Any]) -> Event:
+        """Transform event declaration."""
+        return Event(
+            name=items[0].value,
+            parameters=items[1] if len(items) > 1 else [],
+            line=self._update_position(items[0])[0],
+            column=self._update_position(items[0])[1],
+        )
+
     def parameter_list(self, items: list[Parameter]) -> list[Parameter]:
         """Transform parameter list."""
         return items
@@ -178,6 +236,33 @@ class IDLTransformer(Transformer):
             column=self._update_position(items[1])[1],
         )
 
+    # Struct
+    def struct_decl(self, items: list[Any]) -> Struct:
+        """Transform struct declaration."""
+        return Struct(
+            name=items[0].value,
+            fields=items[1:],
+            line=self._update_position(items[0])[0],
+            column=self._update_position(items[0])[1],
+        )
+
+    def struct_field(self, items: list[Any]) -> StructField:
+        """Transform struct field."""
+        return StructField(
+            type=items[0],
+            name=items[1].value,
+            line=self._update_position(items[1])[0],
+            column=self._update_position(items[1])[1],
+        )
+
+    def field_type(self, items: list[Type]) -> Type:
+        """Transform struct field type."""
+        return items[0]
+
+    def fixed_string_type(self, items: list[Token]) -> FixedStringType:
+        """Transform fixed-capacity string type."""
+        return FixedStringType(capacity=int(items[0].value))
+
     # Enum
     def enum_decl(self, items: list[Any]) -> Enum:
         """Transform enum declaration."""
@@ -261,6 +346,10 @@ class IDLTransformer(Transformer):
         """Transform set type."""
         return SetType(element_type=items[0])
 
+    def stream_type(self, items: list[Type]) -> StreamType:
+        """Transform stream type."""
+        return StreamType(element_type=items[0])
+
     def basic_type(self, items: list[Any]) -> Type:
         """Transform basic type."""
         item = items[0]
@@ -286,6 +375,10 @@ class IDLTransformer(Transformer):
         """Transform string type."""
         return PrimitiveType(name="string_t")
 
+    def id_type(self, items: list[Token]) -> PrimitiveType:
+        """Transform interned identifier type."""
+        return PrimitiveType(name="id_t")
+
     # Expressions
     def expression(self, items: list[Expression]) -> Expression:
         """Transform expression."""
@@ -7,19 +7,36 @@ from loguru import logger
 from minimidl.ast.nodes import (
     Constant,
     Enum,
+    Event,
     ForwardDeclaration,
     IDLFile,
     Interface,
     Method,
     Namespace,
     Parameter,
+    PrimitiveType,
     Property,
+    StreamType,
+    Struct,
     Type,
     Typedef,
     TypeRef,
 )
 
 
+# Attributes accepted in front of an interface declaration
+INTERFACE_ATTRIBUTES = frozenset({"sealed", "threadsafe"})
+
+# Attributes accepted in front of a property declaration
+PROPERTY_ATTRIBUTES = frozenset({"immutable", "readmostly"})
+
+# Parameter names taken by the completion arguments of async C entry points
+ASYNC_RESERVED_PARAMETERS = frozenset({"callback", "context"})
+
+# Parameter name taken by the context argument of event callbacks
+EVENT_RESERVED_PARAMETERS = frozenset({"context"})
+
+
 class ValidationError(Exception):
     """Semantic validation error."""
 
@@ -79,6 +96,10 @@ class SemanticValidator:
         for interface in namespace.interfaces:
             self._register_type(interface.name, "interface")
 
+        # Register structs
+        for struct in namespace.structs:
+            self._register_type(struct.name, "struct")
+
         # Register enums
         for enum in namespace.enums:
             self._register_type(enum.name, "enum")
@@ -111,6 +132,12 @@ class SemanticValidator:
         for interface in namespace.interfaces:
             self._validate_interface(interface)
 
+        # Validate all structs
+        declared: set[str] = set()
+        for struct in namespace.structs:
+            self._validate_struct(struct, declared)
+            declared.add(struct.name)
+
         # Validate all enums
         for enum in namespace.enums:
             self._validate_enum(enum)
@@ -125,6 +152,11 @@ class SemanticValidator:
 
     def _validate_interface(self, interface: Interface) -> None:
         """Validate an interface."""
+        # Check attributes
+        self._validate_attributes(
+            interface.attributes, INTERFACE_ATTRIBUTES, f"interface {interface.name}", interface
+        )
+
         # Check for duplicate method names
         method_names = set()
         for method in interface.methods:
@@ -161,13 +193,77 @@ class SemanticValidator:
                     )
                 )
 
+            self._validate_attributes(
+                prop.attributes,
+                PROPERTY_ATTRIBUTES,
+                f"property {interface.name}::{prop.name}",
+                prop,
+            )
+            if "immutable" in prop.attributes and prop.writable:
+                self.errors.append(
+                    ValidationError(
+                        f"Immutable property {interface.name}::{prop.name} cannot be writable",
+                        prop,
+                    )
+                )
+            if "immutable" in prop.attributes and "readmostly" in prop.attributes:
+                self.errors.append(
+                    ValidationError(
+                        f"Property {interface.name}::{prop.name} cannot be both immutable and readmostly",
+                        prop,
+                    )
+                )
+
             # Validate property type
             self._validate_type(prop.type, f"property {prop.name}")
 
+        # Check events and their name conflicts
+        event_names = set()
+        for event in interface.events:
+            if event.name in event_names:
+                self.errors.append(
+                    ValidationError(
+                        f"Duplicate event name '{event.name}' in interface {interface.name}",
+                        event,
+                    )
+                )
+            elif event.name in method_names or event.name in property_names:
+                self.errors.append(
+                    ValidationError(
+                        f"Event '{event.name}' conflicts with a member name in interface {interface.name}",
+                        event,
+                    )
+                )
+            event_names.add(event.name)
+            self._validate_event(event, interface.name)
+
+    def _validate_attributes(
+        self, attributes: list[str], allowed: frozenset[str], context: str, node: Any
+    ) -> None:
+        """Check that attributes are known and not repeated."""
+        seen_attributes = set()
+        for attribute in attributes:
+            if attribute not in allowed:
+                self.errors.append(ValidationError(f"Unknown attribute '{attribute}' on {context}", node))
+            elif attribute in seen_attributes:
+                self.errors.append(ValidationError(f"Duplicate attribute '{attribute}' on {context}", node))
+            seen_attributes.add(attribute)
+
     def _validate_method(self, method: Method, interface_name: str) -> None:
         """Validate a method."""
-        # Validate return type
-        self._validate_type(method.return_type, f"return type of {method.name}")
+        if method.is_async and method.noexcept:
+            self.errors.append(
+                ValidationError(
+                    f"Async method {interface_name}::{method.name} cannot be noexcept",
+                    method,
+                )
+            )
+
+        # Validate return type; streams are only allowed here
+        if isinstance(method.return_type, StreamType):
+            self._validate_stream(method, interface_name)
+        else:
+            self._validate_type(method.return_type, f"return type of {method.name}")
 
         # Validate parameters
         param_names = set()
@@ -181,22 +277,108 @@ class SemanticValidator:
                 )
             param_names.add(param.name)
 
+            if method.is_async and param.name in ASYNC_RESERVED_PARAMETERS:
+                self.errors.append(
+                    ValidationError(
+                        f"Parameter name '{param.name}' is reserved in async method {interface_name}::{method.name}",
+                        param,
+                    )
+                )
+
             # Validate parameter type
             self._validate_type(
                 param.type, f"parameter '{param.name}' of {method.name}"
             )
 
+    def _validate_event(self, event: Event, interface_name: str) -> None:
+        """Validate an event.
+
+        Notifications are queued and delivered later, so their arguments are
+        values: primitives, strings, enums or structs.
+        """
+        param_names = set()
+        for param in event.parameters:
+            context = f"parameter '{param.name}' of event {interface_name}::{event.name}"
+            if param.name in param_names:
+                self.errors.append(
+                    ValidationError(
+                        f"Duplicate parameter name '{param.name}' in event {interface_name}::{event.name}",
+                        param,
+                    )
+                )
+            param_names.add(param.name)
+
+            if param.name in EVENT_RESERVED_PARAMETERS:
+                self.errors.append(
+                    ValidationError(
+                        f"Parameter name '{param.name}' is reserved in event {interface_name}::{event.name}",
+                        param,
+                    )
+                )
+
+            param_type = param.type
+            if isinstance(param_type, PrimitiveType):
+                if param_type.name == "void":
+                    self.errors.append(ValidationError(f"Invalid void type in {context}", param))
+            elif isinstance(param_type, TypeRef) and self._type_kind(param_type.name) in (
+                "enum",
+                "struct",
+            ):
+                continue
+            elif isinstance(param_type, TypeRef) and not self._type_exists(param_type.name):
+                self.errors.append(
+                    ValidationError(f"Unknown type '{param_type.name}' in {context}", param)
+                )
+            else:
+                self.errors.append(
+                    ValidationError(
+                        f"Invalid type in {context}: event parameters must be primitives, strings, enums or structs",
+                        param,
+                    )
+                )
+
+    def _validate_stream(self, method: Method, interface_name: str) -> None:
+        """Validate a method returning ``stream<T>``."""
+        element_type = method.return_type.element_type
+        context = f"stream element in return type of {method.name}"
+        if method.is_async:
+            self.errors.append(
+                ValidationError(
+                    f"Async method {interface_name}::{method.name} cannot return a stream",
+                    method,
+                )
+            )
+        if element_type == PrimitiveType(name="void"):
+            self.errors.append(ValidationError(f"Invalid void type in {context}", method))
+        else:
+            self._validate_type(element_type, context)
+
     def _validate_type(self, type_spec: Type, context: str) -> None:
         """Validate a type reference."""
         from minimidl.ast.nodes import (
             ArrayType,
             DictType,
+            FixedStringType,
             NullableType,
             PrimitiveType,
             SetType,
         )
 
-        if isinstance(type_spec, PrimitiveType):
+        if isinstance(type_spec, FixedStringType):
+            self.errors.append(
+                ValidationError(
+                    f"Fixed-size strings are only allowed in struct fields, not in {context}",
+                    type_spec,
+                )
+            )
+        elif isinstance(type_spec, StreamType):
+            self.errors.append(
+                ValidationError(
+                    f"Streams are only allowed as method return types, not in {context}",
+                    type_spec,
+                )
+            )
+        elif isinstance(type_spec, PrimitiveType):
             # Primitive types are always valid (validated by Pydantic)
             return
         elif isinstance(type_spec, TypeRef):
@@ -212,10 +394,34 @@ class SemanticValidator:
         elif isinstance(type_spec, DictType):
             self._validate_type(type_spec.key_type, f"dict key in {context}")
             self._validate_type(type_spec.value_type, f"dict value in {context}")
+            self._reject_struct(type_spec.key_type, f"dict key in {context}")
         elif isinstance(type_spec, SetType):
             self._validate_type(type_spec.element_type, f"set element in {context}")
+            self._reject_struct(type_spec.element_type, f"set element in {context}")
         elif isinstance(type_spec, NullableType):
             self._validate_type(type_spec.inner_type, f"nullable type in {context}")
+            self._reject_struct(type_spec.inner_type, f"nullable type in {context}")
+            inner = type_spec.inner_type
+            if isinstance(inner, PrimitiveType) and inner.name == "id_t":
+                self.errors.append(
+                    ValidationError(
+                        f"Nullable id in {context}; the empty id already means no id",
+                        type_spec,
+                    )
+                )
+
+    def _reject_struct(self, type_spec: Type, context: str) -> None:
+        """Report a struct used where it has no C or Swift lowering."""
+        if isinstance(type_spec, TypeRef) and self._type_kind(type_spec.name) == "struct":
+            self.errors.append(
+                ValidationError(
+                    f"Struct '{type_spec.name}' cannot be used as {context}", type_spec
+                )
+            )
+
+    def _type_kind(self, name: str) -> str | None:
+        """Get the registered kind of a type in the current namespace."""
+        return self.type_registry.get(f"{self.current_namespace}::{name}")
 
     def _type_exists(self, name: str) -> bool:
         """Check if a type exists in the registry."""
@@ -230,6 +436,91 @@ class SemanticValidator:
 
         return False
 
+    def _validate_struct(self, struct: Struct, declared: set[str]) -> None:
+        """Validate a struct.
+
+        Fields must have a fixed size so the struct has the same layout in
+        C++, C and Swift: primitives, enums, fixed-size strings, or structs
+        declared earlier in the namespace.
+
+        Args:
+            struct: The struct to validate.
+            declared: Names of the structs declared before this one.
+        """
+        from minimidl.ast.nodes import FixedStringType, PrimitiveType
+
+        if not struct.fields:
+            self.errors.append(
+                ValidationError(f"Struct {struct.name} must have at least one field", struct)
+            )
+
+        field_names = set()
+        for field in struct.fields:
+            if field.name in field_names:
+                self.errors.append(
+                    ValidationError(
+                        f"Duplicate field name '{field.name}' in struct {struct.name}",
+                        field,
+                    )
+                )
+            field_names.add(field.name)
+
+            context = f"field '{field.name}' of struct {struct.name}"
+            field_type = field.type
+            if isinstance(field_type, FixedStringType):
+                if field_type.capacity < 1:
+                    self.errors.append(
+                        ValidationError(
+                            f"Fixed-size string in {context} needs a capacity of at least 1",
+                            field,
+                        )
+                    )
+            elif isinstance(field_type, PrimitiveType):
+                if field_type.name == "string_t":
+                    self.errors.append(
+                        ValidationError(
+                            f"Variable-length string in {context}; use string_t<N>",
+                            field,
+                        )
+                    )
+                elif field_type.name == "id_t":
+                    self.errors.append(
+                        ValidationError(
+                            f"Interned id in {context}; ids are local to a process, use string_t<N>",
+                            field,
+                        )
+                    )
+                elif field_type.name == "void":
+                    self.errors.append(ValidationError(f"Invalid void type in {context}", field))
+            elif isinstance(field_type, TypeRef):
+                kind = self._type_kind(field_type.name)
+                if kind is None:
+                    self.errors.append(
+                        ValidationError(f"Unknown type '{field_type.name}' in {context}", field)
+                    )
+                elif kind == "struct":
+                    if field_type.name not in declared:
+                        self.errors.append(
+                            ValidationError(
+                                f"Struct '{field_type.name}' in {context} must be declared before {struct.name}",
+                                field,
+                            )
+                        )
+                elif kind != "enum":
+                    self.errors.append(
+                        ValidationError(
+                            f"Invalid type '{field_type.name}' in {context}: struct fields must be primitives, enums, fixed-size strings or structs",
+                            field,
+                        )
+                    )
+            else:
+                self.errors.append(
+                    ValidationError(
+                        f"Invalid type in {context}: struct fields must be primitives, enums, fixed-size strings or structs",
+                        field,
+                    )
+                )
+
     def _validate_enum(self, enum: Enum) -> None:
         """Validate an enum."""
         # Check for duplicate enum values
@@ -0,0 +1,157 @@
+"""Caches that let incremental generation skip work whose inputs are unchanged."""
+
+import hashlib
+import json
+from functools import cache
+from pathlib import Path
+from typing import Any
+
+from loguru import logger
+from pydantic import ValidationError
+
+from minimidl import __version__
+from minimidl.ast.nodes import IDLFile
+from minimidl.ast.serialization import load_ast, save_ast
+
+
+def content_hash(content: bytes | str) -> str:
+    """Get the SHA-256 hex digest of some content.
+
+    Args:
+        content: Bytes, or text hashed as UTF-8
+
+    Returns:
+        Hex digest
+    """
+    if isinstance(content, str):
+        content = content.encode("utf-8")
+    return hashlib.sha256(content).hexdigest()
+
+
+@cache
+def generator_fingerprint(template_dir: Path | None = None) -> str:
+    """Hash the version, sources and templates of the code generators.
+
+    Editing a generator or template changes the fingerprint without a
+    version bump, so cached outputs of an older generator are never reused.
+
+    Args:
+        template_dir: Custom template directory, hashed as well if given
+
+    Returns:
+        Hex digest
+    """
+    digest = hashlib.sha256(__version__.encode("utf-8"))
+    roots = [Path(__file__).parent]
+    if template_dir:
+        roots.append(template_dir)
+    for root in roots:
+        files = [
+            path
+            for path in root.rglob("*")
+            if path.is_file() and "__pycache__" not in path.parts
+        ]
+        for path in sorted(files):
+            digest.update(path.relative_to(root).as_posix().encode("utf-8"))
+            digest.update(path.read_bytes())
+    return digest.hexdigest()
+
+
+class GenerationCache:
+    """Parsed ASTs and generation stamps kept in a cache directory.
+
+    ASTs are stored under ``ast/`` by the hash of the IDL they were parsed
+    from. A stamp under ``stamps/`` records, per input file and target, the
+    key of the last generation and the hash of every file it wrote.
+    """
+
+    def __init__(self, cache_dir: Path) -> None:
+        """Initialize the cache.
+
+        Args:
+            cache_dir: Directory holding the cache; created when first written
+        """
+        self.cache_dir = cache_dir
+
+    def load_ast(self, source_hash: str) -> IDLFile | None:
+        """Get the AST cached for an IDL source, or None if there is none."""
+        path = self.cache_dir / "ast" / f"{source_hash}.json"
+        if not path.exists():
+            return None
+        try:
+            return load_ast(path)
+        except (ValueError, ValidationError) as e:
+            logger.warning(f"Ignoring unreadable cached AST {path}: {e}")
+            return None
+
+    def save_ast(self, source_hash: str, ast: IDLFile) -> None:
+        """Cache the validated AST of an IDL source."""
+        save_ast(ast, self.cache_dir / "ast" / f"{source_hash}.json")
+
+    def generation_key(
+        self,
+        source_hash: str,
+        target: str,
+        output_dir: Path,
+        config: dict[str, Any],
+        project: bool,
+        template_dir: Path | None,
+    ) -> str:
+        """Hash everything a generation's outputs depend on."""
+        inputs = {
+            "source": source_hash,
+            "generator": generator_fingerprint(template_dir),
+            "target": target,
+            "output": str(output_dir.resolve()),
+            "config": config,
+            "project": project,
+        }
+        return content_hash(json.dumps(inputs, sort_keys=True))
+
+    def is_fresh(self, source: Path, target: str, key: str) -> bool:
+        """Check if the outputs of the last generation are current and untouched.
+
+        Args:
+            source: IDL or AST file generated from
+            target: Target that was generated
+            key: Key of the generation about to run
+
+        Returns:
+            True if the last generation had the same key and none of its
+            outputs has been changed or removed since
+        """
+        path = self._stamp_path(source, target)
+        if not path.exists():
+            return False
+        try:
+            stamp = json.loads(path.read_text(encoding="utf-8"))
+        except ValueError:
+            return False
+        if stamp.get("key") != key:
+            return False
+        for output, expected in stamp.get("outputs", {}).items():
+            output_path = Path(output)
+            if not output_path.is_file() or content_hash(output_path.read_bytes()) != expected:
+                logger.debug(f"{output_path} changed since it was generated")
+                return False
+        return True
+
+    def record(self, source: Path, target: str, key: str, outputs: list[Path]) -> None:
+        """Remember a finished generation and the files it wrote."""
+        stamp = {
+            "source": str(source.resolve()),
+            "key": key,
+            "outputs": {
+                str(output.resolve()): content_hash(output.read_bytes())
+                for output in outputs
+                if output.is_file()
+            },
+        }
+        path = self._stamp_path(source, target)
+        path.parent.mkdir(parents=True, exist_ok=True)
+        path.write_text(json.dumps(stamp, indent=2), encoding="utf-8")
+
+    def _stamp_path(self, source: Path, target: str) -> Path:
+        """Get the stamp file of an input and target."""
+        name = content_hash(str(source.resolve()))[:16]
+        return self.cache_dir / "stamps" / f"{source.stem}-{name}-{target}.json"
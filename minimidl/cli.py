@@ -1,9 +1,12 @@
 """MinimIDL command-line interface."""
 
 import json as json_lib
+import os
 import sys
+from concurrent.futures import ProcessPoolExecutor
+from dataclasses import dataclass, field
 from pathlib import Path
-from typing import Annotated, Optional
+from typing import Annotated, Any, Optional
 
 import typer
 from loguru import logger
@@ -14,10 +17,15 @@ from minimidl import __version__
 from minimidl.ast.nodes import IDLFile
 from minimidl.ast.serialization import load_ast, save_ast
 from minimidl.ast.validator import SemanticValidator
+from minimidl.cache import GenerationCache, content_hash
 from minimidl.generators.c_wrapper import CWrapperGenerator
 from minimidl.generators.cpp import CppGenerator
+from minimidl.generators.remote import RemoteGenerator
+from minimidl.generators.serialization import SerializationGenerator
+from minimidl.generators.stress import StressGenerator
 from minimidl.generators.swift import SwiftGenerator
 from minimidl.parser import IDLParser
+from minimidl.parser.parser import get_parser
 from minimidl.workflows.c_workflow import CWorkflow
 from minimidl.workflows.cpp_workflow import CppWorkflow
 from minimidl.workflows.swift_workflow import SwiftWorkflow
@@ -139,9 +147,9 @@ def parse(
 
 @app.command()
 def generate(
-    idl_file: Annotated[
-        Optional[Path],
-        typer.Argument(help="IDL file to compile (or use --from-ast)"),
+    idl_files: Annotated[
+        Optional[list[Path]],
+        typer.Argument(help="IDL files to compile (or use --from-ast)"),
     ] = None,
     target: Annotated[
         str,
@@ -166,10 +174,116 @@ def generate(
         Optional[Path],
         typer.Option("--ast-file", help="AST cache file path"),
     ] = None,
+    incremental: Annotated[
+        bool,
+        typer.Option(
+            "--incremental",
+            help="Reuse cached ASTs and skip generation when the input, options and generator are unchanged",
+        ),
+    ] = False,
+    cache_dir: Annotated[
+        Optional[Path],
+        typer.Option(
+            "--cache-dir",
+            help="Cache directory for --incremental (default: <output>/.minimidl-cache)",
+        ),
+    ] = None,
+    jobs: Annotated[
+        int,
+        typer.Option(
+            "-j",
+            "--jobs",
+            help="Generate this many IDL files at once in worker processes (0: one per CPU)",
+        ),
+    ] = 1,
     enum_class: Annotated[
         bool,
         typer.Option("--enum-class", help="Use enum class for C++ generation"),
     ] = False,
+    string_views: Annotated[
+        bool,
+        typer.Option(
+            "--string-views",
+            help="Return borrowed string views from string getters (C++ and C)",
+        ),
+    ] = False,
+    pooled_allocator: Annotated[
+        bool,
+        typer.Option(
+            "--pooled-allocator",
+            help="Allocate C wrapper strings and collection handles from a size-class pool",
+        ),
+    ] = False,
+    flat_containers: Annotated[
+        bool,
+        typer.Option(
+            "--flat-containers",
+            help="Lower dict<> and set<> to sorted-vector maps and sets in one allocation (C++)",
+        ),
+    ] = False,
+    pmr: Annotated[
+        bool,
+        typer.Option(
+            "--pmr",
+            help="Use std::pmr strings and collections so results can live in a caller's memory resource (C++)",
+        ),
+    ] = False,
+    split_headers: Annotated[
+        bool,
+        typer.Option(
+            "--split-headers",
+            help="Split headers into forward declarations, types and one header per interface, plus a C++20 module (C++)",
+        ),
+    ] = False,
+    sink_setters: Annotated[
+        bool,
+        typer.Option(
+            "--sink-setters",
+            help="Take string and collection setter values by value so they can be moved",
+        ),
+    ] = False,
+    status_codes: Annotated[
+        bool,
+        typer.Option(
+            "--status-codes",
+            help="Return error codes from C wrapper accessors and methods, with results in out parameters",
+        ),
+    ] = False,
+    instrument: Annotated[
+        bool,
+        typer.Option(
+            "--instrument",
+            help="Record per-function call counts, latency and marshalled bytes in the C wrapper",
+        ),
+    ] = False,
+    serialization: Annotated[
+        bool,
+        typer.Option(
+            "--serialization",
+            help="Also generate binary encode/decode routines for structs and interface properties (C++)",
+        ),
+    ] = False,
+    remote: Annotated[
+        bool,
+        typer.Option(
+            "--remote",
+            help="Also generate proxies and stubs for calling interfaces over shared memory (C++)",
+        ),
+    ] = False,
+    with_benchmarks: Annotated[
+        bool,
+        typer.Option(
+            "--with-benchmarks",
+            help="Add a Google Benchmark target timing every call through C++ and C (C++ project)",
+        ),
+    ] = False,
+    with_stress: Annotated[
+        bool,
+        typer.Option(
+            "--with-stress",
+            help="Add a multi-threaded load test of the C wrapper reporting latency percentiles (C)",
+        ),
+    ] = False,
     template_dir: Annotated[
         Optional[Path],
         typer.Option("--templates", help="Custom template directory"),
@@ -179,69 +293,45 @@ def generate(
         typer.Option("--project", help="Generate complete project structure"),
     ] = True,
 ) -> None:
-    """Generate code from an IDL file.
-    
+    """Generate code from one or more IDL files.
+
+    Several IDL files are generated in one invocation, in parallel with
+    ``--jobs``.
+
     Examples:
         minimidl generate myapi.idl --target cpp
         minimidl generate myapi.idl --target all --output ./generated
         minimidl generate --from-ast myapi.ast --target swift
+        minimidl generate myapi.idl --incremental --output ./generated
+        minimidl generate idl/*.idl --jobs 8 --incremental --output ./generated
     """
     try:
         # Validate inputs
-        if not from_ast and not idl_file:
+        idl_files = idl_files or []
+        if not from_ast and not idl_files:
             console.print("[red]Error: Either provide an IDL file or use --from-ast[/red]")
             raise typer.Exit(1)
 
-        if from_ast and idl_file:
+        if from_ast and idl_files:
             console.print("[red]Error: Cannot use both IDL file and --from-ast[/red]")
             raise typer.Exit(1)
 
-        # Load or parse AST
-        if from_ast:
-            if not from_ast.exists():
-                console.print(f"[red]Error: AST file '{from_ast}' does not exist[/red]")
-                raise typer.Exit(1)
-            
-            logger.info(f"Loading AST from {from_ast}")
-            ast = load_ast(from_ast)
-        else:
-            if not idl_file.exists():
-                console.print(f"[red]Error: IDL file '{idl_file}' does not exist[/red]")
-                raise typer.Exit(1)
-            
-            # Parse IDL file
-            logger.info(f"Parsing {idl_file}")
-            content = idl_file.read_text()
-            parser = IDLParser()
-            ast = parser.parse(content)
-
-            # Cache AST if requested
-            if cache_ast:
-                ast_path = ast_file or idl_file.with_suffix(".ast")
-                logger.info(f"Caching AST to {ast_path}")
-                save_ast(ast, ast_path)
-                console.print(f"[green]✓[/green] AST cached to {ast_path}")
-
-        # Validate
-        validator = SemanticValidator()
-        errors = validator.validate(ast)
-
-        if errors:
-            console.print("[red]Validation errors:[/red]")
-            for error in errors:
-                console.print(f"  [yellow]•[/yellow] {error}")
+        if ast_file and len(idl_files) > 1:
+            console.print("[red]Error: --ast-file needs a single IDL file[/red]")
             raise typer.Exit(1)
 
-        # Ensure output directory exists
-        output_dir.mkdir(parents=True, exist_ok=True)
+        if jobs < 0:
+            console.print("[red]Error: --jobs cannot be negative[/red]")
+            raise typer.Exit(1)
 
-        # Configuration
-        config = {
-            "enum_class": enum_class,
-        }
+        sources = [from_ast] if from_ast else idl_files
+        for source in sources:
+            if not source.exists():
+                kind = "AST file" if from_ast else "IDL file"
+                console.print(f"[red]Error: {kind} '{source}' does not exist[/red]")
+                raise typer.Exit(1)
 
         # Generate based on target
-        targets = []
         if target == "all":
             targets = ["cpp", "c", "swift"]
         elif target in ["cpp", "c", "swift"]:
@@ -251,34 +341,219 @@ def generate(
             console.print("Valid targets: cpp, c, swift, all")
             raise typer.Exit(1)
 
+        # Configuration
+        config = {
+            "enum_class": enum_class,
+            "string_views": string_views,
+            "pooled_allocator": pooled_allocator,
+            "flat_containers": flat_containers,
+            "pmr": pmr,
+            "split_headers": split_headers,
+            "sink_setters": sink_setters,
+            "status_codes": status_codes,
+            "instrument": instrument,
+            "serialization": serialization,
+            "remote": remote,
+            "benchmarks": with_benchmarks,
+            "stress": with_stress,
+        }
+
+        requests = [
+            _GenerateRequest(
+                source=source,
+                from_ast=from_ast is not None,
+                target=target,
+                targets=targets,
+                output_dir=output_dir,
+                config=config,
+                template_dir=template_dir,
+                project=project,
+                cache_ast=cache_ast,
+                ast_file=ast_file,
+                cache_dir=(cache_dir or output_dir / ".minimidl-cache") if incremental else None,
+            )
+            for source in sources
+        ]
+
+        with console.status("[bold green]Generating code...[/bold green]"):
+            results = _run_requests(requests, jobs)
+
         total_files = 0
-        
-        with console.status("[bold green]Generating code...[/bold green]") as status:
-            for tgt in targets:
-                status.update(f"[bold green]Generating {tgt.upper()} code...[/bold green]")
-                
-                if project and tgt in ["cpp", "c", "swift"]:
-                    # Use workflow for complete project
-                    generated_files = _generate_with_workflow(
-                        ast, tgt, output_dir, config, template_dir
-                    )
-                else:
-                    # Use direct generator
-                    generated_files = _generate_direct(
-                        ast, tgt, output_dir, config, template_dir
-                    )
-                
-                total_files += len(generated_files)
-                console.print(f"[green]✓[/green] Generated {len(generated_files)} {tgt.upper()} files")
+        failed = False
+        for result in results:
+            if len(results) > 1 and not result.up_to_date:
+                console.print(f"[bold]{result.source}[/bold]")
+            if result.ast_path:
+                console.print(f"[green]✓[/green] AST cached to {result.ast_path}")
+            if result.failure:
+                failed = True
+                console.print(f"[red]Error: {result.failure}[/red]")
+            elif result.errors:
+                failed = True
+                console.print("[red]Validation errors:[/red]")
+                for error in result.errors:
+                    console.print(f"  [yellow]•[/yellow] {error}")
+            elif result.up_to_date:
+                console.print(f"[green]✓[/green] {result.source} is up to date")
+            for tgt, count in result.counts:
+                console.print(f"[green]✓[/green] Generated {count} {tgt.upper()} files")
+            total_files += sum(count for _, count in result.counts)
+
+        if failed:
+            raise typer.Exit(1)
+        if all(result.up_to_date for result in results):
+            return
 
         console.print(f"\n[bold green]Success![/bold green] Generated {total_files} files total")
 
+    except typer.Exit:
+        raise
     except Exception as e:
         logger.exception("Failed to generate code")
         console.print(f"[red]Error: {e}[/red]")
         raise typer.Exit(1)
 
 
+@dataclass
+class _GenerateRequest:
+    """Everything needed to generate one input file, picklable for worker processes."""
+
+    source: Path
+    from_ast: bool
+    target: str
+    targets: list[str]
+    output_dir: Path
+    config: dict[str, Any]
+    template_dir: Path | None
+    project: bool
+    cache_ast: bool
+    ast_file: Path | None
+    cache_dir: Path | None  # Set for --incremental
+
+
+@dataclass
+class _GenerateResult:
+    """What generating one input file did, reported by the parent process."""
+
+    source: Path
+    up_to_date: bool = False
+    errors: list[str] = field(default_factory=list)
+    failure: str | None = None  # Message of the exception that stopped it
+    ast_path: Path | None = None
+    counts: list[tuple[str, int]] = field(default_factory=list)
+
+
+def _run_requests(requests: list[_GenerateRequest], jobs: int) -> list[_GenerateResult]:
+    """Generate every request, in a process pool if more than one job may run.
+
+    Args:
+        requests: One request per input file
+        jobs: Worker processes; 0 uses one per CPU
+
+    Returns:
+        Results in the order of the requests
+    """
+    workers = min(jobs or os.cpu_count() or 1, len(requests))
+    if workers <= 1:
+        return [_generate_one(request) for request in requests]
+
+    # Building the parser here writes Lark's grammar cache once. Forked
+    # workers inherit the parser, and spawned ones (macOS, Windows) load it
+    # from that cache in the initializer, before their first file.
+    get_parser()
+    with ProcessPoolExecutor(max_workers=workers, initializer=get_parser) as pool:
+        return list(pool.map(_generate_one, requests))
+
+
+def _generate_one(request: _GenerateRequest) -> _GenerateResult:
+    """Parse, validate and generate one input file, reporting any failure."""
+    try:
+        return _generate_file(request)
+    except Exception as e:
+        logger.exception(f"Failed to generate code from {request.source}")
+        return _GenerateResult(source=request.source, failure=str(e))
+
+
+def _generate_file(request: _GenerateRequest) -> _GenerateResult:
+    """Parse, validate and generate one input file."""
+    source = request.source
+    result = _GenerateResult(source=source)
+
+    # Skip everything if the last generation had the same inputs
+    cache = None
+    if request.cache_dir:
+        cache = GenerationCache(request.cache_dir)
+        source_content = source.read_bytes()
+        source_hash = content_hash(source_content)
+        key = cache.generation_key(
+            source_hash,
+            request.target,
+            request.output_dir,
+            request.config,
+            request.project,
+            request.template_dir,
+        )
+        if cache.is_fresh(source, request.target, key):
+            result.up_to_date = True
+            return result
+
+    # Load or parse AST; cached ASTs were validated before they were stored
+    cached = False
+    if request.from_ast:
+        logger.info(f"Loading AST from {source}")
+        ast = load_ast(source)
+    else:
+        ast = cache.load_ast(source_hash) if cache else None
+        cached = ast is not None
+        if cached:
+            logger.info(f"Using cached AST of {source}")
+        else:
+            # Parse IDL file
+            logger.info(f"Parsing {source}")
+            content = source_content.decode("utf-8") if cache else source.read_text()
+            parser = IDLParser()
+            ast = parser.parse(content)
+
+            # Cache AST if requested
+            if request.cache_ast:
+                ast_path = request.ast_file or source.with_suffix(".ast")
+                logger.info(f"Caching AST to {ast_path}")
+                save_ast(ast, ast_path)
+                result.ast_path = ast_path
+
+    if not cached:
+        # Validate
+        validator = SemanticValidator()
+        result.errors = [str(error) for error in validator.validate(ast) or []]
+        if result.errors:
+            return result
+
+        if cache and not request.from_ast:
+            cache.save_ast(source_hash, ast)
+
+    # Ensure output directory exists
+    request.output_dir.mkdir(parents=True, exist_ok=True)
+
+    outputs: list[Path] = []
+    for tgt in request.targets:
+        if request.project and tgt in ["cpp", "c", "swift"]:
+            # Use workflow for complete project
+            generated_files = _generate_with_workflow(
+                ast, tgt, request.output_dir, request.config, request.template_dir
+            )
+        else:
+            # Use direct generator
+            generated_files = _generate_direct(
+                ast, tgt, request.output_dir, request.config, request.template_dir
+            )
+        outputs.extend(generated_files)
+        result.counts.append((tgt, len(generated_files)))
+
+    if cache:
+        cache.record(source, request.target, key, outputs)
+    return result
+
+
 def _generate_with_workflow(
     ast: IDLFile,
     target: str,
@@ -309,11 +584,25 @@ def _generate_direct(
 ) -> list[Path]:
     """Generate using direct generator."""
     if target == "cpp":
-        generator = CppGenerator(template_dir=template_dir)
+        generator = CppGenerator(template_dir=template_dir, config=config)
+        remote = config.get("remote", False)
+        if remote or config.get("serialization", False):
+            generated = generator.generate(ast, output_dir)
+            serialization_generator = SerializationGenerator(
+                template_dir=template_dir, config=config
+            )
+            generated += serialization_generator.generate(ast, output_dir)
+            if remote:
+                remote_generator = RemoteGenerator(template_dir=template_dir, config=config)
+                generated += remote_generator.generate(ast, output_dir)
+            return generated
     elif target == "c":
-        generator = CWrapperGenerator(template_dir=template_dir)
+        generator = CWrapperGenerator(template_dir=template_dir, config=config)
+        if config.get("stress", False):
+            stress_generator = StressGenerator(template_dir=template_dir, config=config)
+            return generator.generate(ast, output_dir) + stress_generator.generate(ast, output_dir)
     elif target == "swift":
-        generator = SwiftGenerator(template_dir=template_dir)
+        generator = SwiftGenerator(template_dir=template_dir, config=config)
     else:
         raise ValueError(f"Unknown target: {target}")
     
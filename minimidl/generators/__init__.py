@@ -1,8 +1,19 @@
 """Code generation framework for MinimIDL."""
 
 from minimidl.generators.base import BaseGenerator
+from minimidl.generators.benchmark import BenchmarkGenerator
 from minimidl.generators.c_wrapper import CWrapperGenerator
 from minimidl.generators.cpp import CppGenerator
+from minimidl.generators.remote import RemoteGenerator
+from minimidl.generators.serialization import SerializationGenerator
 from minimidl.generators.swift import SwiftGenerator
 
-__all__ = ["BaseGenerator", "CppGenerator", "CWrapperGenerator", "SwiftGenerator"]
+__all__ = [
+    "BaseGenerator",
+    "BenchmarkGenerator",
+    "CppGenerator",
+    "CWrapperGenerator",
+    "RemoteGenerator",
+    "SerializationGenerator",
+    "SwiftGenerator",
+]
@@ -10,17 +10,48 @@ from loguru import logger
 from minimidl.ast.nodes import IDLFile
 
 
+def write_if_changed(path: Path, content: str) -> bool:
+    """Write a file unless it already has the given content.
+
+    Leaving unchanged files alone keeps their modification times, so build
+    systems do not rebuild everything that includes them.
+
+    Args:
+        path: File path; parent directories are created as needed
+        content: File content
+
+    Returns:
+        True if the file was written
+    """
+    data = content.encode("utf-8")
+    try:
+        if path.stat().st_size == len(data) and path.read_bytes() == data:
+            return False
+    except FileNotFoundError:
+        pass
+    path.parent.mkdir(parents=True, exist_ok=True)
+    path.write_bytes(data)
+    return True
+
+
 class BaseGenerator(ABC):
     """Base class for all code generators."""
 
-    def __init__(self, template_dir: Path | None = None) -> None:
+    def __init__(
+        self,
+        template_dir: Path | None = None,
+        config: dict[str, Any] | None = None,
+    ) -> None:
         """Initialize the generator.
 
         Args:
             template_dir: Directory containing Jinja2 templates.
                          If None, will use default templates.
+            config: Optional code generation options. Exposed to templates
+                    as the ``config`` global.
         """
         self.template_dir = template_dir
+        self.config = config or {}
         self._env: Environment | None = None
 
     @property
@@ -47,6 +78,9 @@ class BaseGenerator(ABC):
             # Add custom filters
             self._env.filters.update(self.get_custom_filters())
 
+            # Make generation options available to all templates
+            self._env.globals["config"] = self.config
+
         return self._env
 
     def get_template(self, name: str) -> Template:
@@ -94,7 +128,7 @@ class BaseGenerator(ABC):
         pass
 
     def write_file(self, output_dir: Path, filename: str, content: str) -> Path:
-        """Write generated content to file.
+        """Write generated content to file, unless it already has that content.
 
         Args:
             output_dir: Output directory
@@ -105,9 +139,9 @@ class BaseGenerator(ABC):
             Path to written file
         """
         output_path = output_dir / filename
-        output_path.parent.mkdir(parents=True, exist_ok=True)
-
-        logger.info(f"Writing {output_path}")
-        output_path.write_text(content)
+        if write_if_changed(output_path, content):
+            logger.info(f"Writing {output_path}")
+        else:
+            logger.debug(f"Unchanged {output_path}")
 
         return output_path
@@ -0,0 +1,498 @@
+"""Micro-benchmark generator for MinimIDL."""
+
+from dataclasses import dataclass, field
+from pathlib import Path
+from typing import Any
+
+from minimidl.ast.nodes import (
+    ArrayType,
+    DictType,
+    IDLFile,
+    Interface,
+    Method,
+    Namespace,
+    NullableType,
+    PrimitiveType,
+    SetType,
+    Type,
+    TypeRef,
+)
+from minimidl.generators.cpp import CppGenerator
+
+
+@dataclass
+class BenchMember:
+    """Member of the in-memory implementation an interface is timed on."""
+
+    declaration: str  # Return type, name, unnamed parameters and qualifiers
+    body: str  # Statement implementing the member
+
+
+@dataclass
+class BenchCase:
+    """Accessor or method timed through the C++ and C layers."""
+
+    name: str  # Benchmark name, <Interface>_<member>
+    reads: bool = False  # Getter, leaving the object unchanged
+    setup: list[str] = field(default_factory=list)  # C++ arguments, before the loop
+    call: str = ""  # C++ statement timed in the loop
+    # C statements, empty if the member has no plain C entry point
+    c_setup: list[str] = field(default_factory=list)
+    c_call: list[str] = field(default_factory=list)
+    c_cleanup: list[str] = field(default_factory=list)
+    c_function: str = ""  # C function c_call times
+
+
+class BenchmarkGenerator(CppGenerator):
+    """Generate Google Benchmark timings of every call across each boundary.
+
+    For each namespace this emits ``<Namespace>Benchmarks.cpp`` with a
+    trivial in-memory implementation of each interface, and benchmarks
+    calling every accessor and method through the C++ virtual and, when the
+    project is built with its C wrapper, through the C ABI.
+    """
+
+    # Function keeping a result alive so the timed call is not optimized out
+    keep = "benchmark::DoNotOptimize"
+    # Items stored in each array and passed in each collection argument
+    items = 3
+
+    def __init__(
+        self,
+        template_dir: Path | None = None,
+        config: dict[str, Any] | None = None,
+    ) -> None:
+        """Initialize the benchmark generator."""
+        super().__init__(template_dir, config)
+        self.current_namespace = ""
+        self.bench_names: set[str] = set()
+
+    def get_custom_filters(self) -> dict[str, Any]:
+        """Get benchmark specific Jinja2 filters."""
+        filters = super().get_custom_filters()
+        filters.update(
+            {
+                "bench_interfaces": self.bench_interfaces,
+                "bench_members": self.bench_members,
+                "bench_cases": self.bench_cases,
+                "bench_default": self.default_value,
+            }
+        )
+        return filters
+
+    def object_name(self, type_spec: Type) -> str | None:
+        """Get the interface an (optionally nullable) object reference names."""
+        if isinstance(type_spec, NullableType):
+            type_spec = type_spec.inner_type
+        if isinstance(type_spec, TypeRef) and type_spec.name in self.interface_names:
+            return type_spec.name
+        return None
+
+    def bench_interfaces(self, namespace: Namespace) -> list[Interface]:
+        """Get the interfaces of a namespace that get an implementation to time."""
+        return [
+            interface
+            for interface in namespace.interfaces
+            if interface.name in self.bench_names
+        ]
+
+    def default_value(self, type_spec: Type) -> str:
+        """Get the initializer for a stored value or argument.
+
+        Arrays hold ``items`` elements, so copying and releasing them is
+        part of what collection calls time.
+        """
+        if isinstance(type_spec, ArrayType):
+            element = type_spec.element_type
+            nested = isinstance(element, (ArrayType, DictType, SetType, NullableType))
+            item = "{}" if nested else self.default_value(element)
+            return "{" + ", ".join([item] * self.items) + "}"
+        if isinstance(type_spec, NullableType):
+            type_spec = type_spec.inner_type
+        if isinstance(type_spec, PrimitiveType) and type_spec.name in ("string_t", "id_t"):
+            return "{kText}"
+        return "{}"
+
+    def bench_members(self, interface: Interface) -> list[BenchMember]:
+        """Implement every member of an interface with a stored value or a constant."""
+        members = []
+        for prop in interface.properties:
+            getter_type = self.cpp_getter_type(prop.type)
+            members.append(
+                BenchMember(
+                    declaration=f"{getter_type} get_{prop.name}() const",
+                    body=self.getter_body(prop.name, prop.type),
+                )
+            )
+            if prop.writable:
+                setter_type = self.cpp_setter_param_type(prop.type)
+                members.append(
+                    BenchMember(
+                        declaration=f"void set_{prop.name}({setter_type} value)",
+                        body=f"m_{prop.name} = {self.cpp_setter_argument(prop.type)};",
+                    )
+                )
+        for method in interface.methods:
+            params = ", ".join(
+                self.cpp_param_type(param.type) for param in method.parameters
+            )
+            qualifiers = " noexcept" if method.noexcept else ""
+            returns = self.cpp_return_type(method)
+            members.append(
+                BenchMember(
+                    declaration=f"{returns} {method.name}({params}){qualifiers}",
+                    body=self.method_body(method),
+                )
+            )
+        return members
+
+    def getter_body(self, name: str, type_spec: Type) -> str:
+        """Return a stored property.
+
+        With pmr, strings and collections returned by value are copied onto
+        ``minimidl::current_resource()``, as implementations are meant to.
+        """
+        by_value = not self.cpp_getter_type(type_spec).endswith("&")
+        if self.config.get("pmr", False) and by_value and self.is_allocating(type_spec):
+            return f"return {{m_{name}, minimidl::current_resource()}};"
+        return f"return m_{name};"
+
+    def is_allocating(self, type_spec: Type) -> bool:
+        """Check if a value is a string or collection that allocates."""
+        if isinstance(type_spec, PrimitiveType):
+            return type_spec.name == "string_t"
+        return isinstance(type_spec, (ArrayType, DictType, SetType))
+
+    def is_void(self, type_spec: Type) -> bool:
+        """Check if a method returns nothing."""
+        return isinstance(type_spec, PrimitiveType) and type_spec.name == "void"
+
+    def method_body(self, method: Method) -> str:
+        """Return a default result from a method, ready if it is async."""
+        is_void = self.is_void(method.return_type)
+        if method.is_async:
+            result = self.cpp_type(method.return_type)
+            value = "" if is_void else f"{result}{{}}"
+            return (
+                f"std::promise<{result}> promise; promise.set_value({value}); "
+                "return promise.get_future();"
+            )
+        return "" if is_void else "return {};"
+
+    def argument(
+        self, name: str, type_spec: Type, setup: list[str], shared: bool = False
+    ) -> str | None:
+        """Get the C++ expression passing an argument, declaring it in setup.
+
+        Objects are borrowed by methods and kept by setters, so ``shared``
+        passes the reference rather than the object.
+
+        Returns None if the argument names an object no benchmark creates.
+        """
+        interface = self.object_name(type_spec)
+        if interface:
+            if interface not in self.bench_names:
+                return None
+            if shared or isinstance(type_spec, NullableType):
+                return f"objects().{interface}Object"
+            return f"*objects().{interface}Object"
+        cpp_type = self.cpp_type(type_spec)
+        setup.append(f"const {cpp_type} {name}{self.default_value(type_spec)};")
+        return name
+
+    def c_kind(self, type_spec: Type) -> str | None:
+        """Classify how a value crosses the C ABI, or None if it is not timed.
+
+        Collections of plain values, strings and objects cross as collection
+        handles. Streams, typedefs, nullable values and nested collections
+        are marshalled differently by each accessor, so they are not timed
+        in C.
+        """
+        if isinstance(type_spec, (ArrayType, SetType)):
+            elements = [type_spec.element_type]
+        elif isinstance(type_spec, DictType):
+            elements = [type_spec.key_type, type_spec.value_type]
+        else:
+            elements = []
+        if elements:
+            kinds = {self.c_kind(element) for element in elements}
+            return "collection" if kinds <= {"string", "value", "object"} else None
+        if isinstance(type_spec, PrimitiveType):
+            return {"void": "void", "string_t": "string"}.get(type_spec.name, "value")
+        if self.object_name(type_spec):
+            return "object" if self.object_name(type_spec) in self.bench_names else None
+        if isinstance(type_spec, TypeRef) and (
+            type_spec.name in self.enum_names or type_spec.name in self.struct_names
+        ):
+            return "value"
+        return None
+
+    def c_type(self, type_spec: Type) -> str:
+        """Get the C wrapper type of a plain value.
+
+        The benchmarks live in the IDL namespace, so the C declarations of
+        enums and structs are named from the global scope.
+        """
+        if isinstance(type_spec, PrimitiveType) and type_spec.name == "string_t":
+            return "IDynamicString_Handle"
+        if isinstance(type_spec, PrimitiveType) and type_spec.name == "id_t":
+            return f"{self.current_namespace}_Id"
+        if isinstance(type_spec, PrimitiveType):
+            return type_spec.name
+        if isinstance(type_spec, (ArrayType, DictType, SetType)):
+            return f"{self.current_namespace}{self.collection_name(type_spec)}_Handle"
+        name = self.object_name(type_spec)
+        if name:
+            return f"{name}_Handle"
+        return f"::{type_spec.name}"
+
+    def collection_name(self, type_spec: Type) -> str:
+        """Get the C handle family of a collection: Array, Dict or Set."""
+        if isinstance(type_spec, DictType):
+            return "Dict"
+        return "Set" if isinstance(type_spec, SetType) else "Array"
+
+    def c_release(self, value: str, type_spec: Type) -> str | None:
+        """Get the C statement releasing a value the caller owns, if it needs one."""
+        kind = self.c_kind(type_spec)
+        if kind == "string":
+            return f"IDynamicString_Release({value});"
+        if kind == "object":
+            return f"if ({value}) {{ {self.object_name(type_spec)}_Release({value}); }}"
+        if kind == "collection":
+            family = f"{self.current_namespace}{self.collection_name(type_spec)}"
+            return f"{family}_Release({value});"
+        return None
+
+    def c_items(self, name: str, element: Type, case: BenchCase) -> str:
+        """Declare ``items`` C elements of a collection in setup.
+
+        Strings are views of ``kText`` and objects the shared benchmark
+        objects, both borrowed by the wrapper.
+        """
+        if self.c_kind(element) == "string":
+            view = "kTextView"
+            item_type = f"{self.current_namespace}_StringView"
+        elif self.c_kind(element) == "object":
+            view = f"objects().{self.object_name(element)}Object.get()"
+            item_type = self.c_type(element)
+        else:
+            item_type = self.c_type(element)
+            case.c_setup.append(f"const {item_type} {name}[{self.items}]{{}};")
+            return name
+        items = ", ".join([view] * self.items)
+        case.c_setup.append(f"const {item_type} {name}[{self.items}] = {{{items}}};")
+        return name
+
+    def c_collection(self, name: str, type_spec: Type, case: BenchCase) -> str:
+        """Build a collection argument from C items in setup, released in cleanup."""
+        namespace = self.current_namespace
+        if isinstance(type_spec, DictType):
+            key_array = ArrayType(element_type=type_spec.key_type)
+            value_array = ArrayType(element_type=type_spec.value_type)
+            keys = self.c_collection(f"{name}Keys", key_array, case)
+            values = self.c_collection(f"{name}Values", value_array, case)
+            create = f"{namespace}Dict_CreateFromArrays({keys}, {values})"
+        else:
+            element = type_spec.element_type
+            items = self.c_items(f"{name}Items", element, case)
+            family = f"{namespace}{self.collection_name(type_spec)}"
+            if self.c_kind(element) == "string":
+                create = f"{family}_CreateStrings({items}, {self.items})"
+            else:
+                size = f"sizeof({items}[0])"
+                create = f"{family}_CreateValues({items}, {self.items}, {size})"
+        case.c_setup.append(f"{self.c_type(type_spec)} {name} = {create};")
+        case.c_cleanup.insert(0, self.c_release(name, type_spec))
+        return name
+
+    def c_argument(self, name: str, type_spec: Type, case: BenchCase) -> str | None:
+        """Get the C expression passing an argument, declaring it in setup."""
+        kind = self.c_kind(type_spec)
+        if kind == "string":
+            case.c_setup.append(
+                f"IDynamicString_Handle {name} = IDynamicString_Create(kText);"
+            )
+            case.c_cleanup.append(f"IDynamicString_Release({name});")
+            return name
+        if kind == "object":
+            return f"objects().{self.object_name(type_spec)}Object.get()"
+        if kind == "value":
+            case.c_setup.append(f"const {self.c_type(type_spec)} {name}{{}};")
+            return name
+        if kind == "collection":
+            return self.c_collection(name, type_spec, case)
+        return None
+
+    def c_call(
+        self, case: BenchCase, function: str, args: list[str], result: Type
+    ) -> None:
+        """Fill in the C statements calling a wrapper function and freeing results."""
+        kind = self.c_kind(result)
+        case.c_function = function
+        call_args = ", ".join(["handle", *args])
+        release = self.c_release("result", result)
+        if kind == "void":
+            case.c_call = [f"{function}({call_args});"]
+        elif self.config.get("status_codes", False):
+            case.c_call = [
+                f"{self.c_type(result)} result{{}};",
+                f"{self.keep}({function}({call_args}, &result));",
+            ]
+            case.c_call.append(release or f"{self.keep}(result);")
+        elif release:
+            case.c_call = [f"auto result = {function}({call_args});", release]
+        else:
+            case.c_call = [f"{self.keep}({function}({call_args}));"]
+
+    def c_get_all(self, case: BenchCase, function: str, element: Type) -> None:
+        """Fill in the C statements copying an array out and releasing its items."""
+        case.c_function = function
+        case.c_setup.append(f"{self.c_type(element)} items[{self.items}];")
+        if self.config.get("status_codes", False):
+            case.c_call = [
+                "size_t total{};",
+                f"{self.keep}({function}(handle, items, {self.items}, &total));",
+            ]
+        else:
+            call = f"{function}(handle, items, {self.items})"
+            case.c_call = [f"const size_t total = {call};"]
+        release = self.c_release("items[i]", element)
+        if release:
+            loop = f"for (size_t i = 0; i < total && i < {self.items}; ++i)"
+            case.c_call.append(f"{loop} {{ {release} }}")
+        else:
+            case.c_call.append(f"{self.keep}(total);")
+
+    def bench_cases(self, interface: Interface) -> list[BenchCase]:
+        """Describe the benchmark of each accessor and method of an interface.
+
+        Members taking an object no benchmark creates are left out.
+        """
+        cases = []
+        for prop in interface.properties:
+            getter = BenchCase(
+                name=f"{interface.name}_get_{prop.name}",
+                reads=True,
+                call=f"{self.keep}(object->get_{prop.name}());",
+            )
+            # Arrays are copied out in one _GetAll call, dictionaries and
+            # sets handed out as one collection handle
+            function = f"{interface.name}_Get{prop.name}"
+            kind = self.c_kind(prop.type)
+            if kind == "collection" and isinstance(prop.type, ArrayType):
+                self.c_get_all(getter, f"{function}_GetAll", prop.type.element_type)
+            elif kind == "collection":
+                self.c_call(getter, f"{function}_Iterator", [], prop.type)
+            elif kind is not None:
+                self.c_call(getter, function, [], prop.type)
+            cases.append(getter)
+
+            # Borrowed string views skip the copy into an IDynamicString
+            string_views = self.config.get("string_views", False)
+            if self.c_kind(prop.type) == "string" and string_views:
+                view = BenchCase(name=f"{interface.name}_get_{prop.name}_View", reads=True)
+                function = f"{interface.name}_Get{prop.name}_View"
+                view.c_function = function
+                if self.config.get("status_codes", False):
+                    view.c_call = [
+                        f"{self.current_namespace}_StringView result{{}};",
+                        f"{self.keep}({function}(handle, &result));",
+                        f"{self.keep}(result);",
+                    ]
+                else:
+                    view.c_call = [f"{self.keep}({function}(handle));"]
+                cases.append(view)
+
+            if prop.writable:
+                setter = BenchCase(name=f"{interface.name}_set_{prop.name}")
+                value = self.argument("value", prop.type, setter.setup, shared=True)
+                if value is None:
+                    continue
+                setter.call = f"object->set_{prop.name}({value});"
+                function = f"{interface.name}_Set{prop.name}"
+                if kind == "collection" and isinstance(prop.type, ArrayType):
+                    items = self.c_items("items", prop.type.element_type, setter)
+                    function = f"{function}_SetAll"
+                    c_args = [items, str(self.items)]
+                else:
+                    c_value = self.c_argument("value", prop.type, setter)
+                    c_args = None if c_value is None else [c_value]
+                if c_args is not None:
+                    self.c_call(setter, function, c_args, PrimitiveType(name="void"))
+                cases.append(setter)
+
+        for method in interface.methods:
+            case = BenchCase(name=f"{interface.name}_{method.name}")
+            args = [
+                self.argument(param.name, param.type, case.setup)
+                for param in method.parameters
+            ]
+            if None in args:
+                continue
+            call = f"object->{method.name}({', '.join(args)})"
+            if method.is_async:
+                call += ".get()"
+            if self.is_void(method.return_type):
+                case.call = f"{call};"
+            else:
+                case.call = f"{self.keep}({call});"
+
+            # async methods complete through a callback in C
+            if not method.is_async and self.c_kind(method.return_type) is not None:
+                c_args = [
+                    self.c_argument(param.name, param.type, case)
+                    for param in method.parameters
+                ]
+                if None not in c_args:
+                    function = f"{interface.name}_{method.name}"
+                    self.c_call(case, function, c_args, method.return_type)
+            if not case.c_call:
+                case.c_setup = []
+                case.c_cleanup = []
+            cases.append(case)
+
+        return cases
+
+    def use_namespace(self, namespace: Namespace) -> None:
+        """Resolve type names against a namespace and time all its interfaces."""
+        self.current_namespace = namespace.name
+        self.enum_names = {enum.name for enum in namespace.enums}
+        self.struct_names = {struct.name for struct in namespace.structs}
+        self.interface_names = {interface.name for interface in namespace.interfaces}
+        self.bench_names = set(self.interface_names)
+
+    def generate(self, idl_file: IDLFile, output_dir: Path) -> list[Path]:
+        """Generate benchmark sources from AST.
+
+        Args:
+            idl_file: Parsed IDL file AST
+            output_dir: Directory to write generated files
+
+        Returns:
+            List of generated file paths
+        """
+        generated_files = []
+
+        for namespace in idl_file.namespaces:
+            filename = self.get_output_filename(namespace.name)
+            self.use_namespace(namespace)
+
+            template = self.get_template("cpp/benchmarks.cpp.jinja2")
+            content = template.render(namespace=namespace)
+
+            output_path = self.write_file(output_dir, filename, content)
+            generated_files.append(output_path)
+
+        return generated_files
+
+    def get_output_filename(self, namespace_name: str) -> str:
+        """Get output filename for a namespace.
+
+        Args:
+            namespace_name: Name of the namespace
+
+        Returns:
+            Output filename
+        """
+        return f"{namespace_name}Benchmarks.cpp"
@@ -9,6 +9,7 @@ from minimidl.ast.nodes import (
     DictType,
     Enum,
     Expression,
+    FixedStringType,
     IdentifierExpression,
     IDLFile,
     Interface,
@@ -21,6 +22,8 @@ from minimidl.ast.nodes import (
     PrimitiveType,
     Property,
     SetType,
+    StreamType,
+    StructField,
     Type,
     TypeRef,
     UnaryExpression,
@@ -31,11 +34,16 @@ from minimidl.generators.base import BaseGenerator
 class CWrapperGenerator(BaseGenerator):
     """Generate C wrapper code from MinimIDL AST."""
 
-    def __init__(self, template_dir: Path | None = None) -> None:
+    def __init__(
+        self,
+        template_dir: Path | None = None,
+        config: dict[str, Any] | None = None,
+    ) -> None:
         """Initialize the C wrapper generator."""
-        super().__init__(template_dir)
+        super().__init__(template_dir, config)
         self.namespace_prefix = ""
         self.enum_names: set[str] = set()
+        self.struct_names: set[str] = set()
 
     def get_custom_filters(self) -> dict[str, Any]:
         """Get C wrapper specific Jinja2 filters."""
@@ -44,6 +52,18 @@ class CWrapperGenerator(BaseGenerator):
             "c_param_type": self.c_param_type,
             "c_return_type": self.c_return_type,
             "c_handle_type": self.c_handle_type,
+            "c_element_type": self.c_element_type,
+            "c_collection_layout": self.c_collection_layout,
+            "c_field": self.c_field,
+            "c_snapshot_type": self.c_snapshot_type,
+            "c_event_type": self.c_event_type,
+            "snapshot_properties": self.snapshot_properties,
+            "snapshot_strings": self.snapshot_strings,
+            "batch_properties": self.batch_properties,
+            "batch_methods": self.batch_methods,
+            "is_scalar": self.is_scalar,
+            "has_async_methods": self.has_async_methods,
+            "has_events": self.has_events,
             "c_function_name": self.c_function_name,
             "needs_array_interface": self.needs_array_interface,
             "needs_dict_interface": self.needs_dict_interface,
@@ -54,8 +74,18 @@ class CWrapperGenerator(BaseGenerator):
             "is_array": self.is_array,
             "is_dict": self.is_dict,
             "is_set": self.is_set,
+            "is_allocating": self.is_allocating,
+            "is_stream": self.is_stream,
+            "has_streams": self.has_streams,
+            "drained_streams": self.drained_streams,
+            "has_ids": self.has_ids,
             "is_enum": self.is_enum,
+            "is_struct": self.is_struct,
             "is_interface": self.is_interface,
+            "interface_name": self.interface_name,
+            "has_string_view": self.has_string_view,
+            "has_view_setter": self.has_view_setter,
+            "needs_try": self.needs_try,
             "export_macro": self.export_macro,
             "render_expression": self.render_expression,
         }
@@ -78,6 +108,7 @@ class CWrapperGenerator(BaseGenerator):
                 "float": "float",
                 "double": "double",
                 "string_t": "IDynamicString_Handle",
+                "id_t": f"{self.namespace_prefix}_Id",
             }
             return type_map.get(type_spec.name, type_spec.name)
 
@@ -86,6 +117,9 @@ class CWrapperGenerator(BaseGenerator):
             if type_spec.name in self.enum_names:
                 # Enums are just typedefs
                 return type_spec.name
+            elif type_spec.name in self.struct_names:
+                # Structs are passed by value with the C++ layout
+                return type_spec.name
             else:
                 # For interfaces, we use handles
                 return f"{type_spec.name}_Handle"
@@ -102,6 +136,10 @@ class CWrapperGenerator(BaseGenerator):
             # Sets need special handling - return handle
             return f"{self.namespace_prefix}Set_Handle"
 
+        elif isinstance(type_spec, StreamType):
+            # Streams are read in chunks through their handle
+            return f"{self.namespace_prefix}Stream_Handle"
+
         elif isinstance(type_spec, NullableType):
             # Nullable types are the same as non-nullable in C
             # NULL represents the null value
@@ -144,6 +182,158 @@ class CWrapperGenerator(BaseGenerator):
         """
         return f"{interface_name}_Handle"
 
+    def c_element_type(self, type_spec: Type) -> str:
+        """Get the C type a collection element is read as.
+
+        Strings are handed out as borrowed string views into the collection
+        buffer; every other element type has the same layout as its C type.
+
+        Args:
+            type_spec: IDL element type specification
+
+        Returns:
+            C element type string
+        """
+        if self.is_string(type_spec):
+            return f"{self.namespace_prefix}_StringView"
+        return self.c_type(type_spec)
+
+    def c_collection_layout(self, type_spec: Type) -> str:
+        """Describe the element types of a collection handle for docs.
+
+        Args:
+            type_spec: IDL collection type specification
+
+        Returns:
+            Element C type, or ``key -> value`` for dictionaries
+        """
+        if isinstance(type_spec, NullableType):
+            return self.c_collection_layout(type_spec.inner_type)
+        if isinstance(type_spec, DictType):
+            key_type = self.c_element_type(type_spec.key_type)
+            value_type = self.c_element_type(type_spec.value_type)
+            return f"{key_type} -> {value_type}"
+        if isinstance(type_spec, (ArrayType, SetType, StreamType)):
+            return self.c_element_type(type_spec.element_type)
+        return ""
+
+    def c_field(self, field: StructField) -> str:
+        """Get the C declaration of a struct field.
+
+        Args:
+            field: Struct field
+
+        Returns:
+            C member declaration without the trailing semicolon
+        """
+        if isinstance(field.type, FixedStringType):
+            return f"char {field.name}[{field.type.capacity}]"
+        return f"{self.c_type(field.type)} {field.name}"
+
+    def c_snapshot_type(self, type_spec: Type) -> str:
+        """Get the C type a property is captured as in an interface snapshot.
+
+        Strings are views into the snapshot's storage; every other type is
+        captured as its getter's C type, with collections and interfaces as
+        handles owned by the snapshot.
+
+        Args:
+            type_spec: IDL property type specification
+
+        Returns:
+            C member type string
+        """
+        if self.is_string(type_spec):
+            return f"{self.namespace_prefix}_StringView"
+        return self.c_type(type_spec)
+
+    def c_event_type(self, type_spec: Type) -> str:
+        """Get the C type an event argument is passed to a callback as.
+
+        Strings are borrowed NUL-terminated characters, valid for the
+        duration of the callback; every other event argument is a value.
+
+        Args:
+            type_spec: IDL event parameter type specification
+
+        Returns:
+            C parameter type string
+        """
+        if self.is_string(type_spec):
+            return "const char*"
+        return self.c_type(type_spec)
+
+    def snapshot_properties(self, interface: Interface) -> list[Property]:
+        """Get the properties captured by an interface's ``_Snapshot`` call.
+
+        Nullable values other than interface references have no C
+        representation of their null state, so they are left out and read
+        through their own getters.
+
+        Args:
+            interface: Interface to snapshot
+
+        Returns:
+            Properties in declaration order; empty if no snapshot is emitted
+        """
+        return [
+            prop
+            for prop in interface.properties
+            if not self.is_nullable(prop.type) or self.is_interface(prop.type)
+        ]
+
+    def snapshot_strings(self, interface: Interface) -> list[Property]:
+        """Get the string properties copied into a snapshot's storage."""
+        return [prop for prop in self.snapshot_properties(interface) if self.is_string(prop.type)]
+
+    def is_scalar(self, type_spec: Type) -> bool:
+        """Check if a value converts between C and C++ by a plain cast or copy.
+
+        Scalars are non-nullable primitives other than strings and ``void``,
+        enums and structs.
+        """
+        if isinstance(type_spec, NullableType):
+            return False
+        if isinstance(type_spec, PrimitiveType):
+            return type_spec.name not in ("string_t", "void")
+        return self.is_enum(type_spec) or self.is_struct(type_spec)
+
+    def batch_properties(self, interface: Interface) -> list[Property]:
+        """Get the properties with ``_Batch`` accessors over handle arrays."""
+        return [prop for prop in interface.properties if self.is_scalar(prop.type)]
+
+    def batch_methods(self, interface: Interface) -> list[Method]:
+        """Get the methods with a ``_Batch`` variant over handle arrays.
+
+        These take at most one argument, and their argument and result are
+        scalars, so a batch is a single loop with no conversions. Async
+        methods only have their callback entry point.
+        """
+        return [
+            method
+            for method in interface.methods
+            if not method.is_async
+            and len(method.parameters) <= 1
+            and all(self.is_scalar(param.type) for param in method.parameters)
+            and (
+                self.is_scalar(method.return_type)
+                or (
+                    isinstance(method.return_type, PrimitiveType)
+                    and method.return_type.name == "void"
+                )
+            )
+        ]
+
+    def has_async_methods(self, namespace: Namespace) -> bool:
+        """Check if any interface in a namespace declares an async method."""
+        return any(
+            method.is_async for interface in namespace.interfaces for method in interface.methods
+        )
+
+    def has_events(self, namespace: Namespace) -> bool:
+        """Check if any interface in a namespace declares an event."""
+        return any(interface.events for interface in namespace.interfaces)
+
     def c_function_name(
         self, interface_name: str, member_name: str, prefix: str = ""
     ) -> str:
@@ -207,6 +397,64 @@ class CWrapperGenerator(BaseGenerator):
             return self.is_set(type_spec.inner_type)
         return isinstance(type_spec, SetType)
     
+    def is_allocating(self, type_spec: Type) -> bool:
+        """Check if type is a string or collection, which C++ allocates."""
+        return (
+            self.is_string(type_spec)
+            or self.is_array(type_spec)
+            or self.is_dict(type_spec)
+            or self.is_set(type_spec)
+        )
+
+    def is_stream(self, type_spec: Type) -> bool:
+        """Check if type is a stream."""
+        return isinstance(type_spec, StreamType)
+
+    def has_streams(self, namespace: Namespace) -> bool:
+        """Check if any method in a namespace returns a stream."""
+        return any(
+            self.is_stream(method.return_type)
+            for interface in namespace.interfaces
+            for method in interface.methods
+        )
+
+    def drained_streams(self, interface: Interface) -> list[Method]:
+        """Get the stream methods the testbed calls, which take no arguments.
+
+        The testbed drains the first of them after releasing its object, as
+        the stream handle keeps the object alive.
+        """
+        return [
+            method
+            for method in interface.methods
+            if self.is_stream(method.return_type) and not method.parameters
+        ]
+
+    def uses_id(self, type_spec: Type) -> bool:
+        """Check if a type is or contains the interned ``id_t``."""
+        if isinstance(type_spec, PrimitiveType):
+            return type_spec.name == "id_t"
+        if isinstance(type_spec, NullableType):
+            return self.uses_id(type_spec.inner_type)
+        if isinstance(type_spec, DictType):
+            return self.uses_id(type_spec.key_type) or self.uses_id(type_spec.value_type)
+        if isinstance(type_spec, (ArrayType, SetType, StreamType)):
+            return self.uses_id(type_spec.element_type)
+        return False
+
+    def has_ids(self, namespace: Namespace) -> bool:
+        """Check if any interface member in a namespace uses ``id_t``."""
+        for interface in namespace.interfaces:
+            types = [prop.type for prop in interface.properties]
+            for method in interface.methods:
+                types.append(method.return_type)
+                types.extend(param.type for param in method.parameters)
+            for event in interface.events:
+                types.extend(param.type for param in event.parameters)
+            if any(self.uses_id(type_spec) for type_spec in types):
+                return True
+        return False
+
     def is_enum(self, type_spec: Type) -> bool:
         """Check if type is an enum."""
         if isinstance(type_spec, NullableType):
@@ -216,11 +464,67 @@ class CWrapperGenerator(BaseGenerator):
             return type_spec.name in self.enum_names
         return False
 
+    def is_struct(self, type_spec: Type) -> bool:
+        """Check if type is a struct."""
+        return isinstance(type_spec, TypeRef) and type_spec.name in self.struct_names
+
     def is_interface(self, type_spec: Type) -> bool:
         """Check if type is an interface reference."""
         if isinstance(type_spec, NullableType):
             return self.is_interface(type_spec.inner_type)
-        return isinstance(type_spec, TypeRef)
+        return isinstance(type_spec, TypeRef) and type_spec.name not in self.struct_names
+
+    def interface_name(self, type_spec: Type) -> str:
+        """Get the C++ interface name of an (optionally nullable) reference."""
+        if isinstance(type_spec, NullableType):
+            return self.interface_name(type_spec.inner_type)
+        if isinstance(type_spec, TypeRef):
+            return type_spec.name
+        return ""
+
+    def has_string_view(self, type_spec: Type) -> bool:
+        """Check if a property of this type gets a borrowed ``_View`` getter.
+
+        Only non-nullable strings qualify, since the C++ getter must return a
+        reference into storage owned by the object.
+        """
+        return (
+            self.config.get("string_views", False)
+            and isinstance(type_spec, PrimitiveType)
+            and type_spec.name == "string_t"
+        )
+
+    def has_view_setter(self, type_spec: Type) -> bool:
+        """Check if a writable property of this type gets a ``_View`` setter.
+
+        The setter copies the value from a ``<NS>_StringView``, so callers
+        with the bytes at hand need not create an ``IDynamicString`` first.
+        Nullable strings are left out since a view cannot say null.
+        """
+        return isinstance(type_spec, PrimitiveType) and type_spec.name == "string_t"
+
+    def needs_try(self, method: Method) -> bool:
+        """Check if a method wrapper has to catch C++ exceptions.
+
+        A ``noexcept`` method can still throw from the wrapper side when its
+        arguments or result are converted (strings and collections allocate),
+        so the handler is only dropped when every conversion is a plain cast
+        or a struct copy.
+        """
+        if not method.noexcept:
+            return True
+        ret = method.return_type
+        if not (
+            self.is_primitive(ret)
+            or self.is_enum(ret)
+            or self.is_struct(ret)
+            or self.is_interface(ret)
+        ):
+            return True
+        return any(
+            not (self.is_primitive(p.type) or self.is_enum(p.type) or self.is_struct(p.type))
+            for p in method.parameters
+        )
 
     def export_macro(self, namespace: Namespace | str) -> str:
         """Get export macro name for namespace."""
@@ -283,6 +587,7 @@ class CWrapperGenerator(BaseGenerator):
 
             # Collect enum names for type resolution
             self.enum_names = {enum.name for enum in namespace.enums}
+            self.struct_names = {struct.name for struct in namespace.structs}
 
             # Generate wrapper header
             header_template = self.get_template("c_wrapper/wrapper.h.j2")
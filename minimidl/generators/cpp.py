@@ -7,14 +7,21 @@ from minimidl.ast.nodes import (
     ArrayType,
     BinaryExpression,
     DictType,
+    Event,
     Expression,
+    FixedStringType,
     IdentifierExpression,
     IDLFile,
+    Interface,
     LiteralExpression,
+    Method,
+    Namespace,
     NullableType,
     ParenthesizedExpression,
     PrimitiveType,
+    Property,
     SetType,
+    StreamType,
     Type,
     TypeRef,
     UnaryExpression,
@@ -25,14 +32,44 @@ from minimidl.generators.base import BaseGenerator
 class CppGenerator(BaseGenerator):
     """Generate C++ code from MinimIDL AST."""
 
+    def __init__(
+        self,
+        template_dir: Path | None = None,
+        config: dict[str, Any] | None = None,
+    ) -> None:
+        """Initialize the C++ generator."""
+        super().__init__(template_dir, config)
+        self.enum_names: set[str] = set()
+        self.struct_names: set[str] = set()
+        self.interface_names: set[str] = set()
+
     def get_custom_filters(self) -> dict[str, Any]:
         """Get C++ specific Jinja2 filters."""
         return {
             "cpp_type": self.cpp_type,
             "cpp_param_type": self.cpp_param_type,
+            "cpp_setter_param_type": self.cpp_setter_param_type,
+            "cpp_getter_type": self.cpp_getter_type,
+            "cpp_return_type": self.cpp_return_type,
+            "cpp_setter_argument": self.cpp_setter_argument,
+            "event_type": self.event_type,
+            "has_async_methods": self.has_async_methods,
+            "has_shared_wrapper": self.has_shared_wrapper,
+            "idl_type": self.idl_type,
+            "readmostly_properties": self.readmostly_properties,
             "render_expression": self.render_expression,
         }
 
+    @property
+    def std_prefix(self) -> str:
+        """Namespace of the standard containers that collections lower to."""
+        return "std::pmr::" if self.config.get("pmr", False) else "std::"
+
+    @property
+    def flat_prefix(self) -> str:
+        """Namespace of the runtime's flat containers."""
+        return "minimidl::pmr::" if self.config.get("pmr", False) else "minimidl::"
+
     def cpp_type(self, type_spec: Type) -> str:
         """Convert IDL type to C++ type.
 
@@ -51,34 +88,62 @@ class CppGenerator(BaseGenerator):
                 "float": "float",
                 "double": "double",
                 "string_t": "std::string",
+                "id_t": "minimidl::id",
             }
+            if type_spec.name == "string_t" and self.config.get("pmr", False):
+                return "std::pmr::string"
             return type_map.get(type_spec.name, type_spec.name)
 
         elif isinstance(type_spec, TypeRef):
-            # Could be enum or interface reference
+            # Interfaces are always held through their reference count, so
+            # results and collection elements are handles rather than slices
+            if self.is_interface(type_spec):
+                return f"minimidl::object_ptr<{type_spec.name}>"
             return type_spec.name
 
+        elif isinstance(type_spec, FixedStringType):
+            return f"minimidl::fixed_string<{type_spec.capacity}>"
+
         elif isinstance(type_spec, ArrayType):
             element_type = self.cpp_type(type_spec.element_type)
-            return f"std::vector<{element_type}>"
+            return f"{self.std_prefix}vector<{element_type}>"
 
         elif isinstance(type_spec, DictType):
             key_type = self.cpp_type(type_spec.key_type)
             value_type = self.cpp_type(type_spec.value_type)
-            return f"std::unordered_map<{key_type}, {value_type}>"
+            if self.config.get("flat_containers", False):
+                return f"{self.flat_prefix}flat_map<{key_type}, {value_type}>"
+            return f"{self.std_prefix}unordered_map<{key_type}, {value_type}>"
 
         elif isinstance(type_spec, SetType):
             element_type = self.cpp_type(type_spec.element_type)
-            return f"std::unordered_set<{element_type}>"
+            if self.config.get("flat_containers", False):
+                return f"{self.flat_prefix}flat_set<{element_type}>"
+            return f"{self.std_prefix}unordered_set<{element_type}>"
+
+        elif isinstance(type_spec, StreamType):
+            element = type_spec.element_type
+            # Interface items are handed out as references
+            if (
+                isinstance(element, TypeRef)
+                and element.name not in self.enum_names
+                and element.name not in self.struct_names
+            ):
+                return f"minimidl::stream<minimidl::object_ptr<{element.name}>>"
+            return f"minimidl::stream<{self.cpp_type(element)}>"
 
         elif isinstance(type_spec, NullableType):
             inner_type = self.cpp_type(type_spec.inner_type)
-            # For primitives, use std::optional
-            if isinstance(type_spec.inner_type, PrimitiveType):
+            # For primitives and enums, use std::optional
+            if self.is_scalar(type_spec.inner_type) or isinstance(
+                type_spec.inner_type, PrimitiveType
+            ):
                 return f"std::optional<{inner_type}>"
-            # For objects, use shared_ptr
-            else:
-                return f"std::shared_ptr<{inner_type}>"
+            # Interfaces carry their own reference count
+            if isinstance(type_spec.inner_type, TypeRef):
+                return f"minimidl::object_ptr<{type_spec.inner_type.name}>"
+            # Collections use shared_ptr
+            return f"std::shared_ptr<{inner_type}>"
 
         return "unknown_type"
 
@@ -93,13 +158,149 @@ class CppGenerator(BaseGenerator):
         """
         cpp_type = self.cpp_type(type_spec)
 
-        # Primitives are passed by value
-        if isinstance(type_spec, PrimitiveType) and type_spec.name != "string_t":
+        # Scalars (primitives, enums and optionals of them) are passed by value
+        if self.is_scalar(type_spec):
             return cpp_type
 
+        # Objects are borrowed for the call, so passing one costs no reference
+        if self.is_interface(type_spec):
+            return f"const {type_spec.name}&"
+
         # Everything else by const reference
         return f"const {cpp_type}&"
 
+    def cpp_setter_param_type(self, type_spec: Type) -> str:
+        """Get C++ parameter type for a property setter.
+
+        With the ``sink_setters`` option, string and collection setters take
+        their value by value, so callers can move into them and the
+        implementation can move the value into its storage.
+
+        Args:
+            type_spec: IDL type specification
+
+        Returns:
+            C++ setter parameter type string
+        """
+        if self.config.get("sink_setters", False) and self.is_sink(type_spec):
+            return self.cpp_type(type_spec)
+        # A setter keeps the object, so it takes a reference it can store
+        if self.is_interface(type_spec):
+            return f"const {self.cpp_type(type_spec)}&"
+        return self.cpp_param_type(type_spec)
+
+    def cpp_setter_argument(self, type_spec: Type) -> str:
+        """Get the expression forwarding a setter's ``value`` to another setter."""
+        if self.config.get("sink_setters", False) and self.is_sink(type_spec):
+            return "std::move(value)"
+        return "value"
+
+    def is_scalar(self, type_spec: Type) -> bool:
+        """Check if a type is cheap enough to pass by value."""
+        if isinstance(type_spec, NullableType):
+            return self.is_scalar(type_spec.inner_type)
+        if isinstance(type_spec, PrimitiveType):
+            return type_spec.name != "string_t"
+        return isinstance(type_spec, TypeRef) and type_spec.name in self.enum_names
+
+    def is_interface(self, type_spec: Type) -> bool:
+        """Check if a type names an interface of the current namespace."""
+        return isinstance(type_spec, TypeRef) and type_spec.name in self.interface_names
+
+    def is_sink(self, type_spec: Type) -> bool:
+        """Check if a setter of this type benefits from taking ownership."""
+        if isinstance(type_spec, NullableType):
+            return self.is_sink(type_spec.inner_type)
+        if isinstance(type_spec, PrimitiveType):
+            return type_spec.name == "string_t"
+        return isinstance(type_spec, (ArrayType, DictType, SetType))
+
+    def cpp_getter_type(self, type_spec: Type) -> str:
+        """Get C++ return type for a property getter.
+
+        With the ``string_views`` option, string getters return a reference
+        to storage owned by the implementation, so callers (including the C
+        wrapper) can read the value without copying it.
+
+        Args:
+            type_spec: IDL type specification
+
+        Returns:
+            C++ getter return type string
+        """
+        if (
+            self.config.get("string_views", False)
+            and isinstance(type_spec, PrimitiveType)
+            and type_spec.name == "string_t"
+        ):
+            return f"const {self.cpp_type(type_spec)}&"
+        return self.cpp_type(type_spec)
+
+    def cpp_return_type(self, method: Method) -> str:
+        """Get C++ return type for a method.
+
+        An ``async`` method returns a ``std::future`` of its result, so the
+        implementation can complete it on another thread.
+
+        Args:
+            method: IDL method
+
+        Returns:
+            C++ return type string
+        """
+        result = self.cpp_type(method.return_type)
+        if method.is_async:
+            return f"std::future<{result}>"
+        return result
+
+    def idl_type(self, type_spec: Type) -> str:
+        """Spell a type the way it is written in the IDL, for descriptors."""
+        if isinstance(type_spec, (PrimitiveType, TypeRef)):
+            return type_spec.name
+        if isinstance(type_spec, NullableType):
+            return f"{self.idl_type(type_spec.inner_type)}?"
+        if isinstance(type_spec, ArrayType):
+            return f"{self.idl_type(type_spec.element_type)}[]"
+        if isinstance(type_spec, DictType):
+            key = self.idl_type(type_spec.key_type)
+            return f"dict<{key}, {self.idl_type(type_spec.value_type)}>"
+        if isinstance(type_spec, SetType):
+            return f"set<{self.idl_type(type_spec.element_type)}>"
+        if isinstance(type_spec, StreamType):
+            return f"stream<{self.idl_type(type_spec.element_type)}>"
+        if isinstance(type_spec, FixedStringType):
+            return f"string_t<{type_spec.capacity}>"
+        return type(type_spec).__name__
+
+    def event_type(self, event: Event) -> str:
+        """Get the ``minimidl::event`` an object holds for an event."""
+        arguments = ", ".join(self.cpp_type(param.type) for param in event.parameters)
+        return f"minimidl::event<{arguments}>"
+
+    def has_async_methods(self, namespaces: list[Namespace]) -> bool:
+        """Check if any interface in the namespaces declares an async method."""
+        return any(
+            method.is_async
+            for namespace in namespaces
+            for interface in namespace.interfaces
+            for method in interface.methods
+        )
+
+    def has_shared_wrapper(self, interface: Interface) -> bool:
+        """Check if an interface gets a ``<Name>Shared`` thread-sharing wrapper.
+
+        The wrapper is emitted for ``[threadsafe]`` interfaces and for
+        interfaces with ``[immutable]`` or ``[readmostly]`` properties.
+        """
+        return "threadsafe" in interface.attributes or any(
+            "immutable" in prop.attributes or "readmostly" in prop.attributes
+            for prop in interface.properties
+        )
+
+    def readmostly_properties(self, interface: Interface) -> list[Property]:
+        """Get the ``[readmostly]`` properties a shared wrapper republishes."""
+        return [prop for prop in interface.properties if "readmostly" in prop.attributes]
+
     def render_expression(self, expr: Expression) -> str:
         """Render an expression to C++ code.
 
@@ -152,10 +353,17 @@ class CppGenerator(BaseGenerator):
         # For now, generate one file per namespace
         for namespace in idl_file.namespaces:
             filename = self.get_output_filename(namespace.name)
+            self.enum_names = {enum.name for enum in namespace.enums}
+            self.struct_names = {struct.name for struct in namespace.structs}
+            self.interface_names = {interface.name for interface in namespace.interfaces}
+
+            if self.config.get("split_headers", False):
+                generated_files.extend(self.generate_split_headers(namespace, output_dir))
+                continue
 
             # Render template
             template = self.get_template("cpp/interface.hpp.jinja2")
-            content = template.render(namespaces=[namespace])
+            content = template.render(namespaces=[namespace], part="all", includes=[])
 
             # Write file
             output_path = self.write_file(output_dir, filename, content)
@@ -163,6 +371,97 @@ class CppGenerator(BaseGenerator):
 
         return generated_files
 
+    def generate_split_headers(self, namespace: Namespace, output_dir: Path) -> list[Path]:
+        """Generate the headers of a namespace one part at a time.
+
+        ``<Namespace>_fwd.hpp`` forward declares the interfaces and structs
+        and defines the enums, needing nothing but ``<cstdint>``.
+        ``<Namespace>_types.hpp`` adds the structs, typedefs and constants on
+        top of the runtime, and ``<Namespace>_<Interface>.hpp`` one interface
+        with the headers of the interfaces it mentions. ``<Namespace>.hpp``
+        still includes everything, and ``<Namespace>.cppm`` exports it all
+        as a C++20 module.
+
+        Args:
+            namespace: Namespace to generate
+            output_dir: Directory to write generated files
+
+        Returns:
+            List of generated file paths
+        """
+        template = self.get_template("cpp/interface.hpp.jinja2")
+        fwd = self.get_fwd_filename(namespace.name)
+        types = self.get_types_filename(namespace.name)
+        contents = {
+            fwd: template.render(namespaces=[namespace], part="fwd", includes=[]),
+            types: template.render(namespaces=[namespace], part="types", includes=[fwd]),
+        }
+        for interface in namespace.interfaces:
+            dependencies = self.interface_dependencies(namespace, interface)
+            single = namespace.model_copy(update={"interfaces": [interface]})
+            contents[self.get_interface_filename(namespace.name, interface.name)] = (
+                template.render(
+                    namespaces=[single],
+                    part="interface",
+                    includes=[types]
+                    + [self.get_interface_filename(namespace.name, name) for name in dependencies],
+                )
+            )
+        contents[self.get_output_filename(namespace.name)] = template.render(
+            namespaces=[],
+            part="umbrella",
+            includes=[types]
+            + [
+                self.get_interface_filename(namespace.name, interface.name)
+                for interface in namespace.interfaces
+            ],
+        )
+        contents[self.get_module_filename(namespace.name)] = self.get_template(
+            "cpp/module.cppm.jinja2"
+        ).render(namespace=namespace, header=self.get_output_filename(namespace.name))
+
+        return [
+            self.write_file(output_dir, filename, content) for filename, content in contents.items()
+        ]
+
+    def interface_dependencies(self, namespace: Namespace, interface: Interface) -> list[str]:
+        """Get the other interfaces of a namespace that an interface mentions.
+
+        Typedefs are followed to the types they name. The inline members of
+        an interface's wrappers copy and release these objects, so its split
+        header includes theirs.
+
+        Args:
+            namespace: Namespace of the interface
+            interface: Interface whose members to look through
+
+        Returns:
+            Names of the interfaces, in declaration order
+        """
+        typedefs = {typedef.name: typedef.type for typedef in namespace.typedefs}
+        pending = [prop.type for prop in interface.properties]
+        for method in interface.methods:
+            pending.append(method.return_type)
+            pending.extend(param.type for param in method.parameters)
+        for event in interface.events:
+            pending.extend(param.type for param in event.parameters)
+
+        names = set()
+        while pending:
+            type_spec = pending.pop()
+            if isinstance(type_spec, TypeRef) and type_spec.name in typedefs:
+                pending.append(typedefs[type_spec.name])
+            elif isinstance(type_spec, TypeRef) and type_spec.name in self.interface_names:
+                names.add(type_spec.name)
+            elif isinstance(type_spec, (ArrayType, SetType, StreamType)):
+                pending.append(type_spec.element_type)
+            elif isinstance(type_spec, DictType):
+                pending.extend([type_spec.key_type, type_spec.value_type])
+            elif isinstance(type_spec, NullableType):
+                pending.append(type_spec.inner_type)
+        names.discard(interface.name)
+        return [other.name for other in namespace.interfaces if other.name in names]
+
     def get_output_filename(self, namespace_name: str) -> str:
         """Get output filename for a namespace.
 
@@ -173,3 +472,19 @@ class CppGenerator(BaseGenerator):
             Output filename
         """
         return f"{namespace_name}.hpp"
+
+    def get_fwd_filename(self, namespace_name: str) -> str:
+        """Get the filename of a namespace's forward declaration header."""
+        return f"{namespace_name}_fwd.hpp"
+
+    def get_types_filename(self, namespace_name: str) -> str:
+        """Get the filename of a namespace's split struct, typedef and constant header."""
+        return f"{namespace_name}_types.hpp"
+
+    def get_interface_filename(self, namespace_name: str, interface_name: str) -> str:
+        """Get the filename of an interface's split header."""
+        return f"{namespace_name}_{interface_name}.hpp"
+
+    def get_module_filename(self, namespace_name: str) -> str:
+        """Get the filename of a namespace's C++20 module interface unit."""
+        return f"{namespace_name}.cppm"
@@ -0,0 +1,303 @@
+"""Out-of-process proxy and stub generator for MinimIDL."""
+
+from dataclasses import dataclass, field
+from pathlib import Path
+from typing import Any
+
+from minimidl.ast.nodes import (
+    ArrayType,
+    IDLFile,
+    Interface,
+    Namespace,
+    NullableType,
+    PrimitiveType,
+    StreamType,
+    Type,
+    TypeRef,
+)
+from minimidl.generators.serialization import SerializationGenerator
+
+
+@dataclass
+class RemoteParameter:
+    """Argument of a remote call."""
+
+    name: str
+    kind: str  # value, object or nullable_object
+    cpp_type: str  # C++ type of the value; the interface name for objects
+    argument: str  # Expression passing the decoded argument on the server
+
+
+@dataclass
+class RemoteMember:
+    """Property accessor or method callable through a proxy."""
+
+    id: int
+    name: str
+    declaration: str  # Return type, name, parameters and qualifiers
+    definition: str  # The same, qualified with the proxy class
+    parameters: list[RemoteParameter] = field(default_factory=list)
+    # void, value, object, nullable_object, array_object, stream_value or stream_object
+    result_kind: str = "void"
+    result_type: str = "void"  # C++ type of a value result; the interface for objects
+    returns_reference: bool = False
+    is_async: bool = False
+
+
+class RemoteGenerator(SerializationGenerator):
+    """Generate C++ proxies and stubs for calling interfaces out of process.
+
+    For each namespace this emits ``<Namespace>Remote.hpp`` with a
+    ``<Name>Proxy`` implementing each interface by sending its calls over a
+    ``minimidl::ipc`` shared-memory channel, and a ``<Name>Stub`` that runs
+    them on the real object in the server. Arguments and results use the
+    codecs from ``<Namespace>Serialization.hpp``.
+    """
+
+    def __init__(
+        self,
+        template_dir: Path | None = None,
+        config: dict[str, Any] | None = None,
+    ) -> None:
+        """Initialize the remote generator."""
+        super().__init__(template_dir, config)
+        self.remote_names: set[str] = set()
+
+    def get_custom_filters(self) -> dict[str, Any]:
+        """Get remote specific Jinja2 filters."""
+        filters = super().get_custom_filters()
+        filters.update(
+            {
+                "is_remote": self.is_remote,
+                "remote_interfaces": self.remote_interfaces,
+                "remote_members": self.remote_members,
+            }
+        )
+        return filters
+
+    def interface_of(self, type_spec: Type) -> str | None:
+        """Get the interface a type refers to, if it is an object reference."""
+        type_spec = self.resolve(type_spec)
+        if isinstance(type_spec, TypeRef) and type_spec.name in self.interface_names:
+            return type_spec.name
+        return None
+
+    def argument_kind(self, type_spec: Type) -> str | None:
+        """Classify how an argument crosses the channel, or None if it cannot."""
+        if self.is_serializable(type_spec):
+            return "value"
+        if self.interface_of(type_spec):
+            return "object"
+        if isinstance(type_spec, NullableType) and self.interface_of(type_spec.inner_type):
+            return "nullable_object"
+        return None
+
+    def result_kind(self, type_spec: Type) -> str | None:
+        """Classify how a result crosses the channel, or None if it cannot.
+
+        Objects are returned as new proxies, alone or as arrays and streams
+        of them; streams are sent whole.
+        """
+        type_spec = self.resolve(type_spec)
+        if isinstance(type_spec, PrimitiveType) and type_spec.name == "void":
+            return "void"
+        if isinstance(type_spec, StreamType):
+            if self.is_serializable(type_spec.element_type):
+                return "stream_value"
+            if self.interface_of(type_spec.element_type):
+                return "stream_object"
+            return None
+        if isinstance(type_spec, ArrayType) and self.interface_of(type_spec.element_type):
+            return "array_object"
+        if self.interface_of(type_spec):
+            return "object"
+        if isinstance(type_spec, NullableType) and self.interface_of(type_spec.inner_type):
+            return "nullable_object"
+        if self.is_serializable(type_spec):
+            return "value"
+        return None
+
+    def referenced_interfaces(self, interface: Interface) -> set[str]:
+        """Get the interfaces whose objects an interface's calls pass or return."""
+        types = [prop.type for prop in interface.properties]
+        for method in interface.methods:
+            types.append(method.return_type)
+            types.extend(param.type for param in method.parameters)
+        names = set()
+        for type_spec in types:
+            type_spec = self.resolve(type_spec)
+            if isinstance(type_spec, NullableType):
+                type_spec = type_spec.inner_type
+            elif isinstance(type_spec, StreamType):
+                type_spec = type_spec.element_type
+            name = self.interface_of(type_spec)
+            if name:
+                names.add(name)
+        return names
+
+    def supports(self, interface: Interface) -> bool:
+        """Check if every member of an interface can be called remotely."""
+        for prop in interface.properties:
+            if self.result_kind(prop.type) in (None, "void"):
+                return False
+            if prop.writable and self.argument_kind(prop.type) is None:
+                return False
+        for method in interface.methods:
+            if self.result_kind(method.return_type) is None:
+                return False
+            if any(self.argument_kind(param.type) is None for param in method.parameters):
+                return False
+        # Events are not remoted: a proxy keeps the local events it inherits
+        return True
+
+    def is_remote(self, interface: Interface) -> bool:
+        """Check if an interface gets a proxy and a stub."""
+        return interface.name in self.remote_names
+
+    def remote_interfaces(self, namespace: Namespace) -> list[Interface]:
+        """Get the interfaces of a namespace that get a proxy and a stub."""
+        return [interface for interface in namespace.interfaces if self.is_remote(interface)]
+
+    def parameter(self, name: str, type_spec: Type, argument: str) -> RemoteParameter:
+        """Describe one argument of a remote call.
+
+        The stub decodes argument ``name`` into ``arg_<name>``, which
+        ``argument`` passes on.
+        """
+        kind = self.argument_kind(type_spec)
+        if kind == "object":
+            cpp_type = self.interface_of(type_spec)
+        elif kind == "nullable_object":
+            cpp_type = self.interface_of(type_spec.inner_type)
+        else:
+            cpp_type = self.cpp_type(type_spec)
+        return RemoteParameter(name=name, kind=kind, cpp_type=cpp_type, argument=argument)
+
+    def result(self, member: RemoteMember, type_spec: Type) -> None:
+        """Fill in how a member's result is sent back."""
+        type_spec = self.resolve(type_spec)
+        member.result_kind = self.result_kind(type_spec)
+        if member.result_kind == "object":
+            member.result_type = self.interface_of(type_spec)
+        elif member.result_kind == "nullable_object":
+            member.result_type = self.interface_of(type_spec.inner_type)
+        elif member.result_kind in ("array_object", "stream_object"):
+            member.result_type = self.interface_of(type_spec.element_type)
+        elif member.result_kind == "stream_value":
+            member.result_type = self.cpp_type(type_spec.element_type)
+        elif member.result_kind == "value":
+            member.result_type = self.cpp_type(type_spec)
+
+    def remote_members(self, interface: Interface) -> list[RemoteMember]:
+        """Number the accessors and methods of an interface for its proxy and stub.
+
+        Ids start at 1 and follow declaration order, properties first; id 0
+        releases an object.
+        """
+        members = []
+        proxy = f"{interface.name}Proxy"
+
+        def add(name: str, returns: str, params: str, qualifiers: str) -> RemoteMember:
+            member = RemoteMember(
+                id=len(members) + 1,
+                name=name,
+                declaration=f"{returns} {name}({params}){qualifiers}",
+                definition=f"{returns} {proxy}::{name}({params}){qualifiers}",
+            )
+            members.append(member)
+            return member
+
+        for prop in interface.properties:
+            returns = self.cpp_getter_type(prop.type)
+            getter = add(f"get_{prop.name}", returns, "", " const")
+            getter.returns_reference = returns.endswith("&")
+            self.result(getter, prop.type)
+            if prop.writable:
+                setter = add(
+                    f"set_{prop.name}",
+                    "void",
+                    f"{self.cpp_setter_param_type(prop.type)} value",
+                    "",
+                )
+                # Sink setters take their decoded argument over
+                argument = "arg_value"
+                if self.config.get("sink_setters", False) and self.is_sink(prop.type):
+                    argument = "std::move(arg_value)"
+                value = self.parameter("value", prop.type, argument)
+                # Setters keep their object, so it crosses as a reference
+                if value.kind == "object":
+                    value.kind = "nullable_object"
+                setter.parameters.append(value)
+
+        for method in interface.methods:
+            params = ", ".join(
+                f"{self.cpp_param_type(param.type)} {param.name}" for param in method.parameters
+            )
+            member = add(
+                method.name,
+                self.cpp_return_type(method),
+                params,
+                " noexcept" if method.noexcept else "",
+            )
+            member.is_async = method.is_async
+            self.result(member, method.return_type)
+            for param in method.parameters:
+                member.parameters.append(
+                    self.parameter(param.name, param.type, f"arg_{param.name}")
+                )
+
+        return members
+
+    def generate(self, idl_file: IDLFile, output_dir: Path) -> list[Path]:
+        """Generate proxy and stub headers from AST.
+
+        Args:
+            idl_file: Parsed IDL file AST
+            output_dir: Directory to write generated files
+
+        Returns:
+            List of generated file paths
+        """
+        generated_files = []
+
+        for namespace in idl_file.namespaces:
+            filename = self.get_output_filename(namespace.name)
+            self.enum_names = {enum.name for enum in namespace.enums}
+            self.struct_names = {struct.name for struct in namespace.structs}
+            self.typedefs = {typedef.name: typedef.type for typedef in namespace.typedefs}
+            self.interface_names = {interface.name for interface in namespace.interfaces}
+
+            # An interface is remote if all its members are, including the
+            # interfaces it hands out
+            remote = {
+                interface.name: interface
+                for interface in namespace.interfaces
+                if self.supports(interface)
+            }
+            changed = True
+            while changed:
+                changed = False
+                for name, interface in list(remote.items()):
+                    if not self.referenced_interfaces(interface) <= remote.keys():
+                        del remote[name]
+                        changed = True
+            self.remote_names = set(remote)
+
+            template = self.get_template("cpp/remote.hpp.jinja2")
+            content = template.render(namespace=namespace)
+
+            output_path = self.write_file(output_dir, filename, content)
+            generated_files.append(output_path)
+
+        return generated_files
+
+    def get_output_filename(self, namespace_name: str) -> str:
+        """Get output filename for a namespace.
+
+        Args:
+            namespace_name: Name of the namespace
+
+        Returns:
+            Output filename
+        """
+        return f"{namespace_name}Remote.hpp"
@@ -0,0 +1,152 @@
+"""Binary serialization code generator for MinimIDL."""
+
+from pathlib import Path
+from typing import Any
+
+from minimidl.ast.nodes import (
+    ArrayType,
+    DictType,
+    FixedStringType,
+    IDLFile,
+    Interface,
+    NullableType,
+    PrimitiveType,
+    Property,
+    SetType,
+    Type,
+    TypeRef,
+)
+from minimidl.generators.cpp import CppGenerator
+
+
+class SerializationGenerator(CppGenerator):
+    """Generate C++ binary encode/decode routines from MinimIDL AST.
+
+    For each namespace this emits ``<Namespace>Serialization.hpp`` next to
+    the interface header, with codecs for structs and, for each interface,
+    a ``<Name>Record`` holding its property values and a ``<Name>View`` that
+    reads them in place from encoded bytes.
+    """
+
+    def __init__(
+        self,
+        template_dir: Path | None = None,
+        config: dict[str, Any] | None = None,
+    ) -> None:
+        """Initialize the serialization generator."""
+        super().__init__(template_dir, config)
+        self.typedefs: dict[str, Type] = {}
+
+    def get_custom_filters(self) -> dict[str, Any]:
+        """Get serialization specific Jinja2 filters."""
+        filters = super().get_custom_filters()
+        filters.update(
+            {
+                "serialized_properties": self.serialized_properties,
+                "wire_view_type": self.wire_view_type,
+                "wire_view_kind": self.wire_view_kind,
+            }
+        )
+        return filters
+
+    def resolve(self, type_spec: Type) -> Type:
+        """Follow typedefs to the type they name."""
+        while isinstance(type_spec, TypeRef) and type_spec.name in self.typedefs:
+            type_spec = self.typedefs[type_spec.name]
+        return type_spec
+
+    def is_serializable(self, type_spec: Type) -> bool:
+        """Check if values of a type can be encoded.
+
+        Object references have no encoding; interfaces are written as the
+        values of their properties instead.
+        """
+        type_spec = self.resolve(type_spec)
+        if isinstance(type_spec, PrimitiveType):
+            return type_spec.name != "void"
+        if isinstance(type_spec, FixedStringType):
+            return True
+        if isinstance(type_spec, TypeRef):
+            return type_spec.name in self.enum_names or type_spec.name in self.struct_names
+        if isinstance(type_spec, (ArrayType, SetType)):
+            return self.is_serializable(type_spec.element_type)
+        if isinstance(type_spec, DictType):
+            return self.is_serializable(type_spec.key_type) and self.is_serializable(
+                type_spec.value_type
+            )
+        if isinstance(type_spec, NullableType):
+            return self.is_serializable(type_spec.inner_type)
+        return False
+
+    def serialized_properties(self, interface: Interface) -> list[Property]:
+        """Get the properties written for an interface, in declaration order."""
+        return [prop for prop in interface.properties if self.is_serializable(prop.type)]
+
+    def wire_view_kind(self, type_spec: Type) -> str:
+        """Classify how a ``<Name>View`` member is read from the input.
+
+        Returns:
+            ``"string"`` and ``"optional_string"`` for views into the input,
+            ``"encoded"`` for collections decoded on demand, or ``"value"``
+            for plain values decoded directly
+        """
+        type_spec = self.resolve(type_spec)
+        if isinstance(type_spec, PrimitiveType) and type_spec.name == "string_t":
+            return "string"
+        if isinstance(type_spec, NullableType):
+            inner = self.resolve(type_spec.inner_type)
+            if isinstance(inner, PrimitiveType) and inner.name == "string_t":
+                return "optional_string"
+            return "value" if self.is_scalar(inner) else "encoded"
+        if isinstance(type_spec, (ArrayType, DictType, SetType)):
+            return "encoded"
+        return "value"
+
+    def wire_view_type(self, type_spec: Type) -> str:
+        """Get the C++ type of a ``<Name>View`` member."""
+        kind = self.wire_view_kind(type_spec)
+        if kind == "string":
+            return "std::string_view"
+        if kind == "optional_string":
+            return "std::optional<std::string_view>"
+        if kind == "encoded":
+            return f"minimidl::wire::encoded<{self.cpp_type(type_spec)}>"
+        return self.cpp_type(type_spec)
+
+    def generate(self, idl_file: IDLFile, output_dir: Path) -> list[Path]:
+        """Generate serialization headers from AST.
+
+        Args:
+            idl_file: Parsed IDL file AST
+            output_dir: Directory to write generated files
+
+        Returns:
+            List of generated file paths
+        """
+        generated_files = []
+
+        for namespace in idl_file.namespaces:
+            filename = self.get_output_filename(namespace.name)
+            self.enum_names = {enum.name for enum in namespace.enums}
+            self.struct_names = {struct.name for struct in namespace.structs}
+            self.typedefs = {typedef.name: typedef.type for typedef in namespace.typedefs}
+            self.interface_names = {interface.name for interface in namespace.interfaces}
+
+            template = self.get_template("cpp/serialization.hpp.jinja2")
+            content = template.render(namespace=namespace)
+
+            output_path = self.write_file(output_dir, filename, content)
+            generated_files.append(output_path)
+
+        return generated_files
+
+    def get_output_filename(self, namespace_name: str) -> str:
+        """Get output filename for a namespace.
+
+        Args:
+            namespace_name: Name of the namespace
+
+        Returns:
+            Output filename
+        """
+        return f"{namespace_name}Serialization.hpp"
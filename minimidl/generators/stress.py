@@ -0,0 +1,83 @@
+"""Multi-threaded load test generator for the C wrapper."""
+
+from dataclasses import dataclass
+from pathlib import Path
+from typing import Any
+
+from minimidl.ast.nodes import IDLFile, Namespace
+from minimidl.generators.benchmark import BenchCase, BenchmarkGenerator
+
+
+@dataclass
+class StressEntry:
+    """C entry point called by the load test."""
+
+    interface: str  # Interface the entry point belongs to
+    case: BenchCase  # C statements calling it
+
+
+class StressGenerator(BenchmarkGenerator):
+    """Generate a load test calling the C wrapper from many threads.
+
+    For each namespace this emits ``<namespace>_stress.cpp``. Worker threads
+    call every C entry point the benchmarks time, in a random mix of reads
+    and writes, on the same in-memory implementations, and the program
+    reports throughput and latency percentiles per entry point.
+
+    Getters are reads and run on objects shared by all threads; setters and
+    methods are writes and run on objects each thread owns. The
+    implementations therefore need no locks, and the contention measured is
+    the wrapper's own: reference counts, allocations and per-thread state.
+    """
+
+    keep = "Keep"
+
+    def get_custom_filters(self) -> dict[str, Any]:
+        """Get load test specific Jinja2 filters."""
+        filters = super().get_custom_filters()
+        filters["stress_entries"] = self.stress_entries
+        return filters
+
+    def stress_entries(self, namespace: Namespace) -> list[StressEntry]:
+        """Get the C entry points the load test calls, in the order of their ids."""
+        return [
+            StressEntry(interface=interface.name, case=case)
+            for interface in self.bench_interfaces(namespace)
+            for case in self.bench_cases(interface)
+            if case.c_call
+        ]
+
+    def generate(self, idl_file: IDLFile, output_dir: Path) -> list[Path]:
+        """Generate load test sources from AST.
+
+        Args:
+            idl_file: Parsed IDL file AST
+            output_dir: Directory to write generated files
+
+        Returns:
+            List of generated file paths
+        """
+        generated_files = []
+
+        for namespace in idl_file.namespaces:
+            self.use_namespace(namespace)
+            template = self.get_template("c_wrapper/stress.cpp.j2")
+            content = template.render(namespace=namespace)
+
+            output_path = self.write_file(
+                output_dir, self.get_output_filename(namespace.name), content
+            )
+            generated_files.append(output_path)
+
+        return generated_files
+
+    def get_output_filename(self, namespace_name: str) -> str:
+        """Get output filename for a namespace.
+
+        Args:
+            namespace_name: Name of the namespace
+
+        Returns:
+            Output filename
+        """
+        return f"{namespace_name.lower()}_stress.cpp"
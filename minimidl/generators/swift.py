@@ -8,7 +8,9 @@ from minimidl.ast.nodes import (
     BinaryExpression,
     DictType,
     Enum,
+    Event,
     Expression,
+    FixedStringType,
     IdentifierExpression,
     IDLFile,
     Interface,
@@ -21,6 +23,7 @@ from minimidl.ast.nodes import (
     PrimitiveType,
     Property,
     SetType,
+    StreamType,
     Type,
     TypeRef,
     UnaryExpression,
@@ -32,13 +35,18 @@ from minimidl.generators.c_wrapper import CWrapperGenerator
 class SwiftGenerator(BaseGenerator):
     """Generate Swift bindings from MinimIDL AST."""
 
-    def __init__(self, template_dir: Path | None = None) -> None:
+    def __init__(
+        self,
+        template_dir: Path | None = None,
+        config: dict[str, Any] | None = None,
+    ) -> None:
         """Initialize the Swift generator."""
-        super().__init__(template_dir)
+        super().__init__(template_dir, config)
         # We'll use the C wrapper generator for C function names
-        self.c_gen = CWrapperGenerator()
+        self.c_gen = CWrapperGenerator(config=self.config)
         self.namespace_name = ""
         self.enum_names: set[str] = set()
+        self.struct_names: set[str] = set()
 
     def get_custom_filters(self) -> dict[str, Any]:
         """Get Swift specific Jinja2 filters."""
@@ -47,15 +55,34 @@ class SwiftGenerator(BaseGenerator):
             "swift_param_type": self.swift_param_type,
             "swift_return_type": self.swift_return_type,
             "swift_class_name": self.swift_class_name,
+            "swift_member_name": self.swift_member_name,
+            "swift_event_handler": self.swift_event_handler,
+            "swift_event_output": self.swift_event_output,
+            "swift_property_declaration": self.swift_property_declaration,
             "c_function_name": self.c_gen.c_function_name,
+            "c_type": self.c_gen.c_type,
             "is_nullable": self.is_nullable,
             "is_primitive": self.is_primitive,
             "is_string": self.is_string,
+            "has_string_view": self.c_gen.has_string_view,
+            "has_view_setter": self.c_gen.has_view_setter,
+            "is_id": self.is_id,
+            "has_ids": self.c_gen.has_ids,
             "is_array": self.is_array,
             "is_dict": self.is_dict,
             "is_set": self.is_set,
+            "is_stream": self.c_gen.is_stream,
+            "has_streams": self.c_gen.has_streams,
             "is_interface": self.is_interface,
             "is_enum": self.is_enum,
+            "is_struct": self.is_struct,
+            "is_fixed_string": self.is_fixed_string,
+            "snapshot_properties": self.snapshot_properties,
+            "has_snapshots": self.has_snapshots,
+            "batch_properties": self.batch_properties,
+            "batch_methods": self.batch_methods,
+            "has_async_methods": self.c_gen.has_async_methods,
+            "has_events": self.c_gen.has_events,
             "needs_optional": self.needs_optional,
             "c_to_swift_value": self.c_to_swift_value,
             "swift_to_c_value": self.swift_to_c_value,
@@ -96,12 +123,13 @@ class SwiftGenerator(BaseGenerator):
                 "float": "Float",
                 "double": "Double",
                 "string_t": "String",
+                "id_t": f"{self.namespace_name}Id",
             }
             return type_map.get(type_spec.name, type_spec.name)
 
         elif isinstance(type_spec, TypeRef):
-            # Could be enum or interface
-            if type_spec.name in self.enum_names:
+            # Could be enum, struct or interface
+            if type_spec.name in self.enum_names or type_spec.name in self.struct_names:
                 return type_spec.name
             else:
                 # Interface - use class name
@@ -120,6 +148,10 @@ class SwiftGenerator(BaseGenerator):
             element_type = self.swift_type(type_spec.element_type)
             return f"Set<{element_type}>"
 
+        elif isinstance(type_spec, StreamType):
+            element_type = self.swift_type(type_spec.element_type)
+            return f"{self.c_gen.namespace_prefix}Stream<{element_type}>"
+
         elif isinstance(type_spec, NullableType):
             inner_type = self.swift_type(type_spec.inner_type)
             return f"{inner_type}?"
@@ -163,6 +195,49 @@ class SwiftGenerator(BaseGenerator):
             return interface_name[1:]
         return interface_name
 
+    def swift_member_name(self, name: str) -> str:
+        """Get a Swift member name, which starts lowercase, for an IDL name."""
+        return name[:1].lower() + name[1:]
+
+    def swift_event_handler(self, event: Event) -> str:
+        """Get the closure type of an event's handler."""
+        arguments = ", ".join(self.swift_type(param.type) for param in event.parameters)
+        return f"({arguments}) -> Void"
+
+    def swift_event_output(self, event: Event) -> str:
+        """Get the value type an event's Combine publisher sends.
+
+        Args:
+            event: Interface event
+
+        Returns:
+            ``Void``, the type of a single argument, or a labeled tuple
+        """
+        if not event.parameters:
+            return "Void"
+        if len(event.parameters) == 1:
+            return self.swift_type(event.parameters[0].type)
+        fields = ", ".join(
+            f"{param.name}: {self.swift_type(param.type)}" for param in event.parameters
+        )
+        return f"({fields})"
+
+    def swift_property_declaration(self, prop: Property) -> str:
+        """Get the line opening a property of a wrapper class.
+
+        ``[immutable]`` properties are read from the C API once, on first
+        use, and cached on the Swift object. Their getter body becomes a
+        private ``<name>Value()`` function that the lazy property calls.
+        """
+        swift_type = self.swift_type(prop.type)
+        if "immutable" in prop.attributes:
+            return (
+                f"public private(set) lazy var {prop.name}: {swift_type} = {prop.name}Value()\n"
+                "    \n"
+                f"    private func {prop.name}Value() -> {swift_type} {{"
+            )
+        return f"public var {prop.name}: {swift_type} {{"
+
     def is_nullable(self, type_spec: Type) -> bool:
         """Check if type is nullable."""
         return isinstance(type_spec, NullableType)
@@ -171,7 +246,13 @@ class SwiftGenerator(BaseGenerator):
         """Check if type is primitive."""
         if isinstance(type_spec, NullableType):
             return self.is_primitive(type_spec.inner_type)
-        return isinstance(type_spec, PrimitiveType) and type_spec.name != "string_t"
+        return isinstance(type_spec, PrimitiveType) and type_spec.name not in ("string_t", "id_t")
+
+    def is_id(self, type_spec: Type) -> bool:
+        """Check if type is the interned ``id_t``, wrapped in a Swift struct."""
+        if isinstance(type_spec, NullableType):
+            return self.is_id(type_spec.inner_type)
+        return isinstance(type_spec, PrimitiveType) and type_spec.name == "id_t"
 
     def is_string(self, type_spec: Type) -> bool:
         """Check if type is string."""
@@ -201,7 +282,11 @@ class SwiftGenerator(BaseGenerator):
         """Check if type is an interface reference."""
         if isinstance(type_spec, NullableType):
             return self.is_interface(type_spec.inner_type)
-        return isinstance(type_spec, TypeRef) and type_spec.name not in self.enum_names
+        return (
+            isinstance(type_spec, TypeRef)
+            and type_spec.name not in self.enum_names
+            and type_spec.name not in self.struct_names
+        )
 
     def is_enum(self, type_spec: Type) -> bool:
         """Check if type is an enum."""
@@ -209,6 +294,65 @@ class SwiftGenerator(BaseGenerator):
             return self.is_enum(type_spec.inner_type)
         return isinstance(type_spec, TypeRef) and type_spec.name in self.enum_names
 
+    def is_struct(self, type_spec: Type) -> bool:
+        """Check if type is a struct, imported from C as a Swift struct."""
+        return isinstance(type_spec, TypeRef) and type_spec.name in self.struct_names
+
+    def is_fixed_string(self, type_spec: Type) -> bool:
+        """Check if type is a fixed-size string struct field."""
+        return isinstance(type_spec, FixedStringType)
+
+    def snapshot_properties(self, interface: Interface) -> list[Property]:
+        """Get the properties decoded from an interface's C snapshot.
+
+        Values with a flat C representation are decoded: primitives, ids,
+        enums, structs, strings and arrays of those. Dictionaries, sets and object
+        references stay available through their own properties.
+
+        Args:
+            interface: Interface to snapshot
+
+        Returns:
+            Properties in declaration order; empty if no ``snapshot()`` is emitted
+        """
+
+        def is_flat(type_spec: Type) -> bool:
+            return not self.is_nullable(type_spec) and (
+                self.is_primitive(type_spec)
+                or self.is_id(type_spec)
+                or self.is_enum(type_spec)
+                or self.is_struct(type_spec)
+                or self.is_string(type_spec)
+            )
+
+        return [
+            prop
+            for prop in self.c_gen.snapshot_properties(interface)
+            if is_flat(prop.type)
+            or (isinstance(prop.type, ArrayType) and is_flat(prop.type.element_type))
+        ]
+
+    def has_snapshots(self, namespace: Namespace) -> bool:
+        """Check if any interface in a namespace gets a ``snapshot()``."""
+        return any(self.snapshot_properties(interface) for interface in namespace.interfaces)
+
+    def batch_properties(self, interface: Interface) -> list[Property]:
+        """Get the properties with static Swift wrappers over ``_Batch`` calls.
+
+        Ids are left out, since the C buffers hold handles rather than the
+        Swift struct.
+        """
+        return [prop for prop in self.c_gen.batch_properties(interface) if not self.is_id(prop.type)]
+
+    def batch_methods(self, interface: Interface) -> list[Method]:
+        """Get the methods with static Swift wrappers over ``_Batch`` calls."""
+        return [
+            method
+            for method in self.c_gen.batch_methods(interface)
+            if not self.is_id(method.return_type)
+            and not any(self.is_id(param.type) for param in method.parameters)
+        ]
+
     def needs_optional(self, type_spec: Type) -> bool:
         """Check if type needs optional handling in Swift."""
         # Nullable types and strings from C need optional handling
@@ -228,7 +372,7 @@ class SwiftGenerator(BaseGenerator):
             Swift code for conversion
         """
         if self.is_string(type_spec):
-            return f"String(cString: {var_name}!)"
+            return f"takeString({var_name}) ?? \"\""
         elif self.is_primitive(type_spec) or self.is_enum(type_spec):
             return var_name
         elif self.is_interface(type_spec):
@@ -256,6 +400,8 @@ class SwiftGenerator(BaseGenerator):
             return var_name
         elif self.is_primitive(type_spec) or self.is_enum(type_spec):
             return var_name
+        elif self.is_id(type_spec):
+            return f"{var_name}.handle"
         elif self.is_interface(type_spec):
             if self.is_nullable(type_spec):
                 return f"{var_name}?.handle"
@@ -331,7 +477,9 @@ class SwiftGenerator(BaseGenerator):
             self.namespace_name = namespace.name
             self.c_gen.namespace_prefix = namespace.name
             self.enum_names = {enum.name for enum in namespace.enums}
+            self.struct_names = {struct.name for struct in namespace.structs}
             self.c_gen.enum_names = self.enum_names
+            self.c_gen.struct_names = self.struct_names
 
             # Create package directory
             package_dir = output_dir / namespace.name
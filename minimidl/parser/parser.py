@@ -1,5 +1,6 @@
 """IDL parser implementation using Lark."""
 
+from functools import cache
 from pathlib import Path
 from typing import Any, overload
 
@@ -13,6 +14,25 @@ from minimidl.ast.transformer import IDLTransformer
 GRAMMAR_FILE = Path(__file__).parent / "grammar.lark"
 
 
+@cache
+def _load_lark() -> Lark:
+    """Build the LALR parser for the IDL grammar once per process.
+
+    Lark stores the compiled tables in a cache file keyed by the grammar,
+    the options and the Lark version, so later processes load them instead
+    of rebuilding them from the grammar.
+    """
+    grammar_text = GRAMMAR_FILE.read_text(encoding="utf-8")
+    return Lark(
+        grammar_text,
+        parser="lalr",
+        debug=False,
+        propagate_positions=True,
+        maybe_placeholders=False,
+        cache=True,
+    )
+
+
 class IDLParser:
     """MinimIDL parser using Lark grammar."""
 
@@ -25,16 +45,9 @@ class IDLParser:
         """Create and configure the Lark parser.
 
         Returns:
-            Configured Lark parser instance.
+            Configured Lark parser instance, shared by all parsers of the process.
         """
-        grammar_text = GRAMMAR_FILE.read_text(encoding="utf-8")
-        return Lark(
-            grammar_text,
-            parser="lalr",
-            debug=False,
-            propagate_positions=True,
-            maybe_placeholders=False,
-        )
+        return _load_lark()
 
     @overload
     def parse(self, idl_content: str, *, transform: bool = True) -> IDLFile: ...
@@ -7,6 +7,7 @@ from loguru import logger
 
 from minimidl.ast.nodes import IDLFile
 from minimidl.generators.c_wrapper import CWrapperGenerator
+from minimidl.generators.stress import StressGenerator
 
 
 class CWorkflow:
@@ -19,7 +20,7 @@ class CWorkflow:
             config: Optional configuration options
         """
         self.config = config or {}
-        self.generator = CWrapperGenerator()
+        self.generator = CWrapperGenerator(config=self.config)
 
     def generate_project(
         self, idl_file: IDLFile, output_dir: Path, project_name: str | None = None
@@ -49,6 +50,11 @@ class CWorkflow:
         # Generate C wrapper files
         generated_files = self.generator.generate(idl_file, project_dir)
 
+        # Generate the multi-threaded load test
+        if self.config.get("stress", False):
+            stress_generator = StressGenerator(config=self.config)
+            generated_files.extend(stress_generator.generate(idl_file, project_dir))
+
         logger.success(
             f"Generated C wrapper project with {len(generated_files)} files in {project_dir}"
         )
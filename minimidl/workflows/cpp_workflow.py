@@ -6,7 +6,11 @@ from typing import Any
 from loguru import logger
 
 from minimidl.ast.nodes import IDLFile
+from minimidl.generators.base import write_if_changed
+from minimidl.generators.benchmark import BenchmarkGenerator
 from minimidl.generators.cpp import CppGenerator
+from minimidl.generators.remote import RemoteGenerator
+from minimidl.generators.serialization import SerializationGenerator
 
 
 class CppWorkflow:
@@ -19,7 +23,7 @@ class CppWorkflow:
             config: Optional configuration options
         """
         self.config = config or {}
-        self.generator = CppGenerator()
+        self.generator = CppGenerator(config=self.config)
 
     def generate_project(
         self, idl_file: IDLFile, output_dir: Path, project_name: str | None = None
@@ -58,6 +62,17 @@ class CppWorkflow:
         cpp_files = self.generator.generate(idl_file, include_dir)
         generated_files.extend(cpp_files)
 
+        # Generate binary serialization headers; proxies and stubs need them
+        remote = self.config.get("remote", False)
+        if remote or self.config.get("serialization", False):
+            serialization_generator = SerializationGenerator(config=self.config)
+            generated_files.extend(serialization_generator.generate(idl_file, include_dir))
+
+        # Generate out-of-process proxies and stubs
+        if remote:
+            remote_generator = RemoteGenerator(config=self.config)
+            generated_files.extend(remote_generator.generate(idl_file, include_dir))
+
         # Generate CMakeLists.txt
         cmake_content = self._generate_cmake(project_name or "Generated", idl_file)
         cmake_path = self._write_file(project_dir / "CMakeLists.txt", cmake_content)
@@ -73,6 +88,11 @@ class CppWorkflow:
         runtime_path = self._write_file(include_dir / "minimidl_runtime.hpp", runtime_content)
         generated_files.append(runtime_path)
 
+        # Generate minimidl_ipc.hpp for the proxies and stubs
+        if remote:
+            ipc_content = self._generate_runtime_header("minimidl_ipc.hpp")
+            ipc_path = self._write_file(include_dir / "minimidl_ipc.hpp", ipc_content)
+            generated_files.append(ipc_path)
 
         # Generate example code
         example_content = self._generate_example(project_name or "Generated", idl_file)
@@ -84,6 +104,16 @@ class CppWorkflow:
         test_path = self._write_file(tests_dir / "test_main.cpp", test_content)
         generated_files.append(test_path)
 
+        # Generate benchmarks
+        if self.config.get("benchmarks", False):
+            benchmarks_dir = project_dir / "benchmarks"
+            benchmark_generator = BenchmarkGenerator(config=self.config)
+            generated_files.extend(benchmark_generator.generate(idl_file, benchmarks_dir))
+            benchmark_cmake = self._generate_benchmark_cmake(idl_file)
+            generated_files.append(
+                self._write_file(benchmarks_dir / "CMakeLists.txt", benchmark_cmake)
+            )
+
         # Generate build script
         build_content = self._generate_build_script()
         build_path = self._write_file(project_dir / "build.sh", build_content)
@@ -99,8 +129,69 @@ class CppWorkflow:
         """Generate CMakeLists.txt content."""
         # Get all header files from namespaces
         headers = []
+        remote = self.config.get("remote", False)
+        split = self.config.get("split_headers", False)
         for namespace in idl_file.namespaces:
-            headers.append(f"{namespace.name}.hpp")
+            headers.append(self.generator.get_output_filename(namespace.name))
+            if split:
+                headers.append(self.generator.get_fwd_filename(namespace.name))
+                headers.append(self.generator.get_types_filename(namespace.name))
+                headers.extend(
+                    self.generator.get_interface_filename(namespace.name, interface.name)
+                    for interface in namespace.interfaces
+                )
+            if remote or self.config.get("serialization", False):
+                headers.append(f"{namespace.name}Serialization.hpp")
+            if remote:
+                headers.append(f"{namespace.name}Remote.hpp")
+        if remote:
+            headers.append("minimidl_ipc.hpp")
+
+        # Targets link the precompiled runtime when the headers are split
+        library = "${PROJECT_NAME}_pch" if split else "${PROJECT_NAME}_interface"
+        compile_time = ""
+        if split:
+            modules = "\n".join(
+                f"                include/{self.generator.get_module_filename(namespace.name)}"
+                for namespace in idl_file.namespaces
+            )
+            compile_time = f"""
+# Precompiled standard library and runtime headers. Link this instead of
+# ${{PROJECT_NAME}}_interface so each target parses them once, not per source.
+add_library(${{PROJECT_NAME}}_pch INTERFACE)
+target_link_libraries(${{PROJECT_NAME}}_pch INTERFACE ${{PROJECT_NAME}}_interface)
+target_precompile_headers(${{PROJECT_NAME}}_pch
+    INTERFACE
+        "$<BUILD_INTERFACE:${{CMAKE_CURRENT_SOURCE_DIR}}/include/minimidl_runtime.hpp>"
+)
+
+# C++20 module interface units, for code that imports the namespaces
+# instead of including their headers
+option(${{PROJECT_NAME}}_MODULES "Build the ${{PROJECT_NAME}} C++20 modules" OFF)
+if(${{PROJECT_NAME}}_MODULES)
+    if(CMAKE_VERSION VERSION_LESS 3.28)
+        message(FATAL_ERROR "${{PROJECT_NAME}}_MODULES needs CMake 3.28 or later")
+    endif()
+    add_library(${{PROJECT_NAME}}_modules)
+    target_sources(${{PROJECT_NAME}}_modules
+        PUBLIC
+            FILE_SET CXX_MODULES
+            BASE_DIRS ${{CMAKE_CURRENT_SOURCE_DIR}}/include
+            FILES
+{modules}
+    )
+    target_compile_features(${{PROJECT_NAME}}_modules PUBLIC cxx_std_20)
+    target_link_libraries(${{PROJECT_NAME}}_modules PUBLIC ${{PROJECT_NAME}}_interface)
+endif()
+"""
+
+        # Benchmarks come after the C wrapper so they can link to it
+        benchmarks = ""
+        if self.config.get("benchmarks", False):
+            benchmarks = """
+# Per-call benchmarks
+add_subdirectory(benchmarks)
+"""
 
         return f"""cmake_minimum_required(VERSION 3.16)
 project({project_name} VERSION 1.0.0 LANGUAGES CXX)
@@ -125,24 +216,24 @@ target_include_directories(${{PROJECT_NAME}}_interface
         $<BUILD_INTERFACE:${{CMAKE_CURRENT_SOURCE_DIR}}/include>
         $<INSTALL_INTERFACE:include>
 )
-
+{compile_time}
 # Example executable
 add_executable(example src/example.cpp)
-target_link_libraries(example PRIVATE ${{PROJECT_NAME}}_interface)
+target_link_libraries(example PRIVATE {library})
 
 # Enable testing
 enable_testing()
 
 # Test executable
 add_executable(test_main tests/test_main.cpp)
-target_link_libraries(test_main PRIVATE ${{PROJECT_NAME}}_interface)
+target_link_libraries(test_main PRIVATE {library})
 add_test(NAME test_main COMMAND test_main)
 
 # Add C wrapper if it exists
 if(EXISTS "${{CMAKE_CURRENT_SOURCE_DIR}}/CWrapper/CMakeLists.txt")
     add_subdirectory(CWrapper)
 endif()
-
+{benchmarks}
 # Installation rules
 install(FILES ${{HEADERS}} DESTINATION include)
 install(TARGETS ${{PROJECT_NAME}}_interface
@@ -159,6 +250,45 @@ install(TARGETS ${{PROJECT_NAME}}_interface
 # )
 """
 
+    def _generate_benchmark_cmake(self, idl_file: IDLFile) -> str:
+        """Generate benchmarks/CMakeLists.txt content.
+
+        The benchmarks time the C ABI as well when the project is built with
+        the C wrapper of their namespace.
+        """
+        sources = "\n".join(
+            f"    {namespace.name}Benchmarks.cpp" for namespace in idl_file.namespaces
+        )
+        wrappers = "".join(
+            f"""
+if(TARGET {namespace.name.lower()}_wrapper)
+    target_link_libraries(benchmarks PRIVATE {namespace.name.lower()}_wrapper)
+    target_compile_definitions(benchmarks PRIVATE {namespace.name.upper()}_BENCHMARK_C_WRAPPER)
+endif()
+"""
+            for namespace in idl_file.namespaces
+        )
+
+        return f"""# Uses an installed Google Benchmark, or fetches it
+find_package(benchmark QUIET)
+if(NOT benchmark_FOUND)
+    include(FetchContent)
+    set(BENCHMARK_ENABLE_TESTING OFF CACHE BOOL "" FORCE)
+    set(BENCHMARK_ENABLE_GTEST_TESTS OFF CACHE BOOL "" FORCE)
+    FetchContent_Declare(
+        benchmark
+        GIT_REPOSITORY https://github.com/google/benchmark.git
+        GIT_TAG v1.8.3
+    )
+    FetchContent_MakeAvailable(benchmark)
+endif()
+
+add_executable(benchmarks
+{sources}
+)
+target_link_libraries(benchmarks PRIVATE ${{PROJECT_NAME}}_interface benchmark::benchmark_main)
+{wrappers}"""
+
     def _generate_readme(self, project_name: str, idl_file: IDLFile) -> str:
         """Generate README.md content."""
         interfaces = []
@@ -172,6 +302,36 @@ install(TARGETS ${{PROJECT_NAME}}_interface
         interfaces_section = "\n".join(interfaces) if interfaces else "No interfaces defined"
         enums_section = "\n".join(enums) if enums else "No enums defined"
 
+        benchmarks_section = ""
+        if self.config.get("benchmarks", False):
+            benchmarks_section = """
+## Running Benchmarks
+
+After building, time every accessor and method through the C++ interface
+and, if the C wrapper was built too, through the C ABI:
+
+```bash
+./build/benchmarks/benchmarks
+```
+"""
+
+        split_section = ""
+        if self.config.get("split_headers", False):
+            namespace = idl_file.namespaces[0].name if idl_file.namespaces else "Namespace"
+            split_section = f"""
+## Keeping Compile Times Down
+
+The headers are split so each source includes only what it uses:
+`{namespace}_fwd.hpp` declares the interfaces and defines the enums,
+`{namespace}_types.hpp` adds the structs, typedefs and constants, and
+`{namespace}_<Interface>.hpp` one interface. `{namespace}.hpp` includes
+them all.
+
+Link `{project_name}_pch` instead of `{project_name}_interface` to reuse a
+precompiled runtime, or configure with `-D{project_name}_MODULES=ON`
+(CMake 3.28 or later) and `import {namespace};` through `{project_name}_modules`.
+"""
+
         return f"""# {project_name}
 
 Generated C++ API from MinimIDL interface definitions.
@@ -209,7 +369,7 @@ After building:
 ```bash
 ./build/example
 ```
-
+{benchmarks_section}{split_section}
 ## API Overview
 
 ### Interfaces
@@ -361,55 +521,19 @@ echo "To run the example:"
 echo "  ./build/example"
 """
 
-    def _generate_runtime_header(self) -> str:
-        """Generate minimidl_runtime.hpp content."""
-        return """#pragma once
-// MinimIDL Runtime Support Library
-// This header provides base classes and utilities for generated code
+    def _generate_runtime_header(self, name: str = "minimidl_runtime.hpp") -> str:
+        """Generate minimidl_runtime.hpp content, or another runtime header.
 
-#include <string>
-#include <vector>
-#include <memory>
-#include <unordered_map>
-#include <atomic>
-
-namespace minimidl {
-
-// Base class for reference counted objects
-class RefCounted {
-protected:
-    mutable std::atomic<int32_t> m_refCount{1};
-    
-public:
-    virtual ~RefCounted() = default;
-    
-    void AddRef() const {
-        m_refCount.fetch_add(1, std::memory_order_relaxed);
-    }
-    
-    void Release() const {
-        if (m_refCount.fetch_sub(1, std::memory_order_acq_rel) == 1) {
-            delete this;
-        }
-    }
-};
-
-// String type for IDL compatibility
-using string_t = std::string;
-
-// Array type template
-template<typename T>
-using array_t = std::vector<T>;
-
-// Dictionary type template
-template<typename K, typename V>
-using dict_t = std::unordered_map<K, V>;
+        The runtime ships with the templates so the generated headers and the
+        C wrapper always agree on ``RefCounted`` and ``object_ptr``.
+        """
+        from importlib.resources import files
 
-} // namespace minimidl
-"""
+        runtime = files("minimidl.generators.templates") / "cpp" / name
+        return runtime.read_text()
 
     def _write_file(self, path: Path, content: str) -> Path:
-        """Write content to file.
+        """Write content to file, unless it already has that content.
 
         Args:
             path: File path
@@ -418,7 +542,6 @@ using dict_t = std::unordered_map<K, V>;
         Returns:
             Path to written file
         """
-        path.parent.mkdir(parents=True, exist_ok=True)
-        path.write_text(content)
-        logger.debug(f"Wrote {path}")
+        if write_if_changed(path, content):
+            logger.debug(f"Wrote {path}")
         return path
\ No newline at end of file
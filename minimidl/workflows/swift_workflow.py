@@ -6,6 +6,7 @@ from typing import Any
 from loguru import logger
 
 from minimidl.ast.nodes import IDLFile
+from minimidl.generators.base import write_if_changed
 from minimidl.generators.c_wrapper import CWrapperGenerator
 from minimidl.generators.swift import SwiftGenerator
 
@@ -19,9 +20,12 @@ class SwiftWorkflow:
         Args:
             config: Optional configuration options
         """
-        self.config = config or {}
-        self.swift_generator = SwiftGenerator()
-        self.c_wrapper_generator = CWrapperGenerator()
+        self.config = dict(config or {})
+        if self.config.pop("status_codes", False):
+            # The Swift bindings call the value-returning C API
+            logger.warning("status_codes is not supported for Swift; ignoring it")
+        self.swift_generator = SwiftGenerator(config=self.config)
+        self.c_wrapper_generator = CWrapperGenerator(config=self.config)
 
     def generate_project(
         self, idl_file: IDLFile, output_dir: Path, project_name: str | None = None
@@ -486,7 +490,7 @@ Note: Ensure you've built the C libraries first using ../build_c.sh
 """
 
     def _write_file(self, path: Path, content: str) -> Path:
-        """Write content to file.
+        """Write content to file, unless it already has that content.
 
         Args:
             path: File path
@@ -495,7 +499,6 @@ Note: Ensure you've built the C libraries first using ../build_c.sh
         Returns:
             Path to written file
         """
-        path.parent.mkdir(parents=True, exist_ok=True)
-        path.write_text(content)
-        logger.debug(f"Wrote {path}")
+        if write_if_changed(path, content):
+            logger.debug(f"Wrote {path}")
         return path
\ No newline at end of file
@@ -11,6 +11,7 @@ from minimidl.ast.nodes import (
     DictType,
     Enum,
     EnumValue,
+    FixedStringType,
     ForwardDeclaration,
     IdentifierExpression,
     Interface,
@@ -22,6 +23,7 @@ from minimidl.ast.nodes import (
     PrimitiveType,
     Property,
     SetType,
+    StreamType,
     Typedef,
     TypeRef,
 )
@@ -75,6 +77,131 @@ class TestASTTransformation:
         assert clear_method.return_type.name == "void"
         assert len(clear_method.parameters) == 0
 
+    def test_noexcept_methods(self) -> None:
+        """Test noexcept method transformation."""
+        idl = """
+        namespace Test {
+            interface ICalculator {
+                double Add(double a, double b) noexcept;
+                void Clear() noexcept;
+                double Divide(double a, double b);
+            }
+        }
+        """
+        ast = parse_idl(idl)
+
+        add_method, clear_method, divide_method = ast.namespaces[0].interfaces[0].methods
+        assert add_method.noexcept
+        assert len(add_method.parameters) == 2
+        assert clear_method.noexcept
+        assert len(clear_method.parameters) == 0
+        assert not divide_method.noexcept
+
+    def test_async_methods(self) -> None:
+        """Test async method transformation."""
+        idl = """
+        namespace Test {
+            interface IStore {
+                async void Save(string_t path);
+                async int32_t Count();
+                void Clear();
+            }
+        }
+        """
+        ast = parse_idl(idl)
+
+        save_method, count_method, clear_method = ast.namespaces[0].interfaces[0].methods
+        assert save_method.is_async
+        assert save_method.name == "Save"
+        assert len(save_method.parameters) == 1
+        assert count_method.is_async
+        assert count_method.return_type.name == "int32_t"
+        assert not clear_method.is_async
+
+    def test_stream_type(self) -> None:
+        """Test stream return type transformation."""
+        idl = """
+        namespace Test {
+            interface ITask {}
+            interface IProject {
+                stream<ITask> GetTasks();
+            }
+        }
+        """
+        ast = parse_idl(idl)
+
+        method = ast.namespaces[0].interfaces[1].methods[0]
+        assert isinstance(method.return_type, StreamType)
+        assert isinstance(method.return_type.element_type, TypeRef)
+        assert method.return_type.element_type.name == "ITask"
+
+    def test_interface_attributes(self) -> None:
+        """Test interface attribute transformation."""
+        idl = """
+        namespace Test {
+            [sealed]
+            interface ICounter {
+                int32_t value;
+            }
+
+            interface IPlain {
+                int32_t value;
+            }
+        }
+        """
+        ast = parse_idl(idl)
+
+        sealed, plain = ast.namespaces[0].interfaces
+        assert sealed.name == "ICounter"
+        assert sealed.attributes == ["sealed"]
+        assert len(sealed.properties) == 1
+        assert plain.attributes == []
+
+    def test_property_attributes(self) -> None:
+        """Test property attribute transformation."""
+        idl = """
+        namespace Test {
+            [threadsafe]
+            interface ITask {
+                [immutable] string_t id;
+                [readmostly] string_t title writable;
+                int32_t hits;
+            }
+        }
+        """
+        ast = parse_idl(idl)
+
+        task = ast.namespaces[0].interfaces[0]
+        assert task.attributes == ["threadsafe"]
+        id_prop, title_prop, hits_prop = task.properties
+        assert id_prop.attributes == ["immutable"]
+        assert title_prop.attributes == ["readmostly"]
+        assert title_prop.writable
+        assert hits_prop.attributes == []
+
+    def test_struct_declaration(self) -> None:
+        """Test struct declaration transformation."""
+        idl = """
+        namespace Test {
+            enum Priority : int32_t { LOW = 0, HIGH = 1 }
+
+            struct Summary {
+                Priority priority;
+                bool done;
+                string_t<64> title;
+            }
+        }
+        """
+        ast = parse_idl(idl)
+
+        struct = ast.namespaces[0].structs[0]
+        assert struct.name == "Summary"
+        assert [field.name for field in struct.fields] == ["priority", "done", "title"]
+        assert isinstance(struct.fields[0].type, TypeRef)
+        assert struct.fields[1].type == PrimitiveType(name="bool")
+        assert isinstance(struct.fields[2].type, FixedStringType)
+        assert struct.fields[2].type.capacity == 64
+
     def test_interface_with_properties(self) -> None:
         """Test interface with properties transformation."""
         idl = """
@@ -0,0 +1,216 @@
+"""Tests for the micro-benchmark generator."""
+
+import pytest
+
+from minimidl.ast.nodes import (
+    ArrayType,
+    DictType,
+    IDLFile,
+    Interface,
+    Method,
+    Namespace,
+    NullableType,
+    Parameter,
+    PrimitiveType,
+    Property,
+    SetType,
+    TypeRef,
+)
+from minimidl.generators.benchmark import BenchmarkGenerator
+
+
+def _namespace():
+    """Build a namespace with two interfaces, one of which hands out the other."""
+    task = TypeRef(name="ITask")
+    return Namespace(
+        name="Example",
+        interfaces=[
+            Interface(
+                name="ITask",
+                properties=[
+                    Property(name="title", type=PrimitiveType(name="string_t"), writable=True),
+                    Property(name="tags", type=ArrayType(element_type=PrimitiveType(name="string_t"))),
+                    Property(name="parent", type=NullableType(inner_type=task), writable=True),
+                ],
+                methods=[
+                    Method(name="Touch", return_type=PrimitiveType(name="void")),
+                    Method(
+                        name="Later",
+                        return_type=PrimitiveType(name="int32_t"),
+                        parameters=[Parameter(name="delay", type=PrimitiveType(name="int32_t"))],
+                        is_async=True,
+                    ),
+                ],
+            ),
+            Interface(
+                name="IFactory",
+                properties=[Property(name="last", type=task, writable=True)],
+                methods=[
+                    Method(name="Make", return_type=task),
+                    Method(name="MakeAll", return_type=ArrayType(element_type=task)),
+                    Method(
+                        name="Adopt",
+                        return_type=PrimitiveType(name="void"),
+                        parameters=[Parameter(name="task", type=task)],
+                    ),
+                ],
+            ),
+        ],
+    )
+
+
+class TestBenchmarkCases:
+    """Test what each benchmark calls."""
+
+    @pytest.fixture
+    def generator(self):
+        """Create a benchmark generator that has seen the example namespace."""
+        generator = BenchmarkGenerator()
+        generator.current_namespace = "Example"
+        generator.interface_names = {"ITask", "IFactory"}
+        generator.bench_names = {"ITask"}
+        return generator
+
+    def test_cases(self, generator):
+        """Test plain values and collections are timed in C and the rest only in C++."""
+        cases = {case.name: case for case in generator.bench_cases(_namespace().interfaces[0])}
+        assert cases["ITask_get_title"].c_call == [
+            "auto result = ITask_Gettitle(handle);",
+            "IDynamicString_Release(result);",
+        ]
+        assert cases["ITask_set_title"].setup == ["const std::string value{kText};"]
+        assert cases["ITask_set_title"].c_setup == [
+            "IDynamicString_Handle value = IDynamicString_Create(kText);"
+        ]
+        assert cases["ITask_set_parent"].call == "object->set_parent(objects().ITaskObject);"
+        assert cases["ITask_get_tags"].c_setup == ["IDynamicString_Handle items[3];"]
+        assert cases["ITask_get_tags"].c_call == [
+            "const size_t total = ITask_Gettags_GetAll(handle, items, 3);",
+            "for (size_t i = 0; i < total && i < 3; ++i) { IDynamicString_Release(items[i]); }",
+        ]
+        assert cases["ITask_Touch"].c_call == ["ITask_Touch(handle);"]
+        assert cases["ITask_Later"].call == "benchmark::DoNotOptimize(object->Later(delay).get());"
+        assert cases["ITask_Later"].c_call == []
+
+    def test_objects(self, generator):
+        """Test setters keep the shared object while methods borrow it."""
+        generator.bench_names = {"ITask", "IFactory"}
+        cases = {case.name: case for case in generator.bench_cases(_namespace().interfaces[1])}
+        assert cases["IFactory_set_last"].call == "object->set_last(objects().ITaskObject);"
+        assert cases["IFactory_Adopt"].call == "object->Adopt(*objects().ITaskObject);"
+        assert cases["IFactory_Make"].c_call == [
+            "auto result = IFactory_Make(handle);",
+            "if (result) { ITask_Release(result); }",
+        ]
+
+    def test_collections(self, generator):
+        """Test collection arguments are built once and returned handles released."""
+        string = PrimitiveType(name="string_t")
+        number = PrimitiveType(name="int32_t")
+        interface = Interface(
+            name="ITask",
+            properties=[
+                Property(name="counts", type=ArrayType(element_type=number), writable=True),
+                Property(name="labels", type=SetType(element_type=string), writable=True),
+            ],
+            methods=[
+                Method(
+                    name="Index",
+                    return_type=DictType(key_type=string, value_type=number),
+                    parameters=[
+                        Parameter(name="keys", type=DictType(key_type=number, value_type=string))
+                    ],
+                ),
+            ],
+        )
+        cases = {case.name: case for case in generator.bench_cases(interface)}
+        assert cases["ITask_get_counts"].c_call == [
+            "const size_t total = ITask_Getcounts_GetAll(handle, items, 3);",
+            "benchmark::DoNotOptimize(total);",
+        ]
+        assert cases["ITask_set_counts"].setup == ["const std::vector<int32_t> value{{}, {}, {}};"]
+        assert cases["ITask_set_counts"].c_setup == ["const int32_t items[3]{};"]
+        assert cases["ITask_set_counts"].c_call == ["ITask_Setcounts_SetAll(handle, items, 3);"]
+        assert cases["ITask_get_labels"].c_call == [
+            "auto result = ITask_Getlabels_Iterator(handle);",
+            "ExampleSet_Release(result);",
+        ]
+        assert cases["ITask_set_labels"].c_setup == [
+            "const Example_StringView valueItems[3] = {kTextView, kTextView, kTextView};",
+            "ExampleSet_Handle value = ExampleSet_CreateStrings(valueItems, 3);",
+        ]
+        assert cases["ITask_set_labels"].c_cleanup == ["ExampleSet_Release(value);"]
+
+        index = cases["ITask_Index"]
+        assert index.c_setup == [
+            "const int32_t keysKeysItems[3]{};",
+            "ExampleArray_Handle keysKeys = "
+            "ExampleArray_CreateValues(keysKeysItems, 3, sizeof(keysKeysItems[0]));",
+            "const Example_StringView keysValuesItems[3] = {kTextView, kTextView, kTextView};",
+            "ExampleArray_Handle keysValues = ExampleArray_CreateStrings(keysValuesItems, 3);",
+            "ExampleDict_Handle keys = ExampleDict_CreateFromArrays(keysKeys, keysValues);",
+        ]
+        assert index.c_call == [
+            "auto result = ITask_Index(handle, keys);",
+            "ExampleDict_Release(result);",
+        ]
+        assert index.c_cleanup == [
+            "ExampleDict_Release(keys);",
+            "ExampleArray_Release(keysValues);",
+            "ExampleArray_Release(keysKeys);",
+        ]
+
+    def test_status_codes(self):
+        """Test results come through out parameters with status codes."""
+        generator = BenchmarkGenerator(config={"status_codes": True})
+        generator.interface_names = {"ITask"}
+        generator.bench_names = {"ITask"}
+        case = generator.bench_cases(_namespace().interfaces[0])[0]
+        assert case.c_call == [
+            "IDynamicString_Handle result{};",
+            "benchmark::DoNotOptimize(ITask_Gettitle(handle, &result));",
+            "IDynamicString_Release(result);",
+        ]
+
+    def test_pmr_getters(self):
+        """Test pmr getters copy strings and collections onto the current resource."""
+        generator = BenchmarkGenerator(config={"pmr": True})
+        generator.interface_names = {"ITask"}
+        members = {m.declaration: m.body for m in generator.bench_members(_namespace().interfaces[0])}
+        assert members["std::pmr::string get_title() const"] == (
+            "return {m_title, minimidl::current_resource()};"
+        )
+        assert members["std::pmr::vector<std::pmr::string> get_tags() const"] == (
+            "return {m_tags, minimidl::current_resource()};"
+        )
+        assert members["minimidl::object_ptr<ITask> get_parent() const"] == "return m_parent;"
+
+
+class TestBenchmarkGeneration:
+    """Test full benchmark source generation."""
+
+    def test_benchmarks(self, tmp_path):
+        """Test implementations, fixtures and benchmark registrations."""
+        files = BenchmarkGenerator().generate(IDLFile(namespaces=[_namespace()]), tmp_path)
+        assert [f.name for f in files] == ["ExampleBenchmarks.cpp"]
+        content = files[0].read_text()
+
+        assert "#include <benchmark/benchmark.h>" in content
+        assert '#ifdef EXAMPLE_BENCHMARK_C_WRAPPER\n#include "example_wrapper.h"' in content
+        assert "class ITaskBench final : public ITask {" in content
+        assert "    std::string m_title{kText};" in content
+        assert "void set_title(const std::string& value) override { m_title = value; }" in content
+        assert "minimidl::object_ptr<ITask> ITaskObject = minimidl::make_object<ITaskBench>();" in (
+            content
+        )
+        assert "BENCHMARK(BM_ITask_get_title_Cpp);" in content
+        assert "BENCHMARK(BM_ITask_get_title_C);" in content
+        assert "    std::vector<std::string> m_tags{{kText}, {kText}, {kText}};" in content
+        assert "BENCHMARK(BM_ITask_get_tags_C);" in content
+        assert "BENCHMARK(BM_ITask_Later_C);" not in content
+        assert "const Example_StringView kTextView = {kText, std::strlen(kText)};" in content
+        assert "class IFactoryBench final : public IFactory {" in content
+        assert "minimidl::object_ptr<ITask> Make() override { return {}; }" in content
+        assert (
+            "std::vector<minimidl::object_ptr<ITask>> MakeAll() override { return {}; }" in content
+        )
@@ -9,6 +9,8 @@ from minimidl.ast.nodes import (
     DictType,
     Enum,
     EnumValue,
+    Event,
+    FixedStringType,
     IDLFile,
     Interface,
     LiteralExpression,
@@ -19,6 +21,9 @@ from minimidl.ast.nodes import (
     PrimitiveType,
     Property,
     SetType,
+    StreamType,
+    Struct,
+    StructField,
     TypeRef,
 )
 from minimidl.generators.c_wrapper import CWrapperGenerator
@@ -192,6 +197,9 @@ class TestCWrapperGeneration:
         # Check implementation file
         impl_file = tmp_path / "example_wrapper.cpp"
         assert impl_file.exists()
+        impl_content = impl_file.read_text()
+        assert "HandleToPtr<Example::ISimple>(handle)->Release();" in impl_content
+        assert "HandleToPtr<Example::ISimple>(handle)->AddRef();" in impl_content
 
         # Check exports file
         exports_file = tmp_path / "example_exports.def"
@@ -239,6 +247,59 @@ class TestCWrapperGeneration:
         assert "#define Status_OK 0" in content
         assert "#define Status_ERROR 1" in content
 
+    def test_enum_conversions(self, tmp_path):
+        """Test enum name lookups and the range check on values passed in."""
+        status = TypeRef(name="Status")
+        namespace = Namespace(
+            name="Example",
+            interfaces=[
+                Interface(
+                    name="ITask",
+                    properties=[Property(name="status", type=status, writable=True)],
+                    methods=[
+                        Method(
+                            name="Advance",
+                            return_type=status,
+                            parameters=[Parameter(name="to", type=status)],
+                        )
+                    ],
+                )
+            ],
+            enums=[
+                Enum(
+                    name="Status",
+                    backing_type="int32_t",
+                    values=[
+                        EnumValue(name="OK", value=LiteralExpression(value=0)),
+                        EnumValue(name="ERROR", value=LiteralExpression(value=1)),
+                    ],
+                )
+            ],
+        )
+
+        CWrapperGenerator(config={"status_codes": True}).generate(
+            IDLFile(namespaces=[namespace]), tmp_path
+        )
+        header = (tmp_path / "example_wrapper.h").read_text()
+        impl = (tmp_path / "example_wrapper.cpp").read_text()
+        exports = (tmp_path / "example_exports.def").read_text()
+
+        assert "EXAMPLE_ERROR_INVALID_ARGUMENT = -7," in header
+        assert "EXAMPLE_API const char* Status_ToString(Status value);" in header
+        assert "EXAMPLE_API bool Status_FromString(const char* name, Status* out_value);" in header
+        assert "EXAMPLE_API bool Status_IsValid(Status value);" in header
+        assert "auto name = minimidl::enum_name(static_cast<Example::Status>(value));" in impl
+        assert "auto value = minimidl::enum_from_name<Example::Status>(name);" in impl
+        assert (
+            "    if (!minimidl::enum_is_valid<Example::Status>(value)) {\n"
+            '        SetError("Invalid Status value");\n'
+            "        return EXAMPLE_ERROR_INVALID_ARGUMENT;"
+        ) in impl
+        assert "if (!minimidl::enum_is_valid<Example::Status>(to)) {" in impl
+        assert "if (!minimidl::enum_is_valid<Example::Status>(values[done])) {" in impl
+        assert "if (!minimidl::enum_is_valid<Example::Status>(to[done])) {" in impl
+        assert "    Status_IsValid" in exports
+
     def test_array_property(self, generator, tmp_path):
         """Test array property handling."""
         namespace = Namespace(
@@ -280,6 +341,55 @@ class TestCWrapperGeneration:
             in content
         )
 
+    def test_array_bulk_accessors(self, generator, tmp_path):
+        """Test whole-array getters and setters."""
+        namespace = Namespace(
+            name="Example",
+            interfaces=[
+                Interface(
+                    name="IContainer",
+                    methods=[],
+                    properties=[
+                        Property(
+                            name="items",
+                            type=ArrayType(element_type=PrimitiveType(name="string_t")),
+                            writable=True,
+                        ),
+                        Property(
+                            name="ids",
+                            type=ArrayType(element_type=PrimitiveType(name="int32_t")),
+                        ),
+                    ],
+                )
+            ],
+        )
+
+        generator.generate(IDLFile(namespaces=[namespace]), tmp_path)
+        header = (tmp_path / "example_wrapper.h").read_text()
+        impl = (tmp_path / "example_wrapper.cpp").read_text()
+
+        assert (
+            "size_t IContainer_Getitems_GetAll(IContainer_Handle handle, IDynamicString_Handle* items, size_t capacity);"
+            in header
+        )
+        assert (
+            "void IContainer_Setitems_SetAll(IContainer_Handle handle, const Example_StringView* items, size_t count);"
+            in header
+        )
+        assert (
+            "size_t IContainer_Getids_GetAll(IContainer_Handle handle, int32_t* items, size_t capacity);"
+            in header
+        )
+        # Read-only arrays get no setter
+        assert "IContainer_Setids_SetAll" not in header
+
+        # One property copy per call
+        assert "std::copy(array.begin(), array.begin() + n, items);" in impl
+        # Strings copied before a failure are released, as the caller gets none
+        assert "        for (; copied < n; ++copied) {\n" in impl
+        assert "    } catch (const std::bad_alloc&) {\n        ReleaseStrings(items, copied);\n" in impl
+        assert "IContainer_Getids_GetAll" in (tmp_path / "example_exports.def").read_text()
+
     def test_error_handling(self, generator, tmp_path):
         """Test error handling functions."""
         namespace = Namespace(
@@ -329,3 +439,846 @@ class TestCWrapperGeneration:
         assert "__declspec(dllimport)" in content
         assert '__attribute__((visibility("default")))' in content
         assert "EXAMPLE_API" in content
+
+    def test_string_view_getters(self, tmp_path):
+        """Test borrowed string view getters."""
+        namespace = Namespace(
+            name="Example",
+            interfaces=[
+                Interface(
+                    name="IConfig",
+                    properties=[
+                        Property(name="name", type=PrimitiveType(name="string_t")),
+                    ],
+                )
+            ],
+        )
+        idl_file = IDLFile(namespaces=[namespace])
+
+        # Without the option only the view type is declared
+        CWrapperGenerator().generate(idl_file, tmp_path)
+        content = (tmp_path / "example_wrapper.h").read_text()
+        assert "} Example_StringView;" in content
+        assert "IConfig_Getname_View" not in content
+
+        CWrapperGenerator(config={"string_views": True}).generate(idl_file, tmp_path)
+        header = (tmp_path / "example_wrapper.h").read_text()
+        impl = (tmp_path / "example_wrapper.cpp").read_text()
+        exports = (tmp_path / "example_exports.def").read_text()
+
+        assert (
+            "Example_StringView IConfig_Getname_View(IConfig_Handle handle);" in header
+        )
+        assert "return {result.data(), result.size()};" in impl
+        assert "IConfig_Getname_View" in exports
+
+    def test_string_view_setters(self, tmp_path):
+        """Test writable strings can be set from views and are read back whole."""
+        namespace = Namespace(
+            name="Example",
+            interfaces=[
+                Interface(
+                    name="IConfig",
+                    properties=[
+                        Property(name="name", type=PrimitiveType(name="string_t"), writable=True),
+                        Property(
+                            name="nick",
+                            type=NullableType(inner_type=PrimitiveType(name="string_t")),
+                            writable=True,
+                        ),
+                    ],
+                )
+            ],
+        )
+
+        CWrapperGenerator().generate(IDLFile(namespaces=[namespace]), tmp_path)
+        header = (tmp_path / "example_wrapper.h").read_text()
+        impl = (tmp_path / "example_wrapper.cpp").read_text()
+        exports = (tmp_path / "example_exports.def").read_text()
+
+        assert "void IConfig_Setname_View(IConfig_Handle handle, Example_StringView value);" in header
+        assert "IConfig_Setnick_View" not in header
+        assert "obj->set_name(Value(value.length ? value.data : \"\", value.length));" in impl
+        assert "IDynamicString* str = CreateDynamicString(result);" in impl
+        assert "IConfig_Setname_View" in exports
+
+    def test_pooled_allocator(self, tmp_path):
+        """Test the pooled allocator runtime and statistics API."""
+        namespace = Namespace(name="Example")
+        idl_file = IDLFile(namespaces=[namespace])
+
+        CWrapperGenerator().generate(idl_file, tmp_path)
+        assert "PoolAllocated" not in (tmp_path / "example_wrapper.cpp").read_text()
+        assert "Example_GetPoolStats" not in (tmp_path / "example_wrapper.h").read_text()
+
+        CWrapperGenerator(config={"pooled_allocator": True}).generate(idl_file, tmp_path)
+        header = (tmp_path / "example_wrapper.h").read_text()
+        impl = (tmp_path / "example_wrapper.cpp").read_text()
+
+        assert "} Example_PoolStats;" in header
+        assert "void Example_GetPoolStats(Example_PoolStats* stats);" in header
+        assert "class DynamicString : public RefCounted<IDynamicString>, public PoolAllocated" in impl
+        assert "pool::Allocate(bytes)" in impl
+        assert "thread_local ThreadCache cache;" in impl
+        assert "Example_GetPoolStats" in (tmp_path / "example_exports.def").read_text()
+
+    def test_instrumentation(self, tmp_path):
+        """Test call instrumentation scopes and the statistics API."""
+        namespace = Namespace(
+            name="Example",
+            interfaces=[
+                Interface(
+                    name="ITask",
+                    properties=[
+                        Property(name="title", type=PrimitiveType(name="string_t"), writable=True)
+                    ],
+                )
+            ],
+        )
+        idl_file = IDLFile(namespaces=[namespace])
+
+        CWrapperGenerator().generate(idl_file, tmp_path)
+        assert "instrument::" not in (tmp_path / "example_wrapper.cpp").read_text()
+        assert "Example_GetStats" not in (tmp_path / "example_wrapper.h").read_text()
+
+        CWrapperGenerator(config={"instrument": True}).generate(idl_file, tmp_path)
+        header = (tmp_path / "example_wrapper.h").read_text()
+        impl = (tmp_path / "example_wrapper.cpp").read_text()
+
+        assert "} Example_CallStats;" in header
+        assert "size_t Example_GetStats(Example_CallStats* stats, size_t capacity);" in header
+        assert "void Example_ResetStats();" in header
+        assert (
+            "IDynamicString_Handle ITask_Gettitle(ITask_Handle handle) {\n"
+            "    static const instrument::Site callSite(__func__);\n"
+            "    instrument::CallScope callScope(callSite);\n"
+            "    EXAMPLE_TRACE_ZONE();\n"
+        ) in impl
+        assert "obj->set_title(instrument::ReadString(str));" in impl
+        assert "#define EXAMPLE_TRACE_ZONE() ZoneScoped" in impl
+        assert "thread_local ThreadStats stats;" in impl
+        # Registration failures leave the scope inactive instead of escaping noexcept
+        assert (
+            "    explicit CallScope(const Site& site) noexcept"
+            " : m_previous(t_current), m_counters(nullptr) {\n"
+            "        if (site.index() != kNoSite) {\n"
+            "            try {\n"
+        ) in impl
+        assert "Example_ResetStats" in (tmp_path / "example_exports.def").read_text()
+
+    def test_collection_marshalling(self, tmp_path):
+        """Test collection returns, parameters and the bulk accessor API."""
+        string_t = PrimitiveType(name="string_t")
+        int32_t = PrimitiveType(name="int32_t")
+        namespace = Namespace(
+            name="Example",
+            interfaces=[
+                Interface(
+                    name="IStore",
+                    properties=[
+                        Property(name="labels", type=SetType(element_type=string_t)),
+                    ],
+                    methods=[
+                        Method(
+                            name="GetCounts",
+                            return_type=DictType(key_type=string_t, value_type=int32_t),
+                            parameters=[],
+                        ),
+                        Method(
+                            name="SetNames",
+                            return_type=PrimitiveType(name="void"),
+                            parameters=[
+                                Parameter(name="names", type=ArrayType(element_type=string_t))
+                            ],
+                        ),
+                    ],
+                )
+            ],
+        )
+        idl_file = IDLFile(namespaces=[namespace])
+
+        generator = CWrapperGenerator()
+        generator.generate(idl_file, tmp_path)
+        header = (tmp_path / "example_wrapper.h").read_text()
+        impl = (tmp_path / "example_wrapper.cpp").read_text()
+        exports = (tmp_path / "example_exports.def").read_text()
+
+        assert generator.c_element_type(string_t) == "Example_StringView"
+        assert generator.c_element_type(int32_t) == "int32_t"
+
+        # Element layout is documented next to each collection
+        assert "// Returns Example_StringView -> int32_t; release with ExampleDict_Release" in header
+        assert "// names: Example_StringView, NULL for empty" in header
+        assert "// Set of Example_StringView" in header
+
+        # Bulk accessors and builders
+        assert (
+            "size_t ExampleArray_GetItems(ExampleArray_Handle handle, size_t start, size_t count, void* items);"
+            in header
+        )
+        assert "bool ExampleDict_Next(ExampleDict_Handle handle, const void** key, const void** value);" in header
+        assert "ExampleDict_Handle ExampleDict_CreateFromArrays(" in header
+        for name in ["ExampleArray_GetItems", "ExampleDict_GetValues", "ExampleSet_CreateStrings"]:
+            assert name in exports
+
+        # Results are materialised into one buffer, arguments read back from one
+        assert "return PtrToHandle(marshal::MarshalDict(result));" in impl
+        assert "marshal::CollectionArg{names}" in impl
+        assert "ExampleSet_Handle IStore_Getlabels_Iterator(IStore_Handle handle) {" in impl
+        assert "ArrayIterator" not in impl
+
+    def test_status_codes(self, tmp_path):
+        """Test status-code entry points and the allocation-free error buffer."""
+        namespace = Namespace(
+            name="Example",
+            interfaces=[
+                Interface(
+                    name="ICounter",
+                    properties=[
+                        Property(name="value", type=PrimitiveType(name="int32_t"), writable=True),
+                    ],
+                    methods=[
+                        Method(name="Reset", return_type=PrimitiveType(name="void")),
+                        Method(name="Describe", return_type=PrimitiveType(name="string_t")),
+                    ],
+                )
+            ],
+        )
+        idl_file = IDLFile(namespaces=[namespace])
+
+        CWrapperGenerator().generate(idl_file, tmp_path)
+        header = (tmp_path / "example_wrapper.h").read_text()
+        impl = (tmp_path / "example_wrapper.cpp").read_text()
+        assert "EXAMPLE_ERROR_EXCEPTION = -6," in header
+        assert "int32_t ICounter_Getvalue(ICounter_Handle handle);" in header
+        assert "thread_local char g_lastError[kErrorBufferSize];" in impl
+        assert "std::string g_lastError" not in impl
+        # Nothing unwinds into the C caller
+        getter = impl.split("int32_t ICounter_Getvalue(ICounter_Handle handle) {")[1].split("\n}\n")[0]
+        assert (
+            "    } catch (const std::bad_alloc&) {\n"
+            "        SetError(\"Out of memory\");\n"
+            "        return {};\n"
+            "    } catch (const std::exception& e) {\n"
+            "        SetError(e.what());\n"
+            "        return {};\n"
+            "    } catch (...) {\n"
+            "        SetError(\"Unknown exception\");\n"
+            "        return {};\n"
+            "    }"
+        ) in getter
+        assert "throw std::bad_array_new_length();" in impl
+
+        CWrapperGenerator(config={"status_codes": True}).generate(idl_file, tmp_path)
+        header = (tmp_path / "example_wrapper.h").read_text()
+        impl = (tmp_path / "example_wrapper.cpp").read_text()
+
+        assert "Example_ErrorCode ICounter_Getvalue(ICounter_Handle handle, int32_t* out_value);" in header
+        assert "Example_ErrorCode ICounter_Setvalue(ICounter_Handle handle, int32_t value);" in header
+        assert "Example_ErrorCode ICounter_Reset(\n    ICounter_Handle handle);" in header
+        assert "ICounter_Handle handle, IDynamicString_Handle* out_result);" in header
+        # Lifetime and string helpers keep their plain signatures
+        assert "void ICounter_Release(ICounter_Handle handle);" in header
+        assert "const char* IDynamicString_GetValue(IDynamicString_Handle handle);" in header
+
+        assert "*out_value = obj->get_value();" in impl
+        assert "return EXAMPLE_ERROR_EXCEPTION;" in impl
+        assert "SetError(\"Null output\");" in impl
+        setter = impl.split("Example_ErrorCode ICounter_Setvalue(ICounter_Handle handle, int32_t value) {")[1]
+        setter = setter.split("\n}\n")[0]
+        assert (
+            "    } catch (const std::bad_alloc&) {\n"
+            "        SetError(\"Out of memory\");\n"
+            "        return EXAMPLE_ERROR_OUT_OF_MEMORY;\n"
+        ) in setter
+        assert (
+            "    } catch (...) {\n"
+            "        SetError(\"Unknown exception\");\n"
+            "        return EXAMPLE_ERROR_EXCEPTION;\n"
+            "    }\n"
+            "    return EXAMPLE_OK;"
+        ) in setter
+
+    def test_noexcept_methods(self, generator, tmp_path):
+        """Test that noexcept methods with plain conversions skip the handler."""
+        namespace = Namespace(
+            name="Example",
+            interfaces=[
+                Interface(
+                    name="ICalc",
+                    methods=[
+                        Method(
+                            name="Add",
+                            return_type=PrimitiveType(name="int32_t"),
+                            parameters=[Parameter(name="a", type=PrimitiveType(name="int32_t"))],
+                            noexcept=True,
+                        ),
+                        Method(
+                            name="Describe",
+                            return_type=PrimitiveType(name="string_t"),
+                            noexcept=True,
+                        ),
+                    ],
+                )
+            ],
+        )
+        add, describe = namespace.interfaces[0].methods
+        assert not generator.needs_try(add)
+        # Building the string handle can still throw
+        assert generator.needs_try(describe)
+
+        generator.generate(IDLFile(namespaces=[namespace]), tmp_path)
+        impl = (tmp_path / "example_wrapper.cpp").read_text()
+        add_body = impl.split("// Method: Add")[1].split("// Method: Describe")[0]
+        assert "try {" not in add_body
+        assert "return obj->Add(a);" not in add_body
+        assert "auto result = obj->Add(a);" in add_body
+        assert "try {" in impl.split("// Method: Describe")[1]
+
+    def test_struct_types(self, generator, tmp_path):
+        """Test structs shared with C by layout and passed by value."""
+        namespace = Namespace(
+            name="Example",
+            structs=[
+                Struct(
+                    name="Summary",
+                    fields=[
+                        StructField(name="count", type=PrimitiveType(name="int32_t")),
+                        StructField(name="title", type=FixedStringType(capacity=64)),
+                    ],
+                )
+            ],
+            interfaces=[
+                Interface(
+                    name="IProject",
+                    properties=[
+                        Property(name="current", type=TypeRef(name="Summary"), writable=True)
+                    ],
+                    methods=[
+                        Method(
+                            name="GetSummaries",
+                            return_type=ArrayType(element_type=TypeRef(name="Summary")),
+                        ),
+                        Method(
+                            name="Add",
+                            return_type=PrimitiveType(name="void"),
+                            parameters=[Parameter(name="item", type=TypeRef(name="Summary"))],
+                        ),
+                    ],
+                )
+            ],
+        )
+
+        files = generator.generate(IDLFile(namespaces=[namespace]), tmp_path)
+        header = next(f for f in files if f.suffix == ".h").read_text()
+        impl = next(f for f in files if f.name.endswith("_wrapper.cpp")).read_text()
+
+        assert "typedef struct Summary {\n    int32_t count;\n    char title[64];\n} Summary;" in header
+        assert "EXAMPLE_API Summary IProject_Getcurrent(IProject_Handle handle);" in header
+        assert "EXAMPLE_API void IProject_Setcurrent(IProject_Handle handle, Summary value);" in header
+        assert "EXAMPLE_API ExampleArray_Handle IProject_GetSummaries(" in header
+        assert "Summary item)" in header
+
+        assert "static_assert(sizeof(Summary) == sizeof(Example::Summary)" in impl
+        assert "offsetof(Summary, title) == offsetof(Example::Summary, title)" in impl
+        assert "StructCast<Example::Summary>(item)" in impl
+        assert "StructCast<Summary>(" in impl
+
+    def test_interface_snapshot(self, generator, tmp_path):
+        """Test the one-call property snapshot."""
+        namespace = Namespace(
+            name="Example",
+            enums=[
+                Enum(
+                    name="Status",
+                    backing_type="int32_t",
+                    values=[EnumValue(name="OK", value=LiteralExpression(value=0))],
+                )
+            ],
+            interfaces=[
+                Interface(
+                    name="ITask",
+                    properties=[
+                        Property(name="title", type=PrimitiveType(name="string_t")),
+                        Property(name="note", type=PrimitiveType(name="string_t"), writable=True),
+                        Property(name="status", type=TypeRef(name="Status")),
+                        Property(
+                            name="tags", type=ArrayType(element_type=PrimitiveType(name="string_t"))
+                        ),
+                        Property(
+                            name="parent", type=NullableType(inner_type=TypeRef(name="ITask"))
+                        ),
+                        Property(
+                            name="score", type=NullableType(inner_type=PrimitiveType(name="double"))
+                        ),
+                    ],
+                ),
+                Interface(name="IEmpty"),
+            ],
+        )
+
+        generator.generate(IDLFile(namespaces=[namespace]), tmp_path)
+        header = (tmp_path / "example_wrapper.h").read_text()
+        impl = (tmp_path / "example_wrapper.cpp").read_text()
+
+        assert (
+            "typedef struct ITask_Snapshot_t {\n"
+            "    Example_StringView title;\n"
+            "    Example_StringView note;\n"
+            "    Status status;\n"
+            "    ExampleArray_Handle tags;\n"
+            "    ITask_Handle parent;\n"
+            "    void* _storage;\n"
+            "} ITask_Snapshot_t;"
+        ) in header
+        assert "EXAMPLE_API bool ITask_Snapshot(ITask_Handle handle, ITask_Snapshot_t* out);" in header
+        assert "EXAMPLE_API void ITask_Snapshot_Release(ITask_Snapshot_t* snapshot);" in header
+        assert "IEmpty_Snapshot" not in header
+
+        # Both strings are copied into one allocation
+        assert "::operator new(titleValue.size() + 1 + noteValue.size() + 1)" in impl
+        assert "snapshot.status = static_cast<Status>(obj->get_status());" in impl
+        assert "ExampleArray_Release(snapshot->tags);" in impl
+        assert "HandleToPtr<Example::ITask>(snapshot->parent)->Release();" in impl
+        assert "snapshot->status" not in impl
+        assert "ITask_Snapshot_Release(&snapshot);" in impl
+
+        exports = (tmp_path / "example_exports.def").read_text()
+        assert "ITask_Snapshot_Release" in exports
+
+    def test_batch_calls(self, generator, tmp_path):
+        """Test _Batch variants over handle arrays."""
+        namespace = Namespace(
+            name="Example",
+            enums=[
+                Enum(
+                    name="Status",
+                    backing_type="int32_t",
+                    values=[EnumValue(name="OK", value=LiteralExpression(value=0))],
+                )
+            ],
+            interfaces=[
+                Interface(
+                    name="ITask",
+                    properties=[
+                        Property(name="status", type=TypeRef(name="Status"), writable=True),
+                        Property(name="title", type=PrimitiveType(name="string_t")),
+                        Property(
+                            name="score", type=NullableType(inner_type=PrimitiveType(name="double"))
+                        ),
+                    ],
+                    methods=[
+                        Method(name="Complete", return_type=PrimitiveType(name="void")),
+                        Method(
+                            name="Scale",
+                            return_type=PrimitiveType(name="double"),
+                            parameters=[
+                                Parameter(name="factor", type=PrimitiveType(name="double"))
+                            ],
+                        ),
+                        Method(
+                            name="Move",
+                            return_type=PrimitiveType(name="void"),
+                            parameters=[
+                                Parameter(name="x", type=PrimitiveType(name="int32_t")),
+                                Parameter(name="y", type=PrimitiveType(name="int32_t")),
+                            ],
+                        ),
+                        Method(
+                            name="Rename",
+                            return_type=PrimitiveType(name="void"),
+                            parameters=[
+                                Parameter(name="title", type=PrimitiveType(name="string_t"))
+                            ],
+                        ),
+                    ],
+                )
+            ],
+        )
+
+        generator.generate(IDLFile(namespaces=[namespace]), tmp_path)
+        header = (tmp_path / "example_wrapper.h").read_text()
+        impl = (tmp_path / "example_wrapper.cpp").read_text()
+
+        assert (
+            "EXAMPLE_API size_t ITask_Getstatus_Batch("
+            "const ITask_Handle* handles, size_t count, Status* values);"
+        ) in header
+        assert (
+            "EXAMPLE_API size_t ITask_Setstatus_Batch("
+            "const ITask_Handle* handles, size_t count, const Status* values);"
+        ) in header
+        assert "EXAMPLE_API size_t ITask_Complete_Batch(const ITask_Handle* handles, size_t count);" in header
+        assert (
+            "EXAMPLE_API size_t ITask_Scale_Batch("
+            "const ITask_Handle* handles, size_t count, const double* factor, double* results);"
+        ) in header
+        # Strings, nullable values and multi-argument methods stay per-object
+        assert "ITask_Gettitle_Batch" not in header
+        assert "ITask_Getscore_Batch" not in header
+        assert "ITask_Move_Batch" not in header
+        assert "ITask_Rename_Batch" not in header
+
+        assert "values[done] = static_cast<Status>(obj->get_status());" in impl
+        assert "obj->set_status(static_cast<Example::Status>(values[done]));" in impl
+        assert "results[done] = obj->Scale(factor[done]);" in impl
+        assert "if (count && (!handles || !values)) {" in impl
+
+        exports = (tmp_path / "example_exports.def").read_text()
+        assert "ITask_Scale_Batch" in exports
+
+    def test_batch_calls_status_codes(self, tmp_path):
+        """Test _Batch variants report the number done through out_done."""
+        generator = CWrapperGenerator(config={"status_codes": True})
+        namespace = Namespace(
+            name="Example",
+            interfaces=[
+                Interface(
+                    name="ITask",
+                    methods=[Method(name="Complete", return_type=PrimitiveType(name="void"))],
+                )
+            ],
+        )
+
+        generator.generate(IDLFile(namespaces=[namespace]), tmp_path)
+        header = (tmp_path / "example_wrapper.h").read_text()
+        impl = (tmp_path / "example_wrapper.cpp").read_text()
+
+        assert (
+            "EXAMPLE_API Example_ErrorCode ITask_Complete_Batch("
+            "const ITask_Handle* handles, size_t count, size_t* out_done);"
+        ) in header
+        assert "*out_done = done;\n                return EXAMPLE_ERROR_NULL_POINTER;" in impl
+
+    def test_async_methods(self, generator, tmp_path):
+        """Test async methods deliver their result through a callback."""
+        namespace = Namespace(
+            name="Example",
+            interfaces=[
+                Interface(
+                    name="IStore",
+                    methods=[
+                        Method(
+                            name="Save",
+                            return_type=PrimitiveType(name="void"),
+                            parameters=[Parameter(name="path", type=PrimitiveType(name="string_t"))],
+                            is_async=True,
+                        ),
+                        Method(
+                            name="Load",
+                            return_type=PrimitiveType(name="string_t"),
+                            is_async=True,
+                        ),
+                        Method(
+                            name="Count",
+                            return_type=PrimitiveType(name="int32_t"),
+                            is_async=True,
+                        ),
+                    ],
+                )
+            ],
+        )
+        assert generator.batch_methods(namespace.interfaces[0]) == []
+
+        generator.generate(IDLFile(namespaces=[namespace]), tmp_path)
+        header = (tmp_path / "example_wrapper.h").read_text()
+        impl = (tmp_path / "example_wrapper.cpp").read_text()
+
+        assert "typedef void (*IStore_Save_Callback)(void* context, Example_ErrorCode code);" in header
+        assert (
+            "EXAMPLE_API bool IStore_Save(IStore_Handle handle, IDynamicString_Handle path, "
+            "IStore_Save_Callback callback, void* context);"
+        ) in header
+        assert (
+            "typedef void (*IStore_Load_Callback)"
+            "(void* context, Example_ErrorCode code, IDynamicString_Handle result);"
+        ) in header
+
+        assert "#include <future>" in impl
+        assert "void WhenReady(std::future<T> future, Deliver deliver) {" in impl
+        assert "auto future = obj->Save(HandleToPtr<IDynamicString>(path)->GetValue());" in impl
+        assert "value = PtrToHandle(CreateDynamicString(result));" in impl
+        assert "callback(context, code, value);" in impl
+
+    def test_stream_methods(self, generator, tmp_path):
+        """Test stream methods return a handle read in chunks."""
+        namespace = Namespace(
+            name="Example",
+            interfaces=[
+                Interface(name="ITask"),
+                Interface(
+                    name="IProject",
+                    methods=[
+                        Method(name="GetTasks", return_type=StreamType(element_type=TypeRef(name="ITask"))),
+                        Method(name="GetNames", return_type=StreamType(element_type=PrimitiveType(name="string_t"))),
+                    ],
+                ),
+            ],
+        )
+
+        generator.generate(IDLFile(namespaces=[namespace]), tmp_path)
+        header = (tmp_path / "example_wrapper.h").read_text()
+        impl = (tmp_path / "example_wrapper.cpp").read_text()
+        exports = (tmp_path / "example_exports.def").read_text()
+
+        assert "typedef void* ExampleStream_Handle;" in header
+        assert "EXAMPLE_API ExampleStream_Handle IProject_GetTasks(" in header
+        assert (
+            "EXAMPLE_API size_t ExampleStream_Next(ExampleStream_Handle handle, void* items, size_t capacity);"
+        ) in header
+        assert "EXAMPLE_API void ExampleStream_Release(ExampleStream_Handle handle);" in header
+        # The reader keeps the object the stream came from alive
+        assert "return PtrToHandle(marshal::MakeStreamReader(obj, std::move(result)));" in impl
+        assert "class TypedStreamReader final : public StreamReader {" in impl
+        assert "    minimidl::object_ptr<const minimidl::RefCounted> m_owner;" in impl
+        assert "ExampleStream_Next" in exports
+
+        # The testbed drains a stream after releasing its object
+        testbed = (tmp_path / "example_test.c").read_text()
+        drained = testbed.split("// Test stream GetTasks, which keeps the object alive")[1]
+        assert "IProject_Release(obj);" in drained.split("ExampleStream_Next")[0]
+        assert "        ITask_Handle items[16];" in drained
+        assert "ExampleStream_Release(stream);" in drained
+
+        plain = Namespace(name="Plain", interfaces=[Interface(name="ITask")])
+        generator.generate(IDLFile(namespaces=[plain]), tmp_path)
+        assert "Stream_Handle" not in (tmp_path / "plain_wrapper.h").read_text()
+        assert "StreamReader" not in (tmp_path / "plain_wrapper.cpp").read_text()
+
+    def test_stream_methods_status_codes(self, tmp_path):
+        """Test stream reads report the item count through an out parameter in status mode."""
+        generator = CWrapperGenerator(config={"status_codes": True})
+        namespace = Namespace(
+            name="Example",
+            interfaces=[
+                Interface(
+                    name="IFeed",
+                    methods=[
+                        Method(name="Poll", return_type=StreamType(element_type=PrimitiveType(name="int32_t"))),
+                    ],
+                )
+            ],
+        )
+
+        generator.generate(IDLFile(namespaces=[namespace]), tmp_path)
+        header = (tmp_path / "example_wrapper.h").read_text()
+
+        assert "IFeed_Handle handle, ExampleStream_Handle* out_result);" in header
+        assert (
+            "EXAMPLE_API Example_ErrorCode ExampleStream_Next("
+            "ExampleStream_Handle handle, void* items, size_t capacity, size_t* out_count);"
+        ) in header
+
+    def test_events(self, generator, tmp_path):
+        """Test events get subscribe and unsubscribe calls and a dispatch entry point."""
+        namespace = Namespace(
+            name="Example",
+            interfaces=[
+                Interface(
+                    name="IProject",
+                    events=[
+                        Event(
+                            name="Renamed",
+                            parameters=[
+                                Parameter(name="name", type=PrimitiveType(name="string_t")),
+                                Parameter(name="revision", type=PrimitiveType(name="int32_t")),
+                            ],
+                        ),
+                        Event(name="Changed"),
+                    ],
+                )
+            ],
+        )
+
+        generator.generate(IDLFile(namespaces=[namespace]), tmp_path)
+        header = (tmp_path / "example_wrapper.h").read_text()
+        impl = (tmp_path / "example_wrapper.cpp").read_text()
+        exports = (tmp_path / "example_exports.def").read_text()
+
+        assert (
+            "typedef void (*IProject_Renamed_Callback)(void* context, const char* name, int32_t revision);"
+        ) in header
+        assert "typedef void (*IProject_Changed_Callback)(void* context);" in header
+        assert (
+            "EXAMPLE_API uint64_t IProject_Renamed_Subscribe("
+            "IProject_Handle handle, IProject_Renamed_Callback callback, void* context);"
+        ) in header
+        assert (
+            "EXAMPLE_API bool IProject_Renamed_Unsubscribe(IProject_Handle handle, uint64_t subscription);"
+        ) in header
+        assert "EXAMPLE_API size_t Example_DispatchEvents(void);" in header
+        assert "[callback, context](const auto& name, const auto& revision) {" in impl
+        assert "callback(context, name.c_str(), revision);" in impl
+        assert "return obj->Renamed().unsubscribe(subscription);" in impl
+        assert "return minimidl::dispatch_events();" in impl
+        assert "IProject_Changed_Subscribe" in exports
+        assert "Example_DispatchEvents" in exports
+
+        plain = Namespace(name="Plain", interfaces=[Interface(name="ITask")])
+        generator.generate(IDLFile(namespaces=[plain]), tmp_path)
+        assert "DispatchEvents" not in (tmp_path / "plain_wrapper.h").read_text()
+
+    def test_events_status_codes(self, tmp_path):
+        """Test event calls hand out their results through out parameters in status mode."""
+        namespace = Namespace(
+            name="Example",
+            interfaces=[Interface(name="IProject", events=[Event(name="Changed")])],
+        )
+
+        CWrapperGenerator(config={"status_codes": True}).generate(
+            IDLFile(namespaces=[namespace]), tmp_path
+        )
+        header = (tmp_path / "example_wrapper.h").read_text()
+
+        assert (
+            "EXAMPLE_API Example_ErrorCode IProject_Changed_Subscribe(IProject_Handle handle, "
+            "IProject_Changed_Callback callback, void* context, uint64_t* out_subscription);"
+        ) in header
+        assert (
+            "EXAMPLE_API Example_ErrorCode IProject_Changed_Unsubscribe("
+            "IProject_Handle handle, uint64_t subscription, bool* out_removed);"
+        ) in header
+        assert "EXAMPLE_API Example_ErrorCode Example_DispatchEvents(size_t* out_count);" in header
+
+    def test_ids(self, generator, tmp_path):
+        """Test ids cross as interned entry pointers with lookup functions."""
+        namespace = Namespace(
+            name="Example",
+            interfaces=[
+                Interface(
+                    name="IItem",
+                    properties=[
+                        Property(name="key", type=PrimitiveType(name="id_t"), writable=True),
+                        Property(name="tags", type=ArrayType(element_type=PrimitiveType(name="id_t"))),
+                    ],
+                    methods=[
+                        Method(
+                            name="Rekey",
+                            return_type=PrimitiveType(name="id_t"),
+                            parameters=[Parameter(name="from", type=PrimitiveType(name="id_t"))],
+                        )
+                    ],
+                )
+            ],
+        )
+
+        generator.generate(IDLFile(namespaces=[namespace]), tmp_path)
+        header = (tmp_path / "example_wrapper.h").read_text()
+        impl = (tmp_path / "example_wrapper.cpp").read_text()
+        exports = (tmp_path / "example_exports.def").read_text()
+
+        assert "typedef const struct minimidl_id_entry* Example_Id;" in header
+        assert "EXAMPLE_API Example_Id IItem_Getkey(IItem_Handle handle);" in header
+        assert "EXAMPLE_API void IItem_Setkey(IItem_Handle handle, Example_Id value);" in header
+        assert "EXAMPLE_API Example_Id Example_InternId(const char* value);" in header
+        assert "EXAMPLE_API Example_Id Example_FindId(const char* value);" in header
+        assert "EXAMPLE_API const char* Example_GetIdValue(Example_Id id);" in header
+        assert "EXAMPLE_API size_t Example_GetIdHash(Example_Id id);" in header
+        assert 'return minimidl::id(value ? value : "");' in impl
+        assert "return minimidl::id(id).c_str();" in impl
+        assert "    Example_InternId" in exports
+
+    def test_ids_absent(self, generator, tmp_path):
+        """Test namespaces without ids get no id functions."""
+        namespace = Namespace(name="Example", interfaces=[Interface(name="IItem")])
+
+        generator.generate(IDLFile(namespaces=[namespace]), tmp_path)
+        assert "_Id" not in (tmp_path / "example_wrapper.h").read_text()
+
+    def test_flat_containers(self, tmp_path):
+        """Test flat_containers can unmarshal into sorted-vector maps and sets."""
+        namespace = Namespace(
+            name="Example",
+            interfaces=[
+                Interface(
+                    name="IBag",
+                    properties=[
+                        Property(
+                            name="counts",
+                            type=DictType(
+                                key_type=PrimitiveType(name="string_t"),
+                                value_type=PrimitiveType(name="int32_t"),
+                            ),
+                            writable=True,
+                        )
+                    ],
+                )
+            ],
+        )
+
+        CWrapperGenerator().generate(IDLFile(namespaces=[namespace]), tmp_path)
+        assert "flat_map" not in (tmp_path / "example_wrapper.cpp").read_text()
+
+        CWrapperGenerator(config={"flat_containers": True}).generate(
+            IDLFile(namespaces=[namespace]), tmp_path
+        )
+        impl = (tmp_path / "example_wrapper.cpp").read_text()
+        assert "struct Unmarshaller<minimidl::flat_map<K, V, A>> {" in impl
+        assert "struct Unmarshaller<minimidl::flat_set<T, A>> {" in impl
+
+    def test_pmr_call_arena(self, tmp_path):
+        """Test pmr opens the per-call arena only where results are marshalled."""
+        string = PrimitiveType(name="string_t")
+        namespace = Namespace(
+            name="Example",
+            interfaces=[
+                Interface(
+                    name="IBag",
+                    properties=[
+                        Property(name="name", type=string, writable=True),
+                        Property(name="count", type=PrimitiveType(name="int32_t")),
+                    ],
+                    methods=[
+                        Method(name="Names", return_type=ArrayType(element_type=string)),
+                        Method(name="Later", return_type=string, is_async=True),
+                    ],
+                )
+            ],
+        )
+
+        CWrapperGenerator(config={"pmr": True}).generate(IDLFile(namespaces=[namespace]), tmp_path)
+        impl = (tmp_path / "example_wrapper.cpp").read_text()
+
+        assert "namespace arena {" in impl
+        assert "    minimidl::resource_scope m_scope;" in impl
+
+        def opens_arena(function):
+            body = impl.split(function, 1)[1].split("\n}\n", 1)[0]
+            return "arena::CallScope callArena;" in body
+
+        assert opens_arena("IDynamicString_Handle IBag_Getname(IBag_Handle handle) {")
+        assert opens_arena("ExampleArray_Handle IBag_Names(")
+        assert not opens_arena("int32_t IBag_Getcount(IBag_Handle handle) {")
+        assert not opens_arena("void IBag_Setname(IBag_Handle handle, IDynamicString_Handle value) {")
+        # Async results outlive the call
+        assert not opens_arena("bool IBag_Later(")
+
+    def test_async_methods_status_codes(self, tmp_path):
+        """Test async entry points return an error code when they cannot start."""
+        generator = CWrapperGenerator(config={"status_codes": True})
+        namespace = Namespace(
+            name="Example",
+            interfaces=[
+                Interface(
+                    name="IStore",
+                    methods=[
+                        Method(
+                            name="Count",
+                            return_type=PrimitiveType(name="int32_t"),
+                            is_async=True,
+                        )
+                    ],
+                )
+            ],
+        )
+
+        generator.generate(IDLFile(namespaces=[namespace]), tmp_path)
+        header = (tmp_path / "example_wrapper.h").read_text()
+
+        assert (
+            "EXAMPLE_API Example_ErrorCode IStore_Count("
+            "IStore_Handle handle, IStore_Count_Callback callback, void* context);"
+        ) in header
+        impl = (tmp_path / "example_wrapper.cpp").read_text()
+        assert 'SetError("Null callback");\n        return EXAMPLE_ERROR_NULL_POINTER;' in impl
+        assert "    return EXAMPLE_OK;\n}" in impl.split("// Method: Count (async)")[1]
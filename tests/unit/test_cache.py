@@ -0,0 +1,60 @@
+"""Tests for the incremental generation caches."""
+
+from minimidl.ast.nodes import IDLFile, Namespace
+from minimidl.cache import GenerationCache, content_hash, generator_fingerprint
+from minimidl.generators.base import write_if_changed
+
+
+class TestGenerationCache:
+    """Test cached ASTs and generation stamps."""
+
+    def test_ast_round_trip(self, tmp_path):
+        """Test ASTs are found by source hash and unreadable ones are ignored."""
+        cache = GenerationCache(tmp_path / "cache")
+        source_hash = content_hash("namespace Example {}")
+        assert cache.load_ast(source_hash) is None
+
+        ast = IDLFile(namespaces=[Namespace(name="Example")])
+        cache.save_ast(source_hash, ast)
+        assert cache.load_ast(source_hash) == ast
+
+        (tmp_path / "cache" / "ast" / f"{source_hash}.json").write_text("{")
+        assert cache.load_ast(source_hash) is None
+
+    def test_keys(self, tmp_path):
+        """Test keys change with the options and templates a generation uses."""
+        cache = GenerationCache(tmp_path)
+        key = cache.generation_key("abc", "cpp", tmp_path, {"pmr": False}, True, None)
+        assert key == cache.generation_key("abc", "cpp", tmp_path, {"pmr": False}, True, None)
+        assert key != cache.generation_key("abc", "cpp", tmp_path, {"pmr": True}, True, None)
+        assert key != cache.generation_key("abd", "cpp", tmp_path, {"pmr": False}, True, None)
+
+        templates = tmp_path / "templates"
+        templates.mkdir()
+        (templates / "interface.hpp.jinja2").write_text("v1")
+        assert generator_fingerprint(templates) != generator_fingerprint(None)
+
+    def test_stamps(self, tmp_path):
+        """Test a stamp is fresh until its key or one of its outputs changes."""
+        cache = GenerationCache(tmp_path / "cache")
+        source = tmp_path / "example.idl"
+        source.write_text("namespace Example {}")
+        output = tmp_path / "Example.hpp"
+        output.write_text("// generated")
+
+        assert not cache.is_fresh(source, "cpp", "key")
+        cache.record(source, "cpp", "key", [output])
+        assert cache.is_fresh(source, "cpp", "key")
+        assert not cache.is_fresh(source, "cpp", "other")
+        assert not cache.is_fresh(source, "c", "key")
+
+        output.write_text("// edited")
+        assert not cache.is_fresh(source, "cpp", "key")
+
+    def test_write_if_changed(self, tmp_path):
+        """Test files are only written when their content differs."""
+        path = tmp_path / "nested" / "Example.hpp"
+        assert write_if_changed(path, "one")
+        assert not write_if_changed(path, "one")
+        assert write_if_changed(path, "two")
+        assert path.read_text() == "two"
@@ -208,6 +208,77 @@ namespace Test {
                 )
                 assert result.exit_code == 0
 
+    def test_generate_incremental(self, runner, sample_idl_file, tmp_path):
+        """Test an unchanged input is not regenerated and unchanged files are not rewritten."""
+        output = tmp_path / "out"
+        args = ["generate", str(sample_idl_file), "-t", "cpp", "--incremental", "-o", str(output)]
+        result = runner.invoke(app, args)
+        assert result.exit_code == 0
+        header = output / "Test" / "include" / "Test.hpp"
+        mtime = header.stat().st_mtime_ns
+
+        result = runner.invoke(app, args)
+        assert result.exit_code == 0
+        assert "is up to date" in result.output
+
+        # A comment changes the input but none of the outputs
+        sample_idl_file.write_text(sample_idl_file.read_text() + "// comment\n")
+        result = runner.invoke(app, args)
+        assert "Generated" in result.output
+        assert header.stat().st_mtime_ns == mtime
+
+        # Edited outputs are regenerated
+        header.write_text("edited")
+        result = runner.invoke(app, args)
+        assert "Generated" in result.output
+        assert header.read_text() != "edited"
+
+    def test_generate_incremental_reuses_ast(self, runner, sample_idl_file, tmp_path):
+        """Test other options regenerate from the cached AST without parsing again."""
+        output = tmp_path / "out"
+        args = ["generate", str(sample_idl_file), "-t", "c", "--incremental", "-o", str(output)]
+        assert runner.invoke(app, args).exit_code == 0
+        with patch("minimidl.cli.IDLParser") as mock_parser:
+            result = runner.invoke(app, [*args, "--status-codes"])
+            assert result.exit_code == 0
+            assert "Generated" in result.output
+            mock_parser.assert_not_called()
+
+    def test_generate_batch(self, runner, tmp_path):
+        """Test several IDL files are generated in one invocation, in parallel with --jobs."""
+        sources = []
+        for name in ["First", "Second", "Third"]:
+            source = tmp_path / f"{name.lower()}.idl"
+            source.write_text(f"namespace {name} {{ interface IThing {{ int32_t Get(); }} }}")
+            sources.append(str(source))
+
+        serial = tmp_path / "serial"
+        result = runner.invoke(app, ["generate", *sources, "-t", "cpp", "-o", str(serial)])
+        assert result.exit_code == 0
+        assert "Generated 21 files total" in result.output
+
+        parallel = tmp_path / "parallel"
+        result = runner.invoke(
+            app, ["generate", *sources, "-t", "cpp", "-j", "2", "-o", str(parallel)]
+        )
+        assert result.exit_code == 0
+        for name in ["First", "Second", "Third"]:
+            header = Path(name) / "include" / f"{name}.hpp"
+            assert (parallel / header).read_text() == (serial / header).read_text()
+
+    def test_generate_batch_failure(self, runner, sample_idl_file, tmp_path):
+        """Test a file that fails is named and the others are still generated."""
+        broken = tmp_path / "broken.idl"
+        broken.write_text("namespace {")
+        result = runner.invoke(
+            app,
+            ["generate", str(broken), str(sample_idl_file), "-t", "cpp", "-o", str(tmp_path / "out")],
+        )
+        assert result.exit_code == 1
+        assert "broken.idl" in result.output
+        assert "Error:" in result.output
+        assert (tmp_path / "out" / "Test" / "include" / "Test.hpp").exists()
+
     def test_generate_no_input(self, runner):
         """Test generate command with no input file."""
         result = runner.invoke(app, ["generate"])
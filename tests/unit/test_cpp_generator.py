@@ -12,6 +12,8 @@ from minimidl.ast.nodes import (
     DictType,
     Enum,
     EnumValue,
+    Event,
+    FixedStringType,
     ForwardDeclaration,
     IdentifierExpression,
     IDLFile,
@@ -24,6 +26,9 @@ from minimidl.ast.nodes import (
     PrimitiveType,
     Property,
     SetType,
+    StreamType,
+    Struct,
+    StructField,
     Typedef,
     TypeRef,
 )
@@ -74,21 +79,67 @@ class TestCppTypeMapping:
         set_type = SetType(element_type=PrimitiveType(name="string_t"))
         assert generator.cpp_type(set_type) == "std::unordered_set<std::string>"
 
+    def test_flat_containers(self):
+        """Test flat_containers lowers dictionaries and sets to sorted vectors."""
+        generator = CppGenerator(config={"flat_containers": True})
+        dict_type = DictType(
+            key_type=PrimitiveType(name="string_t"),
+            value_type=SetType(element_type=PrimitiveType(name="int32_t")),
+        )
+        assert generator.cpp_type(dict_type) == (
+            "minimidl::flat_map<std::string, minimidl::flat_set<int32_t>>"
+        )
+        nullable = NullableType(inner_type=dict_type)
+        assert generator.cpp_type(nullable) == (
+            "std::shared_ptr<minimidl::flat_map<std::string, minimidl::flat_set<int32_t>>>"
+        )
+
+    def test_pmr(self):
+        """Test pmr lowers strings and collections to std::pmr types."""
+        generator = CppGenerator(config={"pmr": True, "string_views": True})
+        string = PrimitiveType(name="string_t")
+        assert generator.cpp_type(string) == "std::pmr::string"
+        assert generator.cpp_getter_type(string) == "const std::pmr::string&"
+        assert generator.cpp_type(ArrayType(element_type=string)) == (
+            "std::pmr::vector<std::pmr::string>"
+        )
+        dict_type = DictType(key_type=string, value_type=SetType(element_type=string))
+        assert generator.cpp_type(dict_type) == (
+            "std::pmr::unordered_map<std::pmr::string, std::pmr::unordered_set<std::pmr::string>>"
+        )
+
+        flat = CppGenerator(config={"pmr": True, "flat_containers": True})
+        assert flat.cpp_type(dict_type) == (
+            "minimidl::pmr::flat_map<std::pmr::string, minimidl::pmr::flat_set<std::pmr::string>>"
+        )
+
     def test_nullable_types(self, generator):
         """Test nullable type mapping."""
         # Nullable primitive uses optional
         nullable_int = NullableType(inner_type=PrimitiveType(name="int32_t"))
         assert generator.cpp_type(nullable_int) == "std::optional<int32_t>"
 
-        # Nullable object uses shared_ptr
+        # Nullable interface uses the intrusive object_ptr
         nullable_ref = NullableType(inner_type=TypeRef(name="IFoo"))
-        assert generator.cpp_type(nullable_ref) == "std::shared_ptr<IFoo>"
+        assert generator.cpp_type(nullable_ref) == "minimidl::object_ptr<IFoo>"
 
     def test_type_refs(self, generator):
         """Test type reference mapping."""
         type_ref = TypeRef(name="MyEnum")
         assert generator.cpp_type(type_ref) == "MyEnum"
 
+    def test_interface_refs(self, generator):
+        """Test objects are returned and collected as handles but borrowed as arguments."""
+        generator.interface_names = {"ITask"}
+        task = TypeRef(name="ITask")
+        assert generator.cpp_type(task) == "minimidl::object_ptr<ITask>"
+        assert generator.cpp_type(ArrayType(element_type=task)) == (
+            "std::vector<minimidl::object_ptr<ITask>>"
+        )
+        assert generator.cpp_type(NullableType(inner_type=task)) == "minimidl::object_ptr<ITask>"
+        assert generator.cpp_param_type(task) == "const ITask&"
+        assert generator.cpp_setter_param_type(task) == "const minimidl::object_ptr<ITask>&"
+
     def test_param_types(self, generator):
         """Test parameter type mapping."""
         # Primitives by value
@@ -197,8 +248,11 @@ class TestCodeGeneration:
 
         content = generated[0].read_text()
         assert "namespace Example" in content
-        assert "class ISimple" in content
+        assert "class ISimple : public virtual minimidl::RefCounted" in content
         assert "virtual void doSomething() = 0;" in content
+        # Only Release() may destroy a reference-counted object
+        assert "protected:\n" in content
+        assert "~ISimple() override = default;" in content
 
     def test_enum_generation(self, generator, tmp_path):
         """Test enum generation."""
@@ -307,5 +361,481 @@ class TestCodeGeneration:
         generated = generator.generate(idl_file, tmp_path)
 
         content = generated[0].read_text()
-        expected = "virtual std::vector<int32_t> processData(const std::unordered_map<std::string, std::shared_ptr<IProcessor>>& input) = 0;"
+        expected = "virtual std::vector<int32_t> processData(const std::unordered_map<std::string, minimidl::object_ptr<IProcessor>>& input) = 0;"
         assert expected in content
+
+    def test_string_views_getters(self, tmp_path):
+        """Test that string_views makes string getters return references."""
+        generator = CppGenerator(config={"string_views": True})
+        namespace = Namespace(
+            name="Example",
+            interfaces=[
+                Interface(
+                    name="IConfig",
+                    properties=[
+                        Property(
+                            name="name",
+                            type=PrimitiveType(name="string_t"),
+                            writable=True,
+                        ),
+                        Property(
+                            name="alias",
+                            type=NullableType(inner_type=PrimitiveType(name="string_t")),
+                        ),
+                    ],
+                )
+            ],
+        )
+
+        generated = generator.generate(IDLFile(namespaces=[namespace]), tmp_path)
+
+        content = generated[0].read_text()
+        assert "virtual const std::string& get_name() const = 0;" in content
+        assert "virtual void set_name(const std::string& value) = 0;" in content
+        # Nullable strings have no storage to borrow from
+        assert "virtual std::optional<std::string> get_alias() const = 0;" in content
+
+    def test_scalar_and_sink_parameters(self, tmp_path):
+        """Test by-value enums and sink_setters ownership transfer."""
+        namespace = Namespace(
+            name="Example",
+            enums=[
+                Enum(
+                    name="Level",
+                    backing_type="int32_t",
+                    values=[EnumValue(name="LOW", value=LiteralExpression(value=0))],
+                )
+            ],
+            interfaces=[
+                Interface(
+                    name="ITask",
+                    properties=[
+                        Property(name="level", type=TypeRef(name="Level"), writable=True),
+                        Property(
+                            name="tags",
+                            type=ArrayType(element_type=PrimitiveType(name="string_t")),
+                            writable=True,
+                        ),
+                    ],
+                    methods=[
+                        Method(
+                            name="Find",
+                            return_type=PrimitiveType(name="void"),
+                            parameters=[
+                                Parameter(name="level", type=TypeRef(name="Level")),
+                                Parameter(name="query", type=PrimitiveType(name="string_t")),
+                            ],
+                        )
+                    ],
+                )
+            ],
+        )
+        idl_file = IDLFile(namespaces=[namespace])
+
+        content = CppGenerator().generate(idl_file, tmp_path)[0].read_text()
+        assert "virtual void set_level(Level value) = 0;" in content
+        assert "virtual void Find(Level level, const std::string& query) = 0;" in content
+        assert "virtual void set_tags(const std::vector<std::string>& value) = 0;" in content
+
+        content = CppGenerator(config={"sink_setters": True}).generate(idl_file, tmp_path)[0].read_text()
+        assert "virtual void set_tags(std::vector<std::string> value) = 0;" in content
+        assert "virtual void set_level(Level value) = 0;" in content
+        # Method parameters keep const references
+        assert "const std::string& query" in content
+
+    def test_noexcept_methods(self, generator, tmp_path):
+        """Test noexcept method declarations."""
+        namespace = Namespace(
+            name="Example",
+            interfaces=[
+                Interface(
+                    name="ICalc",
+                    methods=[
+                        Method(
+                            name="Reset",
+                            return_type=PrimitiveType(name="void"),
+                            noexcept=True,
+                        ),
+                        Method(name="Scale", return_type=PrimitiveType(name="double")),
+                    ],
+                )
+            ],
+        )
+
+        content = generator.generate(IDLFile(namespaces=[namespace]), tmp_path)[0].read_text()
+        assert "virtual void Reset() noexcept = 0;" in content
+        assert "virtual double Scale() = 0;" in content
+        assert "#include <future>" not in content
+
+    def test_async_methods(self, generator, tmp_path):
+        """Test async methods return a std::future."""
+        namespace = Namespace(
+            name="Example",
+            interfaces=[
+                Interface(
+                    name="IStore",
+                    methods=[
+                        Method(
+                            name="Save",
+                            return_type=PrimitiveType(name="void"),
+                            parameters=[Parameter(name="path", type=PrimitiveType(name="string_t"))],
+                            is_async=True,
+                        ),
+                        Method(
+                            name="Count",
+                            return_type=PrimitiveType(name="int32_t"),
+                            is_async=True,
+                        ),
+                    ],
+                )
+            ],
+        )
+
+        content = generator.generate(IDLFile(namespaces=[namespace]), tmp_path)[0].read_text()
+        assert "#include <future>" in content
+        assert "virtual std::future<void> Save(const std::string& path) = 0;" in content
+        assert "virtual std::future<int32_t> Count() = 0;" in content
+
+    def test_stream_methods(self, generator, tmp_path):
+        """Test stream methods return a minimidl::stream."""
+        namespace = Namespace(
+            name="Example",
+            interfaces=[
+                Interface(name="ITask"),
+                Interface(
+                    name="IProject",
+                    methods=[
+                        Method(name="GetTasks", return_type=StreamType(element_type=TypeRef(name="ITask"))),
+                        Method(name="GetNames", return_type=StreamType(element_type=PrimitiveType(name="string_t"))),
+                    ],
+                ),
+            ],
+        )
+
+        content = generator.generate(IDLFile(namespaces=[namespace]), tmp_path)[0].read_text()
+        assert "virtual minimidl::stream<minimidl::object_ptr<ITask>> GetTasks() = 0;" in content
+        assert "virtual minimidl::stream<std::string> GetNames() = 0;" in content
+
+    def test_events(self, generator, tmp_path):
+        """Test events are minimidl::event members behind virtual accessors."""
+        namespace = Namespace(
+            name="Example",
+            interfaces=[
+                Interface(
+                    name="IProject",
+                    events=[
+                        Event(
+                            name="Renamed",
+                            parameters=[
+                                Parameter(name="name", type=PrimitiveType(name="string_t")),
+                                Parameter(name="revision", type=PrimitiveType(name="int32_t")),
+                            ],
+                        ),
+                        Event(name="Changed"),
+                    ],
+                    attributes=["threadsafe"],
+                )
+            ],
+        )
+
+        content = generator.generate(IDLFile(namespaces=[namespace]), tmp_path)[0].read_text()
+        assert "    using RenamedEvent = minimidl::event<std::string, int32_t>;" in content
+        assert "    virtual RenamedEvent& Renamed() noexcept { return m_Renamed; }" in content
+        assert "    using ChangedEvent = minimidl::event<>;" in content
+        assert "    ChangedEvent m_Changed;" in content
+        assert (
+            "    ChangedEvent& Changed() noexcept override { return m_inner->Changed(); }"
+        ) in content
+
+    def test_ids(self, generator, tmp_path):
+        """Test ids are minimidl::id values passed by value."""
+        namespace = Namespace(
+            name="Example",
+            interfaces=[
+                Interface(
+                    name="IItem",
+                    properties=[
+                        Property(name="key", type=PrimitiveType(name="id_t"), writable=True),
+                        Property(name="tags", type=ArrayType(element_type=PrimitiveType(name="id_t"))),
+                    ],
+                    methods=[
+                        Method(
+                            name="Rekey",
+                            return_type=PrimitiveType(name="id_t"),
+                            parameters=[Parameter(name="from", type=PrimitiveType(name="id_t"))],
+                        )
+                    ],
+                )
+            ],
+        )
+
+        content = generator.generate(IDLFile(namespaces=[namespace]), tmp_path)[0].read_text()
+        assert "    virtual minimidl::id get_key() const = 0;" in content
+        assert "    virtual void set_key(minimidl::id value) = 0;" in content
+        assert "    virtual std::vector<minimidl::id> get_tags() const = 0;" in content
+        assert "    virtual minimidl::id Rekey(minimidl::id from) = 0;" in content
+
+    def test_sealed_interface(self, generator, tmp_path):
+        """Test the static-dispatch base emitted for sealed interfaces."""
+        namespace = Namespace(
+            name="Example",
+            interfaces=[
+                Interface(
+                    name="ICounter",
+                    properties=[Property(name="value", type=PrimitiveType(name="int32_t"))],
+                    attributes=["sealed"],
+                ),
+                Interface(name="IPlain"),
+            ],
+        )
+
+        content = generator.generate(IDLFile(namespaces=[namespace]), tmp_path)[0].read_text()
+        assert "template<typename Derived>\nclass ICounterSealed : public ICounter {" in content
+        assert "static_assert(std::is_final_v<Derived>," in content
+        assert "IPlainSealed" not in content
+
+    def test_shared_wrapper(self, generator, tmp_path):
+        """Test the thread-sharing wrapper emitted for annotated interfaces."""
+        namespace = Namespace(
+            name="Example",
+            interfaces=[
+                Interface(
+                    name="ITask",
+                    properties=[
+                        Property(
+                            name="id",
+                            type=PrimitiveType(name="string_t"),
+                            attributes=["immutable"],
+                        ),
+                        Property(
+                            name="title",
+                            type=PrimitiveType(name="string_t"),
+                            writable=True,
+                            attributes=["readmostly"],
+                        ),
+                        Property(name="hits", type=PrimitiveType(name="int32_t")),
+                    ],
+                    methods=[Method(name="Complete", return_type=PrimitiveType(name="void"))],
+                ),
+                Interface(
+                    name="ICounter",
+                    methods=[Method(name="Add", return_type=PrimitiveType(name="int32_t"))],
+                    attributes=["threadsafe"],
+                ),
+                Interface(name="IPlain"),
+            ],
+        )
+
+        content = generator.generate(IDLFile(namespaces=[namespace]), tmp_path)[0].read_text()
+        task = content[content.index("class ITaskShared") : content.index("class ICounter ")]
+        assert "class ITaskShared final : public ITask {" in task
+        assert "std::string get_id() const override { return m_id; }" in task
+        assert "std::string get_title() const override { return m_title.load(); }" in task
+        assert "    const std::string m_id;" in task
+        assert "    minimidl::read_mostly<std::string> m_title;" in task
+        assert "    mutable std::mutex m_mutex;" in task
+        assert "        refresh();" in task
+
+        counter = content[content.index("class ICounterShared") :]
+        assert "        return m_inner->Add();" in counter
+        assert "m_mutex" not in counter
+        assert "refresh" not in counter
+        assert "IPlainShared" not in content
+
+    def test_shared_wrapper_string_views(self, tmp_path):
+        """Test string references from the thread-sharing wrapper are copied first."""
+        namespace = Namespace(
+            name="Example",
+            interfaces=[
+                Interface(
+                    name="ITask",
+                    properties=[
+                        Property(
+                            name="title",
+                            type=PrimitiveType(name="string_t"),
+                            writable=True,
+                            attributes=["readmostly"],
+                        ),
+                        Property(name="note", type=PrimitiveType(name="string_t"), writable=True),
+                    ],
+                )
+            ],
+        )
+
+        generator = CppGenerator(config={"string_views": True})
+        content = generator.generate(IDLFile(namespaces=[namespace]), tmp_path)[0].read_text()
+        task = content[content.index("class ITaskShared") :]
+        assert (
+            "    const std::string& get_title() const override {\n"
+            "        thread_local std::string value;\n"
+            "        value = m_title.load();\n"
+        ) in task
+        assert (
+            "    const std::string& get_note() const override {\n"
+            "        thread_local std::string value;\n"
+            "        std::lock_guard<std::mutex> lock(m_mutex);\n"
+            "        value = m_inner->get_note();\n"
+            "        return value;\n"
+        ) in task
+
+    def test_struct_generation(self, generator, tmp_path):
+        """Test plain-data struct emission."""
+        namespace = Namespace(
+            name="Example",
+            structs=[
+                Struct(
+                    name="Summary",
+                    fields=[
+                        StructField(name="count", type=PrimitiveType(name="int32_t")),
+                        StructField(name="title", type=FixedStringType(capacity=64)),
+                    ],
+                )
+            ],
+            interfaces=[
+                Interface(
+                    name="IProject",
+                    methods=[
+                        Method(
+                            name="GetSummaries",
+                            return_type=ArrayType(element_type=TypeRef(name="Summary")),
+                        )
+                    ],
+                )
+            ],
+        )
+
+        content = generator.generate(IDLFile(namespaces=[namespace]), tmp_path)[0].read_text()
+        assert "struct Summary {" in content
+        assert "    int32_t count;" in content
+        assert "    minimidl::fixed_string<64> title;" in content
+        assert "std::is_standard_layout_v<Summary> && std::is_trivially_copyable_v<Summary>" in content
+        assert "virtual std::vector<Summary> GetSummaries() = 0;" in content
+        assert content.index("struct Summary {") < content.index("class IProject")
+
+    def test_descriptors(self, generator, tmp_path):
+        """Test compile-time descriptors of enums and interfaces."""
+        namespace = Namespace(
+            name="Example",
+            enums=[
+                Enum(
+                    name="Status",
+                    backing_type="int32_t",
+                    values=[
+                        EnumValue(name="OK", value=LiteralExpression(value=0)),
+                        EnumValue(name="ERROR", value=LiteralExpression(value=1)),
+                    ],
+                )
+            ],
+            interfaces=[
+                Interface(
+                    name="ITask",
+                    properties=[
+                        Property(name="id", type=PrimitiveType(name="string_t")),
+                        Property(
+                            name="tags",
+                            type=ArrayType(element_type=PrimitiveType(name="string_t")),
+                            writable=True,
+                        ),
+                    ],
+                    methods=[
+                        Method(
+                            name="Find",
+                            return_type=NullableType(inner_type=TypeRef(name="ITask")),
+                            parameters=[Parameter(name="id", type=PrimitiveType(name="string_t"))],
+                        )
+                    ],
+                )
+            ],
+        )
+
+        content = generator.generate(IDLFile(namespaces=[namespace]), tmp_path)[0].read_text()
+        assert "struct descriptor<Example::Status> {" in content
+        assert "std::array<Example::Status, 2> values = {" in content
+        assert '        "ERROR",\n' in content
+        assert "static constexpr bool contiguous = detail::is_contiguous(values);" in content
+        assert 'property("id", "string_t", &Example::ITask::get_id),' in content
+        assert (
+            'property("tags", "string_t[]", &Example::ITask::get_tags, &Example::ITask::set_tags)\n'
+        ) in content
+        assert 'method("Find", "ITask?", &Example::ITask::Find, "id")' in content
+        assert content.index("} // namespace Example") < content.index("namespace minimidl {")
+
+    def test_split_headers(self, tmp_path):
+        """Test split headers only include what their part of a namespace needs."""
+        generator = CppGenerator(config={"split_headers": True})
+        task = TypeRef(name="ITask")
+        namespace = Namespace(
+            name="Example",
+            enums=[
+                Enum(
+                    name="Status",
+                    backing_type="int32_t",
+                    values=[EnumValue(name="OK", value=LiteralExpression(value=0))],
+                )
+            ],
+            structs=[
+                Struct(
+                    name="Summary",
+                    fields=[StructField(name="count", type=PrimitiveType(name="int32_t"))],
+                )
+            ],
+            typedefs=[Typedef(name="TaskList", type=ArrayType(element_type=task))],
+            interfaces=[
+                Interface(
+                    name="ITask",
+                    methods=[
+                        Method(name="Later", return_type=PrimitiveType(name="void"), is_async=True)
+                    ],
+                ),
+                Interface(
+                    name="IProject",
+                    methods=[Method(name="GetTasks", return_type=TypeRef(name="TaskList"))],
+                ),
+            ],
+        )
+
+        files = generator.generate(IDLFile(namespaces=[namespace]), tmp_path)
+        assert [f.name for f in files] == [
+            "Example_fwd.hpp",
+            "Example_types.hpp",
+            "Example_ITask.hpp",
+            "Example_IProject.hpp",
+            "Example.hpp",
+            "Example.cppm",
+        ]
+        contents = {f.name: f.read_text() for f in files}
+
+        fwd = contents["Example_fwd.hpp"]
+        assert fwd.count("#include") == 1 and "#include <cstdint>" in fwd
+        assert "template<typename T>\nclass object_ptr;" in fwd
+        assert "class ITask;\nclass IProject;\nstruct Summary;" in fwd
+        assert "enum class Status : int32_t {" in fwd
+
+        types = contents["Example_types.hpp"]
+        assert '#include "minimidl_runtime.hpp"\n#include "Example_fwd.hpp"' in types
+        assert "struct Summary {" in types
+        assert "using TaskList = std::vector<minimidl::object_ptr<ITask>>;" in types
+        assert "struct descriptor<Example::Status> {" in types
+        assert "enum class" not in types and "class ITask" not in types
+
+        task_header = contents["Example_ITask.hpp"]
+        assert '#include <future>\n#include "Example_types.hpp"\n\n' in task_header
+        assert "class ITask : public virtual minimidl::RefCounted {" in task_header
+        assert "struct descriptor<Example::ITask> {" in task_header
+        assert "IProject" not in task_header and "struct Summary" not in task_header
+
+        # The typedef is followed to the interface it holds
+        project_header = contents["Example_IProject.hpp"]
+        assert '#include "Example_types.hpp"\n#include "Example_ITask.hpp"' in project_header
+        assert "<future>" not in project_header
+
+        assert contents["Example.hpp"].endswith(
+            '#include "Example_types.hpp"\n'
+            '#include "Example_ITask.hpp"\n'
+            '#include "Example_IProject.hpp"\n\n'
+        )
+        module = contents["Example.cppm"]
+        assert 'module;\n\n#include "Example.hpp"\n\nexport module Example;' in module
+        assert "using minimidl::object_ptr;" in module
+        assert "using Example::Status;\nusing Example::Summary;\nusing Example::TaskList;" in module
+        assert "using Example::IProject;" in module
@@ -89,6 +89,39 @@ class TestInterfaceDeclarations:
         members = [child for child in interface.children if hasattr(child, "data")]
         assert len(members) == 3
 
+    def test_interface_with_events(self) -> None:
+        """Test parsing interface events with and without parameters."""
+        idl = """
+        namespace Test {
+            interface IProject {
+                string_t Name;
+                event Renamed(string_t name, int32_t revision);
+                event Changed();
+            }
+        }
+        """
+        interface = parse_idl(idl).namespaces[0].interfaces[0]
+        assert [event.name for event in interface.events] == ["Renamed", "Changed"]
+        assert [param.name for param in interface.events[0].parameters] == ["name", "revision"]
+        assert interface.events[1].parameters == []
+        assert len(interface.properties) == 1
+
+    def test_id_type(self) -> None:
+        """Test parsing the interned id type."""
+        idl = """
+        namespace Test {
+            interface IItem {
+                id_t key;
+                id_t Rekey(id_t from, int32_t id_thing);
+            }
+        }
+        """
+        interface = parse_idl(idl).namespaces[0].interfaces[0]
+        assert interface.properties[0].type.name == "id_t"
+        method = interface.methods[0]
+        assert method.return_type.name == "id_t"
+        assert [param.type.name for param in method.parameters] == ["id_t", "int32_t"]
+
     def test_forward_declaration(self) -> None:
         """Test parsing forward declarations."""
         idl = """
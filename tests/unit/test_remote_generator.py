@@ -0,0 +1,214 @@
+"""Tests for the out-of-process proxy and stub generator."""
+
+import pytest
+
+from minimidl.ast.nodes import (
+    ArrayType,
+    Event,
+    IDLFile,
+    Interface,
+    Method,
+    Namespace,
+    NullableType,
+    Parameter,
+    PrimitiveType,
+    Property,
+    StreamType,
+    TypeRef,
+)
+from minimidl.generators.remote import RemoteGenerator
+
+
+class TestRemoteMembers:
+    """Test how interface members cross the channel."""
+
+    @pytest.fixture
+    def generator(self):
+        """Create a remote generator that knows two interfaces."""
+        generator = RemoteGenerator()
+        generator.interface_names = {"ITask", "IProject"}
+        return generator
+
+    def test_result_kinds(self, generator):
+        """Test values, objects, arrays and streams of them are supported results."""
+        task = TypeRef(name="ITask")
+        assert generator.result_kind(PrimitiveType(name="void")) == "void"
+        assert generator.result_kind(PrimitiveType(name="string_t")) == "value"
+        assert generator.result_kind(NullableType(inner_type=task)) == "nullable_object"
+        assert generator.result_kind(StreamType(element_type=task)) == "stream_object"
+        assert generator.result_kind(StreamType(element_type=PrimitiveType(name="int32_t"))) == (
+            "stream_value"
+        )
+        assert generator.result_kind(task) == "object"
+        assert generator.result_kind(ArrayType(element_type=task)) == "array_object"
+        assert generator.argument_kind(task) == "object"
+
+    def test_events_stay_local(self, generator):
+        """Test events do not keep the other members of an interface from being remoted."""
+        assert generator.supports(Interface(name="ITask"))
+        assert generator.supports(Interface(name="ITask", events=[Event(name="Changed")]))
+
+    def test_member_ids(self, generator):
+        """Test accessors come first and ids start at 1."""
+        interface = Interface(
+            name="ITask",
+            properties=[
+                Property(name="id", type=PrimitiveType(name="string_t")),
+                Property(name="title", type=PrimitiveType(name="string_t"), writable=True),
+            ],
+            methods=[
+                Method(
+                    name="Link",
+                    return_type=PrimitiveType(name="void"),
+                    parameters=[
+                        Parameter(name="other", type=NullableType(inner_type=TypeRef(name="ITask")))
+                    ],
+                )
+            ],
+        )
+        members = generator.remote_members(interface)
+        assert [(member.id, member.name) for member in members] == [
+            (1, "get_id"),
+            (2, "get_title"),
+            (3, "set_title"),
+            (4, "Link"),
+        ]
+        assert members[2].declaration == "void set_title(const std::string& value)"
+        assert members[3].parameters[0].kind == "nullable_object"
+        assert members[3].parameters[0].cpp_type == "ITask"
+
+    def test_object_setters(self, generator):
+        """Test setters keep their object, so it crosses as a reference."""
+        interface = Interface(
+            name="ITask",
+            properties=[Property(name="project", type=TypeRef(name="IProject"), writable=True)],
+        )
+        getter, setter = generator.remote_members(interface)
+        assert getter.declaration == "minimidl::object_ptr<IProject> get_project() const"
+        assert getter.result_kind == "object"
+        assert setter.declaration == (
+            "void set_project(const minimidl::object_ptr<IProject>& value)"
+        )
+        assert setter.parameters[0].kind == "nullable_object"
+
+
+class TestRemoteGeneration:
+    """Test full proxy and stub header generation."""
+
+    @pytest.fixture
+    def generator(self):
+        """Create a remote generator instance."""
+        return RemoteGenerator()
+
+    def test_proxies_and_stubs(self, generator, tmp_path):
+        """Test proxies queue calls without results and stubs dispatch by id."""
+        task = TypeRef(name="ITask")
+        namespace = Namespace(
+            name="Example",
+            interfaces=[
+                Interface(
+                    name="ITask",
+                    properties=[
+                        Property(name="title", type=PrimitiveType(name="string_t"), writable=True)
+                    ],
+                    methods=[Method(name="Touch", return_type=PrimitiveType(name="void"))],
+                ),
+                Interface(
+                    name="IProject",
+                    methods=[
+                        Method(
+                            name="Find",
+                            return_type=NullableType(inner_type=task),
+                            parameters=[Parameter(name="id", type=PrimitiveType(name="string_t"))],
+                        ),
+                        Method(name="Tasks", return_type=StreamType(element_type=task)),
+                    ],
+                ),
+                Interface(
+                    name="IFactory",
+                    methods=[
+                        Method(name="Make", return_type=task),
+                        Method(name="MakeAll", return_type=ArrayType(element_type=task)),
+                    ],
+                ),
+                # Events stay local to the proxy
+                Interface(name="IWatched", events=[Event(name="Changed")]),
+                # Streams cannot be sent as arguments, so it has no proxy
+                Interface(
+                    name="ILocal",
+                    methods=[
+                        Method(
+                            name="Feed",
+                            return_type=PrimitiveType(name="void"),
+                            parameters=[
+                                Parameter(
+                                    name="items",
+                                    type=StreamType(element_type=PrimitiveType(name="int32_t")),
+                                )
+                            ],
+                        )
+                    ],
+                ),
+            ],
+        )
+
+        files = generator.generate(IDLFile(namespaces=[namespace]), tmp_path)
+        assert [f.name for f in files] == ["ExampleRemote.hpp"]
+        content = files[0].read_text()
+
+        assert '#include "minimidl_ipc.hpp"' in content
+        assert '#include "ExampleSerialization.hpp"' in content
+        assert (
+            "class ITaskProxy final : public ITask, public minimidl::ipc::remote_object {"
+            in content
+        )
+        assert "auto request = remote_client().start(remote_id(), 3);\n    request.post();" in (
+            content
+        )
+        assert "read_object<ITask, ITaskProxy>(response)" in content
+        assert "    case 2: {\n        std::string arg_value{};" in content
+        assert "server.write_object(reply, result, &ITaskStub::dispatch);" in content
+        assert "auto items = minimidl::ipc::drain(std::move(result));" in content
+        assert "minimidl::object_ptr<ITask> IFactoryProxy::Make()" in content
+        assert "    }\n    return decoded;\n}" in content
+        assert "const auto& items = result;" in content
+        assert "// ILocal has members whose results or arguments cannot cross a" in content
+        assert "ILocalProxy" not in content
+        assert (
+            "// Events are local to the proxy: subscribing to them does not reach the\n"
+            "// server, and only emit() or post() on the proxy calls its subscribers.\n"
+            "class IWatchedProxy final"
+        ) in content
+
+    def test_pmr_results(self, tmp_path):
+        """Test pmr proxies decode results onto the caller's current resource."""
+        generator = RemoteGenerator(config={"pmr": True})
+        namespace = Namespace(
+            name="Example",
+            interfaces=[
+                Interface(
+                    name="ITask",
+                    properties=[Property(name="title", type=PrimitiveType(name="string_t"))],
+                    methods=[
+                        Method(
+                            name="Subtasks",
+                            return_type=ArrayType(element_type=TypeRef(name="ITask")),
+                        ),
+                        Method(
+                            name="Search",
+                            return_type=ArrayType(element_type=TypeRef(name="ITask")),
+                            is_async=True,
+                        ),
+                    ],
+                )
+            ],
+        )
+
+        content = generator.generate(IDLFile(namespaces=[namespace]), tmp_path)[0].read_text()
+        assert "auto decoded = minimidl::make_value<std::pmr::string>();" in content
+        # Named rather than braced, so the async call's lambda can return it
+        assert (
+            "        return std::pmr::vector<minimidl::object_ptr<ITask>>(\n"
+            "            std::make_move_iterator(decoded.begin()),"
+        ) in content
+        assert "    return minimidl::ipc::ready_future([&] {" in content
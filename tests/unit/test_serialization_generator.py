@@ -0,0 +1,133 @@
+"""Tests for the binary serialization code generator."""
+
+import pytest
+
+from minimidl.ast.nodes import (
+    ArrayType,
+    Enum,
+    EnumValue,
+    FixedStringType,
+    IDLFile,
+    Interface,
+    LiteralExpression,
+    Namespace,
+    NullableType,
+    PrimitiveType,
+    Property,
+    Struct,
+    StructField,
+    Typedef,
+    TypeRef,
+)
+from minimidl.generators.serialization import SerializationGenerator
+
+
+class TestSerializationTypeMapping:
+    """Test how property types are read back in place."""
+
+    @pytest.fixture
+    def generator(self):
+        """Create a serialization generator that knows one enum and a typedef."""
+        generator = SerializationGenerator()
+        generator.enum_names = {"Status"}
+        generator.typedefs = {"Names": ArrayType(element_type=PrimitiveType(name="string_t"))}
+        return generator
+
+    def test_view_types(self, generator):
+        """Test strings become views and collections stay encoded."""
+        string = PrimitiveType(name="string_t")
+        assert generator.wire_view_type(string) == "std::string_view"
+        assert generator.wire_view_type(NullableType(inner_type=string)) == (
+            "std::optional<std::string_view>"
+        )
+        assert generator.wire_view_type(PrimitiveType(name="int32_t")) == "int32_t"
+        assert generator.wire_view_type(NullableType(inner_type=TypeRef(name="Status"))) == (
+            "std::optional<Status>"
+        )
+        assert generator.wire_view_type(ArrayType(element_type=string)) == (
+            "minimidl::wire::encoded<std::vector<std::string>>"
+        )
+        assert generator.wire_view_type(TypeRef(name="Names")) == "minimidl::wire::encoded<Names>"
+
+    def test_object_references_are_skipped(self, generator):
+        """Test interface references have no encoding."""
+        interface = Interface(
+            name="INode",
+            properties=[
+                Property(name="name", type=PrimitiveType(name="string_t")),
+                Property(name="parent", type=NullableType(inner_type=TypeRef(name="INode"))),
+                Property(name="status", type=TypeRef(name="Status")),
+            ],
+        )
+        assert [prop.name for prop in generator.serialized_properties(interface)] == [
+            "name",
+            "status",
+        ]
+
+
+class TestSerializationGeneration:
+    """Test full serialization header generation."""
+
+    @pytest.fixture
+    def generator(self):
+        """Create a serialization generator instance."""
+        return SerializationGenerator()
+
+    def test_codecs(self, generator, tmp_path):
+        """Test struct codecs and interface records, views and encoders."""
+        namespace = Namespace(
+            name="Example",
+            enums=[
+                Enum(
+                    name="Status",
+                    backing_type="int32_t",
+                    values=[EnumValue(name="OPEN", value=LiteralExpression(value=0))],
+                )
+            ],
+            structs=[
+                Struct(
+                    name="Label",
+                    fields=[
+                        StructField(name="text", type=FixedStringType(capacity=16)),
+                        StructField(name="status", type=TypeRef(name="Status")),
+                    ],
+                )
+            ],
+            typedefs=[
+                Typedef(name="Names", type=ArrayType(element_type=PrimitiveType(name="string_t")))
+            ],
+            interfaces=[
+                Interface(
+                    name="ITask",
+                    properties=[
+                        Property(name="title", type=PrimitiveType(name="string_t"), writable=True),
+                        Property(name="label", type=TypeRef(name="Label")),
+                        Property(name="tags", type=TypeRef(name="Names")),
+                        Property(name="parent", type=NullableType(inner_type=TypeRef(name="ITask"))),
+                    ],
+                ),
+                Interface(
+                    name="IHandle",
+                    properties=[
+                        Property(name="task", type=NullableType(inner_type=TypeRef(name="ITask")))
+                    ],
+                ),
+            ],
+        )
+
+        files = generator.generate(IDLFile(namespaces=[namespace]), tmp_path)
+        assert [f.name for f in files] == ["ExampleSerialization.hpp"]
+        content = files[0].read_text()
+
+        assert '#include "Example.hpp"' in content
+        assert "inline void encode(minimidl::wire::writer& out, const Label& value) {" in content
+        assert "    decode(in, value.text);\n    decode(in, value.status);\n}" in content
+        assert "struct ITaskRecord {\n    std::string title{};" in content
+        assert "    std::string_view title{};" in content
+        assert "    minimidl::wire::encoded<Names> tags{};" in content
+        assert "    encode(out, object.get_title());" in content
+        assert "view.title = in.read_view();" in content
+        assert "view.tags = minimidl::wire::encoded<Names>::read(in);" in content
+        assert "parent" not in content
+        # Interfaces holding only object references get no record
+        assert "IHandle" not in content
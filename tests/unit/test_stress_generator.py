@@ -0,0 +1,136 @@
+"""Tests for the C wrapper load test generator."""
+
+from minimidl.ast.nodes import (
+    ArrayType,
+    IDLFile,
+    Interface,
+    Method,
+    Namespace,
+    NullableType,
+    Parameter,
+    PrimitiveType,
+    Property,
+    TypeRef,
+)
+from minimidl.generators.stress import StressGenerator
+from minimidl.workflows.c_workflow import CWorkflow
+
+
+def _namespace():
+    """Build a namespace with a task interface and a factory handing tasks out."""
+    task = TypeRef(name="ITask")
+    return Namespace(
+        name="Example",
+        interfaces=[
+            Interface(
+                name="ITask",
+                properties=[
+                    Property(name="title", type=PrimitiveType(name="string_t"), writable=True),
+                    Property(name="tags", type=ArrayType(element_type=PrimitiveType(name="string_t"))),
+                    Property(name="parent", type=NullableType(inner_type=task), writable=True),
+                ],
+                methods=[
+                    Method(name="Touch", return_type=PrimitiveType(name="void")),
+                    Method(
+                        name="Later",
+                        return_type=PrimitiveType(name="int32_t"),
+                        parameters=[Parameter(name="delay", type=PrimitiveType(name="int32_t"))],
+                        is_async=True,
+                    ),
+                ],
+            ),
+            Interface(
+                name="IFactory",
+                methods=[Method(name="Make", return_type=task)],
+            ),
+        ],
+    )
+
+
+class TestStressEntries:
+    """Test which C entry points the load test calls."""
+
+    def test_entries(self):
+        """Test getters read, setters and methods write, and untimed members are left out."""
+        generator = StressGenerator()
+        generator.use_namespace(_namespace())
+        entries = generator.stress_entries(_namespace())
+        assert [(e.interface, e.case.name, e.case.reads) for e in entries] == [
+            ("ITask", "ITask_get_title", True),
+            ("ITask", "ITask_set_title", False),
+            ("ITask", "ITask_get_tags", True),
+            ("ITask", "ITask_get_parent", True),
+            ("ITask", "ITask_set_parent", False),
+            ("ITask", "ITask_Touch", False),
+            ("IFactory", "IFactory_Make", False),
+        ]
+        assert [e.case.c_function for e in entries] == [
+            "ITask_Gettitle",
+            "ITask_Settitle",
+            "ITask_Gettags_GetAll",
+            "ITask_Getparent",
+            "ITask_Setparent",
+            "ITask_Touch",
+            "IFactory_Make",
+        ]
+        assert entries[0].case.c_call == [
+            "auto result = ITask_Gettitle(handle);",
+            "IDynamicString_Release(result);",
+        ]
+
+    def test_status_codes(self):
+        """Test results are kept through the harness instead of Google Benchmark."""
+        generator = StressGenerator(config={"status_codes": True})
+        generator.use_namespace(_namespace())
+        case = generator.stress_entries(_namespace())[0].case
+        assert case.c_call[1] == "Keep(ITask_Gettitle(handle, &result));"
+
+    def test_string_views(self):
+        """Test borrowed view getters are labelled with their own C function."""
+        generator = StressGenerator(config={"string_views": True})
+        generator.use_namespace(_namespace())
+        entries = generator.stress_entries(_namespace())
+        assert entries[1].case.name == "ITask_get_title_View"
+        assert entries[1].case.c_function == "ITask_Gettitle_View"
+
+
+class TestStressGeneration:
+    """Test load test source and project generation."""
+
+    def test_stress(self, tmp_path):
+        """Test entry points, the worker loop and the report."""
+        files = StressGenerator().generate(IDLFile(namespaces=[_namespace()]), tmp_path)
+        assert [f.name for f in files] == ["example_stress.cpp"]
+        content = files[0].read_text()
+
+        assert '#include "example_wrapper.h"' in content
+        assert "class ITaskBench final : public ITask {" in content
+        assert "struct ITask_set_title_Entry {" in content
+        assert "    IDynamicString_Handle value = IDynamicString_Create(kText);" in content
+        assert "        IDynamicString_Release(value);" in content
+        assert "    ITask_get_title_Entry entry0{ shared };" in content
+        assert "    ITask_set_title_Entry entry1{ own };" in content
+        assert "        ITask_Setparent(handle, objects().ITaskObject.get());" in content
+        assert "        case 5: entry5(); break;" in content
+        assert '    {"ITask_Gettitle", true},' in content
+        assert '    {"ITask_Gettags_GetAll", true},' in content
+        assert '    {"IFactory_Make", false},' in content
+        assert "Percentile(sorted, 0.999)" in content
+        assert "int main(int argc, char** argv) {" in content
+
+    def test_c_workflow(self, tmp_path):
+        """Test the C project builds and runs the load test when asked to."""
+        idl_file = IDLFile(namespaces=[_namespace()])
+        files = CWorkflow().generate_project(idl_file, tmp_path)
+        assert "example_stress.cpp" not in [f.name for f in files]
+        assert "example_stress" not in (tmp_path / "Example" / "CWrapper" / "CMakeLists.txt").read_text()
+
+        files = CWorkflow({"stress": True}).generate_project(idl_file, tmp_path)
+        assert "example_stress.cpp" in [f.name for f in files]
+        cmake = (tmp_path / "Example" / "CWrapper" / "CMakeLists.txt").read_text()
+        assert "add_executable(example_stress example_stress.cpp)" in cmake
+        assert (
+            "target_link_libraries(example_stress PRIVATE example_wrapper Threads::Threads)"
+            in cmake
+        )
+        assert "add_test(NAME example_stress COMMAND example_stress --threads 4 --ops 10000)" in cmake
@@ -8,6 +8,8 @@ from minimidl.ast.nodes import (
     ArrayType,
     Enum,
     EnumValue,
+    Event,
+    FixedStringType,
     IDLFile,
     Interface,
     LiteralExpression,
@@ -17,6 +19,9 @@ from minimidl.ast.nodes import (
     Parameter,
     PrimitiveType,
     Property,
+    StreamType,
+    Struct,
+    StructField,
     TypeRef,
 )
 from minimidl.generators.swift import SwiftGenerator
@@ -200,8 +205,43 @@ class TestSwiftGeneration:
         assert "public enum Status: Int32, CaseIterable {" in content
         assert "case ok = 0" in content
         assert "case error = 1" in content
-        assert "public init?(cValue: Example_Status)" in content
-        assert "public var cValue: Example_Status" in content
+        assert "public init?(cValue: ExampleC.Status)" in content
+        assert "public var cValue: ExampleC.Status" in content
+        assert "internal init(checkedCValue cValue: ExampleC.Status)" in content
+        assert "guard Status_FromString(name, &value) else {" in content
+        assert "return String(cString: Status_ToString(rawValue))" in content
+
+    def test_enum_properties(self, generator, tmp_path):
+        """Test enum properties, results and batches cross as raw C values."""
+        status = TypeRef(name="Status")
+        namespace = Namespace(
+            name="Example",
+            interfaces=[
+                Interface(
+                    name="ITask",
+                    properties=[Property(name="status", type=status, writable=True)],
+                    methods=[Method(name="Next", return_type=status)],
+                )
+            ],
+            enums=[
+                Enum(
+                    name="Status",
+                    backing_type="int32_t",
+                    values=[EnumValue(name="OK", value=LiteralExpression(value=0))],
+                )
+            ],
+        )
+
+        files = generator.generate(IDLFile(namespaces=[namespace]), tmp_path)
+        wrapper = next(f for f in files if f.name == "Example.swift").read_text()
+
+        assert "TODO" not in wrapper
+        assert "return Status(checkedCValue: ITask_Getstatus(handle))" in wrapper
+        assert "ITask_Setstatus(handle, newValue.cValue)" in wrapper
+        assert "return Status(checkedCValue: ITask_Next(handle))" in wrapper
+        assert "[Status.RawValue](unsafeUninitializedCapacity: handles.count)" in wrapper
+        assert "}.map { Status(checkedCValue: $0) }" in wrapper
+        assert "ITask_Setstatus_Batch(handles, handles.count, values.map { $0.cValue })" in wrapper
 
     def test_array_property(self, generator, tmp_path):
         """Test array property generation."""
@@ -235,10 +275,12 @@ class TestSwiftGeneration:
         # Check array property
         assert "public var items: [String]" in content
         assert "IContainer_Getitems_Count(handle)" in content
-        assert "IContainer_Getitems_Item(handle, i)" in content
-        assert "String(cString: cString)" in content
-        assert "IContainer_Setitems_Clear(handle)" in content
-        assert "IContainer_Setitems_Add(handle, item)" in content
+        assert "IContainer_Getitems_GetAll(handle, &items, count)" in content
+        assert "IContainer_Setitems_SetAll(handle, views, views.count)" in content
+
+        # One boundary crossing per access, not one per element
+        assert "IContainer_Getitems_Item" not in content
+        assert "IContainer_Setitems_Add" not in content
 
     def test_nullable_property(self, generator, tmp_path):
         """Test nullable property generation."""
@@ -346,3 +388,308 @@ class TestSwiftGeneration:
         assert "@testable import Example" in content
         assert "final class ExampleTests: XCTestCase" in content
         assert "func testSimpleCreation()" in content
+
+    def test_struct_types(self, generator, tmp_path):
+        """Test structs surfaced from the C API and packed array returns."""
+        namespace = Namespace(
+            name="Example",
+            structs=[
+                Struct(
+                    name="Summary",
+                    fields=[
+                        StructField(name="count", type=PrimitiveType(name="int32_t")),
+                        StructField(name="title", type=FixedStringType(capacity=64)),
+                    ],
+                )
+            ],
+            interfaces=[
+                Interface(
+                    name="IProject",
+                    methods=[
+                        Method(
+                            name="GetSummaries",
+                            return_type=ArrayType(element_type=TypeRef(name="Summary")),
+                        )
+                    ],
+                )
+            ],
+        )
+
+        files = generator.generate(IDLFile(namespaces=[namespace]), tmp_path)
+        types = next(f for f in files if f.name == "Types.swift").read_text()
+        wrapper = next(f for f in files if f.name == "Example.swift").read_text()
+
+        assert "public typealias Summary = ExampleC.Summary" in types
+        assert "public var titleString: String {" in types
+        assert "truncates to 63 UTF-8 bytes" in types
+        assert "func takePackedArray<T>" in types
+        assert "public func GetSummaries() -> [Summary] {" in wrapper
+        assert "takePackedArray(IProject_GetSummaries(handle), as: Summary.self)" in wrapper
+
+    def test_interface_snapshot(self, generator, tmp_path):
+        """Test snapshot() decoding the C property snapshot."""
+        namespace = Namespace(
+            name="Example",
+            interfaces=[
+                Interface(
+                    name="ITask",
+                    properties=[
+                        Property(name="title", type=PrimitiveType(name="string_t")),
+                        Property(name="done", type=PrimitiveType(name="bool")),
+                        Property(name="key", type=PrimitiveType(name="id_t")),
+                        Property(
+                            name="labels", type=ArrayType(element_type=PrimitiveType(name="id_t"))
+                        ),
+                        Property(
+                            name="tags", type=ArrayType(element_type=PrimitiveType(name="string_t"))
+                        ),
+                        Property(
+                            name="parent", type=NullableType(inner_type=TypeRef(name="ITask"))
+                        ),
+                    ],
+                )
+            ],
+        )
+
+        files = generator.generate(IDLFile(namespaces=[namespace]), tmp_path)
+        wrapper = next(f for f in files if f.name == "Example.swift").read_text()
+        types = next(f for f in files if f.name == "Types.swift").read_text()
+
+        assert "public struct Snapshot {" in wrapper
+        assert "public let title: String" in wrapper
+        assert "public let parent" not in wrapper
+        assert "public func snapshot() -> Snapshot? {" in wrapper
+        assert "guard ITask_Snapshot(handle, &raw) else {" in wrapper
+        assert "defer { ITask_Snapshot_Release(&raw) }" in wrapper
+        assert "title: makeString(raw.title)," in wrapper
+        assert "public let key: ExampleId" in wrapper
+        assert "key: ExampleId(handle: raw.key)," in wrapper
+        assert (
+            "labels: readPackedArray(raw.labels, as: Example_Id.self)"
+            ".map { ExampleId(handle: $0) },"
+        ) in wrapper
+        assert "tags: readStringArray(raw.tags)\n" in wrapper
+        assert "internal func makeString(_ view: Example_StringView) -> String {" in types
+
+    def test_batch_calls(self, generator, tmp_path):
+        """Test static wrappers over the C _Batch calls."""
+        namespace = Namespace(
+            name="Example",
+            interfaces=[
+                Interface(
+                    name="ITask",
+                    properties=[
+                        Property(name="done", type=PrimitiveType(name="bool"), writable=True),
+                        Property(name="title", type=PrimitiveType(name="string_t")),
+                    ],
+                    methods=[
+                        Method(name="Complete", return_type=PrimitiveType(name="void")),
+                        Method(
+                            name="Scale",
+                            return_type=PrimitiveType(name="double"),
+                            parameters=[
+                                Parameter(name="factor", type=PrimitiveType(name="double"))
+                            ],
+                        ),
+                    ],
+                )
+            ],
+        )
+
+        files = generator.generate(IDLFile(namespaces=[namespace]), tmp_path)
+        wrapper = next(f for f in files if f.name == "Example.swift").read_text()
+
+        assert "public static func done(of objects: [Task]) -> [Bool] {" in wrapper
+        assert "initializedCount = ITask_Getdone_Batch(handles, handles.count, buffer.baseAddress)" in wrapper
+        assert "public static func setDone(of objects: [Task], to values: [Bool]) -> Int {" in wrapper
+        assert "public static func Complete(_ objects: [Task]) -> Int {" in wrapper
+        assert "public static func Scale(_ objects: [Task], factor: [Double]) -> [Double] {" in wrapper
+        assert "ITask_Scale_Batch(handles, handles.count, factor, buffer.baseAddress)" in wrapper
+        assert "title(of objects:" not in wrapper
+
+    def test_stream_methods(self, generator, tmp_path):
+        """Test stream methods return a Sequence over the C chunked reads."""
+        namespace = Namespace(
+            name="Example",
+            interfaces=[
+                Interface(name="ITask"),
+                Interface(
+                    name="IProject",
+                    methods=[
+                        Method(name="GetTasks", return_type=StreamType(element_type=TypeRef(name="ITask"))),
+                        Method(name="GetNames", return_type=StreamType(element_type=PrimitiveType(name="string_t"))),
+                    ],
+                ),
+            ],
+        )
+
+        files = generator.generate(IDLFile(namespaces=[namespace]), tmp_path)
+        wrapper = next(f for f in files if f.name == "Example.swift").read_text()
+        types = next(f for f in files if f.name == "Types.swift").read_text()
+
+        assert "public func GetTasks() -> ExampleStream<Task> {" in wrapper
+        assert "return ExampleStream(stream, as: ITask_Handle?.self) { raw in" in wrapper
+        assert "return ExampleStream(stream, as: Example_StringView.self) { makeString($0) }" in wrapper
+        assert "public final class ExampleStream<Element>: Sequence, IteratorProtocol {" in types
+        assert "ExampleStream_Release(handle)" in types
+
+    def test_async_methods(self, generator, tmp_path):
+        """Test async methods bridge the C callback to Swift concurrency."""
+        namespace = Namespace(
+            name="Example",
+            interfaces=[
+                Interface(
+                    name="IStore",
+                    methods=[
+                        Method(
+                            name="Save",
+                            return_type=PrimitiveType(name="void"),
+                            parameters=[Parameter(name="path", type=PrimitiveType(name="string_t"))],
+                            is_async=True,
+                        ),
+                        Method(
+                            name="Load",
+                            return_type=PrimitiveType(name="string_t"),
+                            is_async=True,
+                        ),
+                    ],
+                )
+            ],
+        )
+
+        files = generator.generate(IDLFile(namespaces=[namespace]), tmp_path)
+        wrapper = next(f for f in files if f.name == "Example.swift").read_text()
+        types = next(f for f in files if f.name == "Types.swift").read_text()
+
+        assert "public func Save(path: String) async throws {" in wrapper
+        assert "public func Load() async throws -> String {" in wrapper
+        assert "let context = Unmanaged.passRetained(AsyncCompletion(continuation)).toOpaque()" in wrapper
+        assert "{ context, code, result in" in wrapper
+        assert 'completion.finish(code) { takeString(result) ?? "" }' in wrapper
+        assert "internal final class AsyncCompletion<T> {" in types
+        assert "public struct ExampleError: Error {" in types
+
+    def test_events(self, generator, tmp_path):
+        """Test events bridge their C callback to closures and Combine publishers."""
+        namespace = Namespace(
+            name="Example",
+            interfaces=[
+                Interface(
+                    name="IProject",
+                    events=[
+                        Event(
+                            name="Renamed",
+                            parameters=[
+                                Parameter(name="name", type=PrimitiveType(name="string_t")),
+                                Parameter(name="revision", type=PrimitiveType(name="int32_t")),
+                            ],
+                        ),
+                        Event(name="Changed"),
+                    ],
+                )
+            ],
+        )
+
+        files = generator.generate(IDLFile(namespaces=[namespace]), tmp_path)
+        wrapper = next(f for f in files if f.name == "Example.swift").read_text()
+        types = next(f for f in files if f.name == "Types.swift").read_text()
+
+        assert (
+            "public func onRenamed(_ handler: @escaping (String, Int32) -> Void) -> EventSubscription {"
+        ) in wrapper
+        assert 'handler(name.map { String(cString: $0) } ?? "", revision)' in wrapper
+        assert "_ = IProject_Renamed_Unsubscribe(handle, subscription)" in wrapper
+        assert (
+            "public func renamedPublisher() -> AnyPublisher<(name: String, revision: Int32), Never> {"
+        ) in wrapper
+        assert "public func changedPublisher() -> AnyPublisher<Void, Never> {" in wrapper
+        assert "#if canImport(Combine)\nimport Combine\n#endif" in wrapper
+        assert "public func dispatchEvents() -> Int {" in types
+        assert "public final class EventSubscription {" in types
+        assert "extension EventSubscription: Cancellable {}" in types
+
+    def test_ids(self, generator, tmp_path):
+        """Test ids are wrapped in a Hashable struct over the C handle."""
+        namespace = Namespace(
+            name="Example",
+            interfaces=[
+                Interface(
+                    name="IItem",
+                    properties=[
+                        Property(name="key", type=PrimitiveType(name="id_t"), writable=True),
+                        Property(name="tags", type=ArrayType(element_type=PrimitiveType(name="id_t"))),
+                    ],
+                    methods=[
+                        Method(
+                            name="Rekey",
+                            return_type=PrimitiveType(name="id_t"),
+                            parameters=[Parameter(name="from", type=PrimitiveType(name="id_t"))],
+                        )
+                    ],
+                )
+            ],
+        )
+
+        files = generator.generate(IDLFile(namespaces=[namespace]), tmp_path)
+        wrapper = next(f for f in files if f.name == "Example.swift").read_text()
+        types = next(f for f in files if f.name == "Types.swift").read_text()
+
+        assert (
+            "public struct ExampleId: Hashable, CustomStringConvertible, ExpressibleByStringLiteral {"
+        ) in types
+        assert "self.handle = Example_InternId(value)" in types
+        assert "hasher.combine(Example_GetIdHash(handle))" in types
+        assert "public var key: ExampleId {" in wrapper
+        assert "return ExampleId(handle: IItem_Getkey(handle))" in wrapper
+        assert "IItem_Setkey(handle, newValue.handle)" in wrapper
+        assert "return items.prefix(copied).map { ExampleId(handle: $0) }" in wrapper
+        assert "public func Rekey(from: ExampleId) -> ExampleId {" in wrapper
+        assert "handle, from.handle)" in wrapper
+        assert "static func key(of objects:" not in wrapper
+
+    def test_strings(self, tmp_path):
+        """Test strings are decoded by length and set through views."""
+        namespace = Namespace(
+            name="Example",
+            interfaces=[
+                Interface(
+                    name="IItem",
+                    properties=[
+                        Property(name="title", type=PrimitiveType(name="string_t"), writable=True),
+                        Property(
+                            name="note",
+                            type=NullableType(inner_type=PrimitiveType(name="string_t")),
+                            writable=True,
+                        ),
+                        Property(
+                            name="created",
+                            type=PrimitiveType(name="string_t"),
+                            attributes=["immutable"],
+                        ),
+                    ],
+                    methods=[Method(name="Describe", return_type=PrimitiveType(name="string_t"))],
+                )
+            ],
+        )
+
+        files = SwiftGenerator().generate(IDLFile(namespaces=[namespace]), tmp_path)
+        wrapper = next(f for f in files if f.name == "Example.swift").read_text()
+        types = next(f for f in files if f.name == "Types.swift").read_text()
+
+        assert "internal func takeString(_ string: IDynamicString_Handle?) -> String? {" in types
+        assert "internal func withStringView<R>(" in types
+        assert 'return takeString(IItem_Gettitle(handle)) ?? ""' in wrapper
+        assert "withStringView(newValue) { IItem_Settitle_View(handle, $0) }" in wrapper
+        assert "return takeString(IItem_Getnote(handle))\n" in wrapper
+        assert "let value = newValue.flatMap { IDynamicString_Create($0) }" in wrapper
+        assert "public private(set) lazy var created: String = createdValue()" in wrapper
+        assert "private func createdValue() -> String {" in wrapper
+        assert 'return takeString(IItem_Describe(handle)) ?? ""' in wrapper
+        assert "String(cString:" not in wrapper
+
+        files = SwiftGenerator(config={"string_views": True}).generate(
+            IDLFile(namespaces=[namespace]), tmp_path / "views"
+        )
+        wrapper = next(f for f in files if f.name == "Example.swift").read_text()
+        assert "return makeString(IItem_Gettitle_View(handle))" in wrapper
+        assert "return makeString(IItem_Getcreated_View(handle))" in wrapper
@@ -37,6 +37,196 @@ class TestSemanticValidation:
         with pytest.raises(ValidationError, match="Unknown type 'UnknownType'"):
             validate_ast(ast)
 
+    def test_unknown_interface_attribute(self) -> None:
+        """Test detection of unknown and repeated interface attributes."""
+        idl = """
+        namespace Test {
+            [sealed, sealed]
+            interface ICounter {
+                int32_t value;
+            }
+
+            [frozen]
+            interface IUser {
+                string_t GetName();
+            }
+        }
+        """
+        ast = parse_idl(idl)
+
+        with pytest.raises(ValidationError) as exc_info:
+            validate_ast(ast)
+        message = str(exc_info.value)
+        assert "Duplicate attribute 'sealed' on interface ICounter" in message
+        assert "Unknown attribute 'frozen' on interface IUser" in message
+
+    def test_property_attribute_rules(self) -> None:
+        """Test the rules for immutable and readmostly properties."""
+        idl = """
+        namespace Test {
+            interface ITask {
+                [immutable] string_t id writable;
+                [immutable, readmostly] string_t title;
+                [readmostly, readmostly] int32_t hits;
+                [sealed] bool done;
+            }
+        }
+        """
+        ast = parse_idl(idl)
+
+        with pytest.raises(ValidationError) as exc_info:
+            validate_ast(ast)
+        message = str(exc_info.value)
+        assert "Immutable property ITask::id cannot be writable" in message
+        assert "Property ITask::title cannot be both immutable and readmostly" in message
+        assert "Duplicate attribute 'readmostly' on property ITask::hits" in message
+        assert "Unknown attribute 'sealed' on property ITask::done" in message
+
+    def test_stream_rules(self) -> None:
+        """Test that streams are synchronous method results of a basic type."""
+        idl = """
+        namespace Test {
+            interface IFeed {
+                async stream<int32_t> Poll();
+                stream<void> Drain();
+                void Push(stream<int32_t> items);
+                stream<string_t> names;
+            }
+        }
+        """
+        ast = parse_idl(idl)
+
+        with pytest.raises(ValidationError) as exc_info:
+            validate_ast(ast)
+        message = str(exc_info.value)
+        assert "Async method IFeed::Poll cannot return a stream" in message
+        assert "Invalid void type in stream element in return type of Drain" in message
+        assert "Streams are only allowed as method return types, not in parameter 'items' of Push" in message
+        assert "Streams are only allowed as method return types, not in property names" in message
+
+    def test_async_method_rules(self) -> None:
+        """Test that async methods are not noexcept and keep their callback names free."""
+        idl = """
+        namespace Test {
+            interface IStore {
+                async void Save(string_t path) noexcept;
+                async void Load(string_t callback, int32_t context);
+                void Notify(string_t callback);
+            }
+        }
+        """
+        ast = parse_idl(idl)
+
+        with pytest.raises(ValidationError) as exc_info:
+            validate_ast(ast)
+        message = str(exc_info.value)
+        assert "Async method IStore::Save cannot be noexcept" in message
+        assert "Parameter name 'callback' is reserved in async method IStore::Load" in message
+        assert "Parameter name 'context' is reserved in async method IStore::Load" in message
+        assert "IStore::Notify" not in message
+
+    def test_event_rules(self) -> None:
+        """Test that events are unique and only carry values."""
+        idl = """
+        namespace Test {
+            enum Level : int32_t { Low = 0, High = 1 }
+            struct Point { int32_t x; int32_t y; }
+            interface IItem {
+                event Moved(Point to, Level level, string_t note);
+            }
+            interface IList {
+                int32_t Count;
+                event Count();
+                event Added(IItem item);
+                event Grown(int32_t[] sizes);
+                event Cleared(bool all, bool all);
+                event Cleared();
+                event Ticked(int32_t context);
+                event Lost(IMissing thing);
+            }
+        }
+        """
+        ast = parse_idl(idl)
+
+        with pytest.raises(ValidationError) as exc_info:
+            validate_ast(ast)
+        message = str(exc_info.value)
+        assert "IItem" not in message
+        assert "Event 'Count' conflicts with a member name in interface IList" in message
+        assert "Invalid type in parameter 'item' of event IList::Added" in message
+        assert "Invalid type in parameter 'sizes' of event IList::Grown" in message
+        assert "Duplicate event name 'Cleared' in interface IList" in message
+        assert "Duplicate parameter name 'all' in event IList::Cleared" in message
+        assert "Parameter name 'context' is reserved in event IList::Ticked" in message
+        assert "Unknown type 'IMissing'" in message
+
+    def test_id_rules(self) -> None:
+        """Test that ids stay out of structs and are never nullable."""
+        idl = """
+        namespace Test {
+            struct Entry { id_t key; int32_t count; }
+            interface IIndex {
+                id_t[] keys;
+                dict<id_t, int32_t> counts;
+                id_t? parent;
+                event Moved(id_t key);
+            }
+        }
+        """
+        ast = parse_idl(idl)
+
+        with pytest.raises(ValidationError) as exc_info:
+            validate_ast(ast)
+        message = str(exc_info.value)
+        assert (
+            "Interned id in field 'key' of struct Entry; ids are local to a process, use string_t<N>"
+        ) in message
+        assert "Nullable id in property parent; the empty id already means no id" in message
+        assert "keys" not in message
+        assert "counts" not in message
+        assert "Moved" not in message
+
+    def test_struct_field_rules(self) -> None:
+        """Test that struct fields must have a fixed size."""
+        idl = """
+        namespace Test {
+            struct Empty {
+            }
+
+            struct Line {
+                string_t text;
+                IUser owner;
+                Later later;
+                string_t<0> code;
+                int32_t text;
+            }
+
+            struct Later {
+                int32_t value;
+            }
+
+            interface IUser {
+                Later[] history;
+                set<Later> unique;
+                Later? maybe;
+            }
+        }
+        """
+        ast = parse_idl(idl)
+
+        with pytest.raises(ValidationError) as exc_info:
+            validate_ast(ast)
+        message = str(exc_info.value)
+        assert "Struct Empty must have at least one field" in message
+        assert "Variable-length string in field 'text' of struct Line; use string_t<N>" in message
+        assert "Invalid type 'IUser' in field 'owner' of struct Line" in message
+        assert "Struct 'Later' in field 'later' of struct Line must be declared before Line" in message
+        assert "needs a capacity of at least 1" in message
+        assert "Duplicate field name 'text' in struct Line" in message
+        assert "Struct 'Later' cannot be used as set element" in message
+        assert "Struct 'Later' cannot be used as nullable type" in message
+        assert "history" not in message
+
     def test_forward_declaration_resolution(self) -> None:
         """Test that forward declarations are properly resolved."""
         idl = """
@@ -72,6 +72,72 @@ class TestCppWorkflow:
         assert (project_dir / "src" / "example.cpp").exists()
         assert (project_dir / "tests" / "test_main.cpp").exists()
 
+    def test_runtime_header(self, simple_ast, tmp_path):
+        """Test the runtime header ships the intrusive reference counting."""
+        workflow = CppWorkflow()
+        workflow.generate_project(simple_ast, tmp_path)
+
+        runtime = (tmp_path / "Test" / "include" / "minimidl_runtime.hpp").read_text()
+        assert "class RefCounted" in runtime
+        assert "class object_ptr" in runtime
+        assert "make_object" in runtime
+        assert "class read_mostly" in runtime
+        assert "class stream" in runtime
+        assert "namespace wire" in runtime
+
+    def test_serialization_headers(self, simple_ast, tmp_path):
+        """Test the serialization option adds a header per namespace."""
+        workflow = CppWorkflow({"serialization": True})
+        workflow.generate_project(simple_ast, tmp_path)
+
+        assert (tmp_path / "Test" / "include" / "TestSerialization.hpp").exists()
+        assert "include/TestSerialization.hpp" in workflow._generate_cmake("Test", simple_ast)
+
+    def test_remote_headers(self, simple_ast, tmp_path):
+        """Test the remote option adds proxies, their codecs and the IPC runtime."""
+        workflow = CppWorkflow({"remote": True})
+        workflow.generate_project(simple_ast, tmp_path)
+
+        include_dir = tmp_path / "Test" / "include"
+        assert (include_dir / "TestRemote.hpp").exists()
+        assert (include_dir / "TestSerialization.hpp").exists()
+        assert "class shared_memory" in (include_dir / "minimidl_ipc.hpp").read_text()
+        cmake = workflow._generate_cmake("Test", simple_ast)
+        assert "include/TestRemote.hpp" in cmake
+        assert "include/minimidl_ipc.hpp" in cmake
+
+    def test_benchmarks(self, simple_ast, tmp_path):
+        """Test the benchmarks option adds a benchmark target."""
+        workflow = CppWorkflow({"benchmarks": True})
+        workflow.generate_project(simple_ast, tmp_path)
+
+        benchmarks_dir = tmp_path / "Test" / "benchmarks"
+        assert (benchmarks_dir / "TestBenchmarks.cpp").exists()
+        cmake = (benchmarks_dir / "CMakeLists.txt").read_text()
+        assert "benchmark::benchmark_main" in cmake
+        assert "if(TARGET test_wrapper)" in cmake
+        assert "add_subdirectory(benchmarks)" in workflow._generate_cmake("Test", simple_ast)
+        assert "add_subdirectory(benchmarks)" not in CppWorkflow()._generate_cmake(
+            "Test", simple_ast
+        )
+
+    def test_split_headers(self, simple_ast, tmp_path):
+        """Test split headers get a precompiled runtime and module target."""
+        workflow = CppWorkflow({"split_headers": True})
+        workflow.generate_project(simple_ast, tmp_path)
+
+        include_dir = tmp_path / "Test" / "include"
+        assert (include_dir / "Test_fwd.hpp").exists()
+        assert (include_dir / "Test_IExample.hpp").exists()
+        assert (include_dir / "Test.cppm").exists()
+        cmake = (tmp_path / "Test" / "CMakeLists.txt").read_text()
+        assert "include/Test_types.hpp" in cmake
+        assert "target_precompile_headers(${PROJECT_NAME}_pch" in cmake
+        assert "target_link_libraries(example PRIVATE ${PROJECT_NAME}_pch)" in cmake
+        assert "FILE_SET CXX_MODULES" in cmake
+        assert "                include/Test.cppm" in cmake
+        assert "_pch" not in CppWorkflow()._generate_cmake("Test", simple_ast)
+
     def test_generate_cmake(self, simple_ast):
         """Test CMake file generation."""
         workflow = CppWorkflow()